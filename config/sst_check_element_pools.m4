@@ -0,0 +1,12 @@
+AC_DEFUN([SST_CHECK_ELEMENT_POOLS], [
+
+AC_ARG_ENABLE([element-pools],
+  [AS_HELP_STRING([--(dis|en)able-element-pools],
+    [recycle ember events, vanadis instructions and miranda requests through thread local free lists instead of the global allocator [default=enable]])],
+  [sst_check_element_pools_happy="$enableval"],
+  [sst_check_element_pools_happy="yes"])
+if test "X$sst_check_element_pools_happy" != "Xno"; then
+  AC_DEFINE_UNQUOTED([ENABLE_ELEMENT_POOLS], 1, "Whether elements recycle frequently allocated objects through free lists")
+fi
+
+])
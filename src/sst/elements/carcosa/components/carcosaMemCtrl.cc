@@ -732,9 +732,7 @@ void CarcosaMemCtrl::readData(MemEvent* event) {
 void CarcosaMemCtrl::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++) {
-        backing_->set(addr + i, data->at(i));
-    }
+    backing_->setBytes(addr, data->size(), data->data());
     printDataValue(addr, data, true);
 }
 
@@ -744,8 +742,7 @@ void CarcosaMemCtrl::readData(Addr addr, size_t bytes, std::vector<uint8_t> &dat
 
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->getBytes(addr, bytes, data.data());
 
     if (is_debug_addr(addr))
         printDataValue(addr, &data, false);
@@ -58,6 +58,7 @@ void c_CmdScheduler::build(Params &x_params) {
 
     m_cmdQueues.resize(m_numChannels);
     m_nextCmdQIdx.resize(m_numChannels);
+    m_numPendingCmds.resize(m_numChannels, 0);
     for(unsigned l_ch=0;l_ch<m_numChannels;l_ch++) {
         m_nextCmdQIdx.at(l_ch)=0;
         for (unsigned l_bankIdx = 0; l_bankIdx < m_numBanks; l_bankIdx++) {
@@ -101,7 +102,9 @@ void c_CmdScheduler::run(SimTime_t simCycle){
     for(unsigned l_ch=0;l_ch<m_numChannels;l_ch++) {
 
         unsigned nextBankIdx = m_nextCmdQIdx.at(l_ch);
-        for (unsigned i = 0; i < m_numBanksPerChannel; i++) {
+        // channels are independent, one without queued commands has nothing to do
+        // apart from moving its round robin pointer
+        for (unsigned i = 0; i < m_numBanksPerChannel && m_numPendingCmds[l_ch] > 0; i++) {
             c_CmdQueue &l_cmdQueue = m_cmdQueues[l_ch].at(nextBankIdx);
 
             if (!l_cmdQueue.empty()) {
@@ -111,6 +114,7 @@ void c_CmdScheduler::run(SimTime_t simCycle){
                     isSuccess = m_deviceController->push(l_cmdPtr);
                     if (isSuccess) {
                         l_cmdQueue.pop_front();
+                        m_numPendingCmds[l_ch]--;
 
 #ifdef __SST_DEBUG_OUTPUT__
                         l_cmdPtr->print(output, "[c_CmdScheduler]", simCycle);
@@ -139,6 +143,7 @@ bool c_CmdScheduler::push(c_BankCommand* x_cmd) {
 
     if (m_cmdQueues[l_ch].at(l_bank).size() < k_numCmdQEntries) {
         m_cmdQueues[l_ch].at(l_bank).push_back(x_cmd);
+        m_numPendingCmds[l_ch]++;
         return true;
     } else
         return false;
@@ -82,6 +82,7 @@ namespace SST{
 
             std::vector<std::vector<c_CmdQueue>> m_cmdQueues;  //per-bank command queue for each channel
             std::vector<unsigned> m_nextCmdQIdx;                //index for command queue scheduling (Round Robin)
+            std::vector<unsigned> m_numPendingCmds;             //commands queued per channel, channels with none are skipped
 
             Output* output;
             unsigned m_numBanks;
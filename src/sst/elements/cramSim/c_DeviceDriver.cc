@@ -459,10 +459,14 @@ void c_DeviceDriver::update(SimTime_t simCycle) {
         // m_banks.at(l_i)->printState();
     }
     //update ACTFAWTracker info
-    for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
-        m_cmdACTFAWtrackers[l_rankNum].push_back(
-                m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
-        m_cmdACTFAWtrackers[l_rankNum].pop_front();
+    if (!m_cmdACTFAWtrackers.empty() && !m_cmdACTFAWtrackers[0].empty()) {
+        for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
+            uint8_t& l_oldest = m_cmdACTFAWtrackers[l_rankNum][m_cmdACTFAWtrackerPos];
+            m_numACTinFAW[l_rankNum] -= l_oldest;
+            l_oldest = m_isACTIssued[l_rankNum] ? 1 : 0;
+            m_numACTinFAW[l_rankNum] += l_oldest;
+        }
+        m_cmdACTFAWtrackerPos = (m_cmdACTFAWtrackerPos + 1) % m_cmdACTFAWtrackers[0].size();
     }
 
     // do the member var setup up before calling any req sending policy function
@@ -877,13 +881,10 @@ bool c_DeviceDriver::sendCommand(c_BankCommand* x_bankCommandPtr,
 void c_DeviceDriver::initACTFAWTracker()
 {
     m_cmdACTFAWtrackers.clear();
-    for(int i=0; i<m_numRanks;i++)
-    {
-        std::list<unsigned> l_cmdACTFAWTracker;
-        l_cmdACTFAWTracker.clear();
-        l_cmdACTFAWTracker.resize(m_bankParams.at("nFAW")-1, 0);
-        m_cmdACTFAWtrackers.push_back(l_cmdACTFAWTracker);
-    }
+    m_cmdACTFAWtrackers.resize(m_numRanks, std::vector<uint8_t>(m_bankParams.at("nFAW")-1, 0));
+    m_numACTinFAW.clear();
+    m_numACTinFAW.resize(m_numRanks, 0);
+    m_cmdACTFAWtrackerPos = 0;
 }
 
 /*!
@@ -914,11 +915,8 @@ unsigned c_DeviceDriver::getNumIssuedACTinFAW(unsigned x_rankid) {
     assert(x_rankid<m_numRanks);
 
     // get count of ACT cmds issued in the FAW
-    unsigned l_cmdACTIssuedInFAW = 0;
     assert(m_cmdACTFAWtrackers[x_rankid].size() == m_bankParams.at("nFAW")-1);
-    for(auto& l_issued : m_cmdACTFAWtrackers[x_rankid])
-        l_cmdACTIssuedInFAW += l_issued;
-    return l_cmdACTIssuedInFAW;
+    return m_numACTinFAW[x_rankid];
 }
 
 /*!
@@ -184,7 +184,9 @@ private:
     e_BankCommandType m_lastDataCmdType;
     unsigned m_lastChannel;
     unsigned m_lastPseudoChannel;
-    std::vector<std::list<unsigned>> m_cmdACTFAWtrackers; // FIXME: change this to a circular buffer for speed. Could also implement as shift register.
+    std::vector<std::vector<uint8_t>> m_cmdACTFAWtrackers; // per rank circular buffer, ACT issued in each of the last nFAW-1 cycles
+    std::vector<unsigned> m_numACTinFAW; // per rank count of ACTs in the tracker
+    unsigned m_cmdACTFAWtrackerPos; // oldest cycle in the trackers
     std::vector<bool> m_isACTIssued;
     bool m_issuedACT;
 
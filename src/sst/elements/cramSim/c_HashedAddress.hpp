@@ -73,6 +73,7 @@ public:
   void serialize_order(SST::Core::Serialization::serializer &ser) override
   {
     SST_SER(m_channel);
+    SST_SER(m_pchannel);
     SST_SER(m_rank);
     SST_SER(m_bankgroup);
     SST_SER(m_bank);
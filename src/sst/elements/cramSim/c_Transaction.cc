@@ -153,4 +153,5 @@ void c_Transaction::serialize_order(SST::Core::Serialization::serializer &ser)
   SST_SER(m_dataWidth);
   SST_SER(m_processed);
   SST_SER(m_hasHashedAddr);
+  SST_SER(m_hashedAddr);
 }
@@ -53,8 +53,14 @@ c_TxnDispatcher::c_TxnDispatcher(ComponentId_t x_id, Params &params):Component(x
     }
     assert(k_numLanes>0);
 
+    k_dispatchByChannel = (params.find<uint32_t>("boolDispatchByChannel", 0) != 0);
+    m_addrHasher = nullptr;
+    if(k_dispatchByChannel) {
+        configureChannelDispatch(params);
+    }
+
     string l_laneIdxString = (string) params.find<string>("laneIdxPos", "13:12", l_found);
-    if(k_numLanes>1) {
+    if(k_numLanes>1 && !k_dispatchByChannel) {
         if (!l_found) {
             output->fatal(CALL_INFO, -1, "the bit position of lane index is not specified... it should be \"end:start\"\n");
         } else {
@@ -109,6 +115,58 @@ c_TxnDispatcher::c_TxnDispatcher(ComponentId_t x_id, Params &params):Component(x
 }
 c_TxnDispatcher::~c_TxnDispatcher(){}
 
+// Every lane is a controller for one channel. The addresses are hashed here
+// with the geometry of the whole memory, so each controller gets the hashed
+// address within its own channel and clocks only the banks of that channel.
+void c_TxnDispatcher::configureChannelDispatch(Params &params)
+{
+    bool l_found=false;
+
+    unsigned l_numChannels = params.find<unsigned>("numChannels", 1);
+    if (l_numChannels != k_numLanes) {
+        output->fatal(CALL_INFO, -1, "numChannels (%u) must be equal to numLanes (%u) to dispatch by channel\n",
+                      l_numChannels, k_numLanes);
+    }
+
+    unsigned l_numPChannels = params.find<unsigned>("numPChannelsPerChannel", 1);
+
+    unsigned l_numRanks = params.find<unsigned>("numRanksPerChannel", 2, l_found);
+    if (!l_found) {
+        output->fatal(CALL_INFO, -1, "numRanksPerChannel value is missing... exiting\n");
+    }
+
+    unsigned l_numBankGroups = params.find<unsigned>("numBankGroupsPerRank", 100, l_found);
+    if (!l_found) {
+        output->fatal(CALL_INFO, -1, "numBankGroupsPerRank value is missing... exiting\n");
+    }
+
+    unsigned l_numBanks = params.find<unsigned>("numBanksPerBankGroup", 100, l_found);
+    if (!l_found) {
+        output->fatal(CALL_INFO, -1, "numBanksPerBankGroup value is missing... exiting\n");
+    }
+
+    unsigned l_numRows = params.find<unsigned>("numRowsPerBank", 100, l_found);
+    if (!l_found) {
+        output->fatal(CALL_INFO, -1, "numRowsPerBank value is missing... exiting\n");
+    }
+
+    unsigned l_numCols = params.find<unsigned>("numColsPerBank", 100, l_found);
+    if (!l_found) {
+        output->fatal(CALL_INFO, -1, "numColsPerBank value is missing... exiting\n");
+    }
+
+    m_ranksPerChannel = l_numPChannels * l_numRanks;
+    m_banksPerChannel = m_ranksPerChannel * l_numBankGroups * l_numBanks;
+
+    m_addrHasher = loadUserSubComponent<c_AddressHasher>("AddrMapper", ComponentInfo::SHARE_NONE, output, l_numChannels,
+            l_numRanks, l_numBankGroups, l_numBanks, l_numRows, l_numCols, l_numPChannels);
+    if (!m_addrHasher) {
+        std::string l_subCompName = params.find<std::string>("AddrMapper", "cramSim.c_AddressHasher");
+        m_addrHasher = loadAnonymousSubComponent<c_AddressHasher>(l_subCompName, "AddrMapper", 0, ComponentInfo::INSERT_STATS, params, output,
+                l_numChannels, l_numRanks, l_numBankGroups, l_numBanks, l_numRows, l_numCols, l_numPChannels);
+    }
+}
+
 c_TxnDispatcher::c_TxnDispatcher() :
         Component(-1) {
     // for serialization only
@@ -166,7 +224,21 @@ uint32_t c_TxnDispatcher::getLaneIdx(uint64_t x_addr)
 void c_TxnDispatcher::sendRequest(c_TxnReqEvent* x_newReq)
 {
     uint64_t l_addr = x_newReq->m_payload->getAddress();
-    uint32_t l_laneIdx = getLaneIdx(l_addr);
+    uint32_t l_laneIdx;
+
+    if(k_dispatchByChannel) {
+        c_HashedAddress l_hashedAddr;
+        m_addrHasher->fillHashedAddress(&l_hashedAddr, l_addr);
+        l_laneIdx = l_hashedAddr.getChannel();
+
+        // rebase to the single channel seen by the lane controller
+        l_hashedAddr.setChannel(0);
+        l_hashedAddr.setBankId(l_hashedAddr.getBankId() - l_laneIdx * m_banksPerChannel);
+        l_hashedAddr.setRankId(l_hashedAddr.getRankId() - l_laneIdx * m_ranksPerChannel);
+        x_newReq->m_payload->setHashedAddress(l_hashedAddr);
+    } else {
+        l_laneIdx = getLaneIdx(l_addr);
+    }
 
     assert(l_laneIdx < m_laneLinks.size());
 
@@ -33,6 +33,7 @@
 #include <sst/core/component.h>
 #include <sst/core/link.h>
 #include "c_Transaction.hpp"
+#include "c_AddressHasher.hpp"
 #include "c_TxnReqEvent.hpp"
 #include "c_TxnResEvent.hpp"
 
@@ -54,6 +55,14 @@ namespace SST{
             SST_ELI_DOCUMENT_PARAMS(
                 {"numLanes", "Total number of lanes", NULL},
                 {"laneIdxPosition", "Bit posiiton of the lane index in the address.. [End:Start]", NULL},
+                {"boolDispatchByChannel", "Hash each address and send it to the lane of its channel, every lane is a single channel controller", "0"},
+                {"numChannels", "Total number of channels, must match numLanes when dispatching by channel", "1"},
+                {"numPChannelsPerChannel", "Number of pseudo channels per channel, used when dispatching by channel", "1"},
+                {"numRanksPerChannel", "Number of ranks per channel, used when dispatching by channel", NULL},
+                {"numBankGroupsPerRank", "Number of bank groups per rank, used when dispatching by channel", NULL},
+                {"numBanksPerBankGroup", "Number of banks per bank group, used when dispatching by channel", NULL},
+                {"numRowsPerBank", "Number of rows per bank, used when dispatching by channel", NULL},
+                {"numColsPerBank", "Number of columns per bank, used when dispatching by channel", NULL},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -61,6 +70,10 @@ namespace SST{
                 { "lane_%(lanes)d", "link to/from lanes",  {"MemEvent"} },
             )
 
+            SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+                {"AddrMapper", "address hasher used when dispatching by channel. Default: cramSim.c_AddressHasher", "SST::CramSim::c_AddressHasher"},
+            )
+
              c_TxnDispatcher( ComponentId_t id, Params& params);
              ~c_TxnDispatcher();
 
@@ -72,6 +85,7 @@ namespace SST{
              void handleCtrlEvent(SST::Event *ev);
              void sendRequest(c_TxnReqEvent *ev);
              void sendResponse(c_TxnResEvent *ev);
+             void configureChannelDispatch(Params &params);
 
              uint32_t getLaneIdx(uint64_t x_addr);
 
@@ -88,6 +102,13 @@ namespace SST{
              uint64_t m_laneIdxMask;
 
              uint32_t k_numLanes;
+
+             // dispatch by channel
+             bool k_dispatchByChannel;
+             c_AddressHasher* m_addrHasher;
+             unsigned m_banksPerChannel;
+             unsigned m_ranksPerChannel;
+
              Output dbg;
              Output* output;
          };
@@ -0,0 +1,132 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+// std includes
+#include <algorithm>
+#include <assert.h>
+
+// local includes
+#include "c_TxnQueueIndex.hpp"
+
+using namespace SST;
+using namespace SST::CramSim;
+
+
+c_TxnQueueIndex::c_TxnQueueIndex(TxnQueue* x_queue) :
+    m_queue(x_queue), m_nextOrder(0) {
+    assert(m_queue->empty());
+}
+
+void c_TxnQueueIndex::push(c_Transaction* x_txn)
+{
+    const c_HashedAddress& l_addr = x_txn->getHashedAddress();
+    unsigned l_bankId = l_addr.getBankId();
+
+    if (l_bankId >= m_banks.size()) {
+        m_banks.resize(l_bankId + 1);
+        m_bankBitmap.resize(l_bankId / 64 + 1, 0);
+    }
+
+    Bank& l_bank = m_banks[l_bankId];
+    TxnQueue& l_row = l_bank.rows[l_addr.getRow()];
+
+    Entry l_entry;
+    l_entry.order = m_nextOrder++;
+    l_entry.queuePos = m_queue->insert(m_queue->end(), x_txn);
+    l_entry.bankPos = l_bank.txns.insert(l_bank.txns.end(), x_txn);
+    l_entry.rowPos = l_row.insert(l_row.end(), x_txn);
+    m_entries[x_txn] = l_entry;
+
+    m_bankBitmap[l_bankId / 64] |= (uint64_t) 1 << (l_bankId % 64);
+    m_addrTxns[x_txn->getAddress()].push_back(x_txn);
+}
+
+void c_TxnQueueIndex::pop(c_Transaction* x_txn)
+{
+    auto l_entryItr = m_entries.find(x_txn);
+    assert(l_entryItr != m_entries.end());
+
+    const c_HashedAddress& l_addr = x_txn->getHashedAddress();
+    unsigned l_bankId = l_addr.getBankId();
+    Bank& l_bank = m_banks[l_bankId];
+
+    auto l_rowItr = l_bank.rows.find(l_addr.getRow());
+    l_rowItr->second.erase(l_entryItr->second.rowPos);
+    if (l_rowItr->second.empty())
+        l_bank.rows.erase(l_rowItr);
+
+    l_bank.txns.erase(l_entryItr->second.bankPos);
+    if (l_bank.txns.empty())
+        m_bankBitmap[l_bankId / 64] &= ~((uint64_t) 1 << (l_bankId % 64));
+
+    m_queue->erase(l_entryItr->second.queuePos);
+    m_entries.erase(l_entryItr);
+
+    auto l_addrItr = m_addrTxns.find(x_txn->getAddress());
+    std::vector<c_Transaction*>& l_addrTxns = l_addrItr->second;
+    l_addrTxns.erase(std::find(l_addrTxns.begin(), l_addrTxns.end(), x_txn));
+    if (l_addrTxns.empty())
+        m_addrTxns.erase(l_addrItr);
+}
+
+unsigned c_TxnQueueIndex::nextBank(unsigned x_bank) const
+{
+    size_t l_word = x_bank / 64;
+    if (l_word >= m_bankBitmap.size())
+        return NO_BANK;
+
+    uint64_t l_bits = m_bankBitmap[l_word] & (~(uint64_t) 0 << (x_bank % 64));
+    while (l_bits == 0) {
+        if (++l_word == m_bankBitmap.size())
+            return NO_BANK;
+        l_bits = m_bankBitmap[l_word];
+    }
+
+    return l_word * 64 + __builtin_ctzll(l_bits);
+}
+
+const TxnQueue* c_TxnQueueIndex::getRowTxns(unsigned x_bank, unsigned x_row) const
+{
+    auto l_rowItr = m_banks[x_bank].rows.find(x_row);
+    return l_rowItr == m_banks[x_bank].rows.end() ? nullptr : &l_rowItr->second;
+}
+
+bool c_TxnQueueIndex::hasOlder(const c_Transaction* x_txn) const
+{
+    auto l_addrItr = m_addrTxns.find(x_txn->getAddress());
+    if (l_addrItr == m_addrTxns.end())
+        return false;
+
+    for (auto &l_txn : l_addrItr->second) {
+        if (l_txn->getSeqNum() < x_txn->getSeqNum())
+            return true;
+    }
+    return false;
+}
+
+bool c_TxnQueueIndex::hasWrite(ulong x_addr) const
+{
+    auto l_addrItr = m_addrTxns.find(x_addr);
+    if (l_addrItr == m_addrTxns.end())
+        return false;
+
+    for (auto &l_txn : l_addrItr->second) {
+        if (l_txn->isWrite())
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,92 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef C_TXNQUEUEINDEX_HPP
+#define C_TXNQUEUEINDEX_HPP
+
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "c_Transaction.hpp"
+
+namespace SST {
+    namespace CramSim {
+
+        typedef std::list<c_Transaction*> TxnQueue;
+
+        // Index over a transaction queue for bank-aware scheduling.
+        //
+        // Pending transactions are binned per bank and, within a bank, per
+        // row, each bin in queue order. A bitmap marks the banks that have
+        // pending transactions, so the scheduler can look at each occupied
+        // bank once instead of walking the whole queue. Transactions are
+        // also binned per address for the read-after-write checks.
+        //
+        // The index owns the updates to the queue it is built on, every
+        // push and pop has to go through it.
+        class c_TxnQueueIndex {
+        public:
+            static const unsigned NO_BANK = UINT32_MAX;
+
+            c_TxnQueueIndex(TxnQueue* x_queue);
+
+            void push(c_Transaction* x_txn);
+            void pop(c_Transaction* x_txn);
+
+            // first bank with pending transactions at or after x_bank,
+            // NO_BANK if there is none
+            unsigned nextBank(unsigned x_bank) const;
+
+            // pending transactions in a bank and in one of its rows, in
+            // queue order
+            const TxnQueue& getBankTxns(unsigned x_bank) const { return m_banks[x_bank].txns; }
+            const TxnQueue* getRowTxns(unsigned x_bank, unsigned x_row) const;
+
+            // position of a pending transaction in the queue, smaller is older
+            uint64_t getOrder(c_Transaction* x_txn) const { return m_entries.at(x_txn).order; }
+
+            // true if a transaction to the same address with a smaller
+            // sequence number is pending
+            bool hasOlder(const c_Transaction* x_txn) const;
+            // true if a write to x_addr is pending
+            bool hasWrite(ulong x_addr) const;
+
+        private:
+            struct Entry {
+                uint64_t order;
+                TxnQueue::iterator queuePos;
+                TxnQueue::iterator bankPos;
+                TxnQueue::iterator rowPos;
+            };
+
+            struct Bank {
+                TxnQueue txns;
+                std::unordered_map<unsigned, TxnQueue> rows;
+            };
+
+            TxnQueue* m_queue;
+            uint64_t m_nextOrder;
+
+            std::unordered_map<c_Transaction*, Entry> m_entries;
+            std::vector<Bank> m_banks;
+            std::vector<uint64_t> m_bankBitmap;
+            std::unordered_map<ulong, std::vector<c_Transaction*>> m_addrTxns;
+        };
+    }
+}
+
+#endif //C_TXNQUEUEINDEX_HPP
@@ -114,10 +114,25 @@ void c_TxnScheduler::build(Params& x_params) {
         m_minNumPendingWrite = (unsigned) ((float) k_numTxnQEntries * k_minPendingWriteThreshold);
         m_flushWriteQueue = false;
     }
+
+    k_isBankIndexedScheduling = (unsigned) x_params.find<unsigned>("boolBankIndexedScheduling", 0, l_found);
+    if (k_isBankIndexedScheduling) {
+        for (unsigned l_ch = 0; l_ch < m_txnQ.size(); l_ch++)
+            m_txnIndex.push_back(new c_TxnQueueIndex(&m_txnQ[l_ch]));
+        for (unsigned l_ch = 0; l_ch < m_txnReadQ.size(); l_ch++) {
+            m_txnReadIndex.push_back(new c_TxnQueueIndex(&m_txnReadQ[l_ch]));
+            m_txnWriteIndex.push_back(new c_TxnQueueIndex(&m_txnWriteQ[l_ch]));
+        }
+    }
 }
 
 c_TxnScheduler::~c_TxnScheduler() {
-
+    for (auto &l_index : m_txnIndex)
+        delete l_index;
+    for (auto &l_index : m_txnReadIndex)
+        delete l_index;
+    for (auto &l_index : m_txnWriteIndex)
+        delete l_index;
 }
 
 
@@ -196,6 +211,9 @@ c_Transaction* c_TxnScheduler::getNextTxn(TxnQueue& x_queue, int x_ch)
                     l_nxtTxn = x_queue.front();
             }
         }//FRFCFS
+        else if(k_txnSchedulingPolicy == e_txnSchedulingPolicy::FRFCFS && k_isBankIndexedScheduling) {
+            l_nxtTxn = getNextTxnIndexed(getIndex(x_queue, x_ch), x_ch);
+        }
         else if(k_txnSchedulingPolicy == e_txnSchedulingPolicy::FRFCFS) {
             for (auto &l_txn: x_queue) {
                 if (m_cmdScheduler->getToken(l_txn->getHashedAddress()) >= 3) {
@@ -222,9 +240,87 @@ c_Transaction* c_TxnScheduler::getNextTxn(TxnQueue& x_queue, int x_ch)
 }
 
 
+// Same choice as the FRFCFS queue walk in getNextTxn: the oldest issuable
+// row hit or, if there is no row hit, the youngest issuable transaction.
+// Every transaction in a bank has the same token count and open row, so
+// each occupied bank is only looked at once.
+c_Transaction* c_TxnScheduler::getNextTxnIndexed(c_TxnQueueIndex* x_index, int x_ch)
+{
+    c_Transaction* l_hitTxn = nullptr;
+    c_Transaction* l_lastTxn = nullptr;
+    uint64_t l_hitOrder = 0;
+    uint64_t l_lastOrder = 0;
+
+    for (unsigned l_bankId = x_index->nextBank(0); l_bankId != c_TxnQueueIndex::NO_BANK;
+         l_bankId = x_index->nextBank(l_bankId + 1)) {
+        const TxnQueue& l_bankTxns = x_index->getBankTxns(l_bankId);
+
+        if (m_cmdScheduler->getToken(l_bankTxns.front()->getHashedAddress()) < 3)
+            continue;
+
+        // youngest issuable transaction in the bank
+        for (TxnQueue::const_reverse_iterator l_txnItr = l_bankTxns.rbegin(); l_txnItr != l_bankTxns.rend(); ++l_txnItr) {
+            if (hasDependancy(*l_txnItr, x_ch) == false) {
+                uint64_t l_order = x_index->getOrder(*l_txnItr);
+                if (l_lastTxn == nullptr || l_order > l_lastOrder) {
+                    l_lastTxn = *l_txnItr;
+                    l_lastOrder = l_order;
+                }
+                break;
+            }
+        }
+
+        // oldest issuable row hit in the bank
+        c_BankInfo *l_bankInfo = m_txnConverter->getBankInfo(l_bankId);
+        if (!l_bankInfo->isRowOpen())
+            continue;
+
+        const TxnQueue* l_rowTxns = x_index->getRowTxns(l_bankId, l_bankInfo->getOpenRowNum());
+        if (l_rowTxns == nullptr)
+            continue;
+
+        for (auto &l_txn : *l_rowTxns) {
+            if (hasDependancy(l_txn, x_ch) == false) {
+                uint64_t l_order = x_index->getOrder(l_txn);
+                if (l_hitTxn == nullptr || l_order < l_hitOrder) {
+                    l_hitTxn = l_txn;
+                    l_hitOrder = l_order;
+                }
+                break;
+            }
+        }
+    }
+
+    return l_hitTxn != nullptr ? l_hitTxn : l_lastTxn;
+}
+
+
+c_TxnQueueIndex* c_TxnScheduler::getIndex(TxnQueue& x_queue, int x_ch)
+{
+    if (!k_isReadFirstScheduling)
+        return m_txnIndex[x_ch];
+    else if (&x_queue == &m_txnReadQ[x_ch])
+        return m_txnReadIndex[x_ch];
+    else
+        return m_txnWriteIndex[x_ch];
+}
+
+
 void c_TxnScheduler::popTxn(TxnQueue &x_txnQ, c_Transaction* x_Txn)
 {
-    x_txnQ.remove(x_Txn);
+    if (k_isBankIndexedScheduling)
+        getIndex(x_txnQ, x_Txn->getHashedAddress().getChannel())->pop(x_Txn);
+    else
+        x_txnQ.remove(x_Txn);
+}
+
+
+void c_TxnScheduler::pushTxn(TxnQueue& x_queue, int x_ch, c_Transaction* x_txn)
+{
+    if (k_isBankIndexedScheduling)
+        getIndex(x_queue, x_ch)->push(x_txn);
+    else
+        x_queue.push_back(x_txn);
 }
 
 bool c_TxnScheduler::push(c_Transaction* newTxn)
@@ -234,7 +330,7 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
     if(!k_isReadFirstScheduling)
     {
         if (m_txnQ.at(l_channelId).size() < k_numTxnQEntries) {
-            m_txnQ.at(l_channelId).push_back(newTxn);
+            pushTxn(m_txnQ.at(l_channelId), l_channelId, newTxn);
             l_success=true;
         } else
             l_success=false;
@@ -243,7 +339,7 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
         if(newTxn->isRead())
         {
             if(m_txnReadQ[l_channelId].size()< k_numTxnQEntries) {
-                m_txnReadQ[l_channelId].push_back(newTxn);
+                pushTxn(m_txnReadQ[l_channelId], l_channelId, newTxn);
                 l_success = true;
             }
             else
@@ -252,7 +348,7 @@ bool c_TxnScheduler::push(c_Transaction* newTxn)
         {
             if(m_txnWriteQ[l_channelId].size()< k_numTxnQEntries) {
                 l_success=true;
-                m_txnWriteQ[l_channelId].push_back(newTxn);
+                pushTxn(m_txnWriteQ[l_channelId], l_channelId, newTxn);
             }else
                 l_success=false;
         }
@@ -278,6 +374,9 @@ bool c_TxnScheduler::isHit(c_Transaction* x_txn)
             l_queue = &m_txnWriteQ.at(l_channelId);
         }
 
+        if (k_isBankIndexedScheduling)
+            return getIndex(*l_queue, l_channelId)->hasWrite(x_txn->getAddress());
+
         //traverse the transaction queue in reverse order
         for (TxnQueue::reverse_iterator l_txnItr = l_queue->rbegin(); l_txnItr != l_queue->rend(); ++l_txnItr) {
             c_Transaction *l_txn = *l_txnItr;
@@ -307,6 +406,9 @@ bool c_TxnScheduler::hasDependancy(c_Transaction *x_txn, int x_ch)
             l_queue= &m_txnReadQ[x_ch];
     }
 
+    if (k_isBankIndexedScheduling)
+        return getIndex(*l_queue, x_ch)->hasOlder(x_txn);
+
     for(auto &l_txn: *l_queue)
     {
         if(l_txn->getAddress()==x_txn->getAddress()
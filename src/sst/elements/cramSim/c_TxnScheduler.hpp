@@ -34,6 +34,7 @@
 #include "c_Transaction.hpp"
 #include "c_TxnConverter.hpp"
 #include "c_Controller.hpp"
+#include "c_TxnQueueIndex.hpp"
 
 
 namespace SST {
@@ -43,7 +44,6 @@ namespace SST {
         class c_Controller;
 
         enum class e_txnSchedulingPolicy {FCFS, FRFCFS};
-        typedef std::list<c_Transaction*> TxnQueue;
 
         class c_TxnScheduler: public SubComponent{
         public:
@@ -65,6 +65,7 @@ namespace SST {
                 {"boolReadFirstTxnScheduling", "", "0"},
                 {"maxPendingWriteThreshold", "", "1.0"},
                 {"minPendingWriteThreshold", "", "0.2"},
+                {"boolBankIndexedScheduling", "Index pending transactions per bank and row instead of walking the queue every cycle (same scheduling decisions)", "0"},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -86,6 +87,9 @@ namespace SST {
             virtual c_Transaction* getNextTxn(TxnQueue& x_queue, int x_ch);
             virtual bool hasDependancy(c_Transaction* x_txn, int x_ch);
             virtual void popTxn(TxnQueue& x_queue, c_Transaction* x_txn);
+            void pushTxn(TxnQueue& x_queue, int x_ch, c_Transaction* x_txn);
+            c_Transaction* getNextTxnIndexed(c_TxnQueueIndex* x_index, int x_ch);
+            c_TxnQueueIndex* getIndex(TxnQueue& x_queue, int x_ch);
 
             //**transaction converter
             c_TxnConverter* m_txnConverter;
@@ -97,6 +101,10 @@ namespace SST {
             //**per-channel tranaction queues for read-first scheduling
             std::vector<TxnQueue> m_txnReadQ;  // read queue for read-first scheduling
             std::vector<TxnQueue> m_txnWriteQ; // write queue for read-first scheduling
+            //**per-bank indexes over the transaction queues for bank-indexed scheduling
+            std::vector<c_TxnQueueIndex*> m_txnIndex;
+            std::vector<c_TxnQueueIndex*> m_txnReadIndex;
+            std::vector<c_TxnQueueIndex*> m_txnWriteIndex;
             unsigned m_maxNumPendingWrite;
             unsigned m_minNumPendingWrite;
 
@@ -111,6 +119,7 @@ namespace SST {
             float k_maxPendingWriteThreshold;
             float k_minPendingWriteThreshold;
             bool k_isReadFirstScheduling;
+            bool k_isBankIndexedScheduling;
 
         };
     }
@@ -0,0 +1,150 @@
+import sst
+import sys
+import time
+################################################################################
+def read_arguments():
+    config_file_list = list()
+    override_list = list()
+    boolDefaultConfig = True;
+
+    for arg in sys.argv:
+        if arg.find("--configfile=") != -1:
+            substrIndex = arg.find("=")+1
+            config_file_list.append(arg[substrIndex:])
+            print("Config file list:", config_file_list)
+            boolDefaultConfig = False;
+
+        elif arg.find("--traceFile=") != -1:  # just remove the -- argument signifier from the beginning
+            substrIndex = arg.find("-")+2
+            override_list.append(arg[substrIndex:])
+            print("Trace file:", arg[substrIndex:])
+
+        elif arg != sys.argv[0]:
+            if arg.find("=") == -1:
+                print("Malformed config override found!: ", arg)
+                exit(-1)
+            override_list.append(arg)
+            print("Override: ", override_list[-1])
+
+
+
+    if boolDefaultConfig == True:
+        config_file_list = "../ddr4_verimem.cfg"
+        print("config file is not specified.. using ddr4_verimem.cfg")
+
+    return [config_file_list, override_list]
+
+
+
+def setup_config_params(config_file_list, override_list):
+    l_params = {}
+    for l_configFileEntry in config_file_list:
+        with open(l_configFileEntry) as l_configFile:
+            for l_line in l_configFile:
+                l_tokens = l_line.split()
+                l_params[l_tokens[0]] = l_tokens[1]
+
+    for override in override_list:
+        l_tokens = override.split("=")
+        print("Override cfg", l_tokens[0], l_tokens[1])
+        l_params[l_tokens[0]] = l_tokens[1]
+
+    return l_params
+
+#######################################################################################################
+
+# Command line arguments
+g_config_file_list = ""
+g_override_list = ""
+
+# Setup global parameters
+[g_config_file_list, g_overrided_list] = read_arguments()
+g_params = setup_config_params(g_config_file_list, g_overrided_list)
+if "dumpConfig" in g_params and int(g_params["dumpConfig"]):
+    print("\n###########################\nDumping global config parameters:")
+    for key in g_params:
+        print(key + " " + g_params[key])
+    print("###########################\n")
+
+numChannels = int(g_params["numChannels"])
+maxOutstandingReqs = numChannels*128
+numTxnPerCycle = numChannels
+maxTxns = 100000 * numChannels
+
+# The dispatcher hashes every address with all the channels and hands it to
+# the controller of its channel, the controllers each model a single channel.
+# boolDispatchByChannel=0 builds the single dispatcher reference instead, with
+# one controller for all the channels behind a one lane dispatcher.
+dispatchByChannel = int(g_params.get("boolDispatchByChannel", 1))
+numLanes = numChannels if dispatchByChannel else 1
+
+g_params["strAddressMapStr"] = "_r_l_R_B_b_C_h_"
+g_laneParams = dict(g_params)
+if dispatchByChannel:
+    g_laneParams["numChannels"] = 1
+
+
+# Define SST core options
+sst.setProgramOption("timebase", g_params["clockCycle"])
+sst.setProgramOption("stop-at", g_params["stopAtCycle"])
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+
+
+#########################################################################################################
+
+## Configure transaction generator and transaction dispatcher
+comp_txnGen = sst.Component("TxnGen", "cramSim.c_TraceFileReader")
+comp_txnGen.addParams(g_params)
+comp_txnGen.addParams({
+    "maxTxns" : maxTxns,
+    "numTxnPerCycle" : numTxnPerCycle,
+    "maxOutstandingReqs" : maxOutstandingReqs
+    })
+comp_txnGen.enableAllStatistics()
+
+comp_txnDispatcher = sst.Component("txnDispatcher", "cramSim.c_TxnDispatcher")
+comp_txnDispatcher.addParams(g_params)
+comp_txnDispatcher.addParams({
+    "numLanes" : numLanes,
+    "boolDispatchByChannel" : dispatchByChannel
+    })
+if dispatchByChannel:
+    d0 = comp_txnDispatcher.setSubComponent("AddrMapper", "cramSim.c_AddressHasher")
+    d0.addParams(g_params)
+
+txnGenLink = sst.Link("txnGenLink")
+txnGenLink.connect((comp_txnGen, "memLink", g_params["clockCycle"]), (comp_txnDispatcher, "txnGen", g_params["clockCycle"]))
+
+
+# Configure controller and device
+for chid in range(numLanes):
+
+    # controller
+    comp_controller = sst.Component("MemController"+str(chid), "cramSim.c_Controller")
+    comp_controller.addParams(g_laneParams)
+    c0 = comp_controller.setSubComponent("TxnScheduler", "cramSim.c_TxnScheduler")
+    c1 = comp_controller.setSubComponent("TxnConverter", "cramSim.c_TxnConverter")
+    c2 = comp_controller.setSubComponent("AddrMapper", "cramSim.c_AddressHasher")
+    c3 = comp_controller.setSubComponent("CmdScheduler", "cramSim.c_CmdScheduler")
+    c4 = comp_controller.setSubComponent("DeviceDriver", "cramSim.c_DeviceDriver")
+    c0.addParams(g_laneParams)
+    c1.addParams(g_laneParams)
+    c2.addParams(g_laneParams)
+    c3.addParams(g_laneParams)
+    c4.addParams(g_laneParams)
+
+    # device
+    comp_dimm = sst.Component("Dimm"+str(chid), "cramSim.c_Dimm")
+    comp_dimm.addParams(g_laneParams)
+
+    # Dispatcher <-> Controller (Txn)
+    txnReqLink_0 = sst.Link("txnReqLink_0_"+str(chid))
+    txnReqLink_0.connect((comp_txnDispatcher, "lane_"+str(chid), g_params["clockCycle"]), (comp_controller, "txngenLink", g_params["clockCycle"]) )
+
+    # Controller <-> Dimm
+    cmdReqLink_1 = sst.Link("cmdReqLink_1_"+str(chid))
+    cmdReqLink_1.connect( (comp_controller, "memLink", g_params["clockCycle"]), (comp_dimm, "ctrlLink", g_params["clockCycle"]) )
+
+    # enable all statistics
+    comp_controller.enableAllStatistics()
@@ -72,6 +72,34 @@ class testcase_cramSim_Component(SSTTestCase):
     def test_cramSim_6_W(self):
         self.cramSim_test_template("6_W")
 
+    # Bank indexed FR-FCFS has to pick the same transactions as the queue
+    # walk, so both runs must produce the same output
+    def test_cramSim_frfcfs_bank_indexed_1_RW(self):
+        self.cramSim_bank_indexed_template("1_RW")
+
+    def test_cramSim_frfcfs_bank_indexed_4_R(self):
+        self.cramSim_bank_indexed_template("4_R")
+
+    def test_cramSim_frfcfs_bank_indexed_6_W(self):
+        self.cramSim_bank_indexed_template("6_W")
+
+    # One single channel controller per channel behind the dispatcher.  With
+    # one channel, routing by channel must not change anything, so the run is
+    # checked against the single dispatcher reference.  With more channels the
+    # reference controller shares its request queue and command bus state
+    # between the channels, so those runs only have to complete.
+    def test_cramSim_perchannel_1ch_1_RW(self):
+        self.cramSim_perchannel_template("1_RW", 1)
+
+    def test_cramSim_perchannel_1ch_4_R(self):
+        self.cramSim_perchannel_template("4_R", 1)
+
+    def test_cramSim_perchannel_1_RW(self):
+        self.cramSim_perchannel_template("1_RW", 2)
+
+    def test_cramSim_perchannel_4_R(self):
+        self.cramSim_perchannel_template("4_R", 4)
+
 #####
 
     def cramSim_test_template(self, testcase):
@@ -129,6 +157,88 @@ class testcase_cramSim_Component(SSTTestCase):
         else:
             self.assertTrue(cmp_result, "Output file {0} does not match Reference File {1}".format(outfile, reffile))
 
+    def cramSim_bank_indexed_template(self, testcase):
+
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_cramSim_frfcfs_bank_indexed_{0}".format(testcase)
+
+        sdlfile    = "{0}/test_txntrace.py".format(self.testcramSimTestsDir)
+        tracefile  = "{0}/sst-CramSim-trace_verimem_{1}.trc".format(self.testcramSimTestsDir, testcase)
+        configfile = "{0}/ddr4_2400.cfg".format(self.testcramSimDir)
+
+        outfiles = []
+        for indexed in [0, 1]:
+            runFileName = "{0}_{1}".format(testDataFileName, indexed)
+            outfile = "{0}/{1}.out".format(outdir, runFileName)
+            errfile = "{0}/{1}.err".format(outdir, runFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
+            otherargs = '--model-options=\"--configfile={0} --traceFile={1} boolBankIndexedScheduling={2}\"'.format(configfile, tracefile, indexed)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("cramSim test {0} has a Non-Empty Error File {1}".format(runFileName, errfile))
+
+            cmd = 'grep -q "Simulation is complete" {0} '.format(outfile)
+            grep_result = os.system(cmd) == 0
+            self.assertTrue(grep_result, "Output file {0} does not contain a simulation complete message".format(outfile))
+            outfiles.append(outfile)
+
+        # The runs only differ in the echoed override
+        cmp_result = testing_compare_filtered_diff(testDataFileName, outfiles[1], outfiles[0], filters=[StartsWithFilter("Override")])
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testDataFileName)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Bank indexed output file {0} does not match queue walk output file {1}".format(outfiles[1], outfiles[0]))
+
+    def cramSim_perchannel_template(self, testcase, num_channels):
+
+        # Get the path to the test files
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        # Set the various file paths
+        testDataFileName="test_cramSim_perchannel_{0}ch_{1}".format(num_channels, testcase)
+
+        sdlfile    = "{0}/test_txntrace_perchannel.py".format(self.testcramSimTestsDir)
+        tracefile  = "{0}/sst-CramSim-trace_verimem_{1}.trc".format(self.testcramSimTestsDir, testcase)
+        configfile = "{0}/ddr4_2400.cfg".format(self.testcramSimDir)
+
+        # The single dispatcher reference is only run when it has to match
+        dispatch_modes = [1, 0] if num_channels == 1 else [1]
+
+        outfiles = []
+        for by_channel in dispatch_modes:
+            runFileName = "{0}_{1}".format(testDataFileName, by_channel)
+            outfile = "{0}/{1}.out".format(outdir, runFileName)
+            errfile = "{0}/{1}.err".format(outdir, runFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
+            otherargs = '--model-options=\"--configfile={0} --traceFile={1} numChannels={2} boolDispatchByChannel={3}\"'.format(configfile, tracefile, num_channels, by_channel)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+            if os_test_file(errfile, "-s"):
+                log_testing_note("cramSim test {0} has a Non-Empty Error File {1}".format(runFileName, errfile))
+
+            cmd = 'grep -q "Simulation is complete" {0} '.format(outfile)
+            grep_result = os.system(cmd) == 0
+            self.assertTrue(grep_result, "Output file {0} does not contain a simulation complete message".format(outfile))
+            outfiles.append(outfile)
+
+        if len(outfiles) < 2:
+            return
+
+        # The runs only differ in the echoed override
+        cmp_result = testing_compare_filtered_diff(testDataFileName, outfiles[0], outfiles[1], filters=[StartsWithFilter("Override")])
+        if not cmp_result:
+            diffdata = testing_get_diff_data(testDataFileName)
+            log_failure(diffdata)
+        self.assertTrue(cmp_result, "Per-channel output file {0} does not match single dispatcher output file {1}".format(outfiles[0], outfiles[1]))
+
 #####
 
     def _setupcramSimTestFiles(self):
@@ -153,8 +263,9 @@ class testcase_cramSim_Component(SSTTestCase):
         os.makedirs(self.testcramSimDir)
         os.makedirs(self.testcramSimTestsDir)
 
-        # Create a simlink of the ddr4_verimem.cfg file
+        # Create a simlink of the ddr4_verimem.cfg and ddr4_2400.cfg files
         os_symlink_file(self.cramSimElementDir, self.testcramSimDir, "ddr4_verimem.cfg")
+        os_symlink_file(self.cramSimElementDir, self.testcramSimDir, "ddr4_2400.cfg")
 
         # Create a simlink of each file in the cramSim/Tests directory
         for f in os.listdir(self.cramSimElementTestsDir):
@@ -21,6 +21,7 @@
 #include <sst/core/statapi/statbase.h>
 #include <sst/elements/hermes/msgapi.h>
 #include <sst/elements/hermes/shmemapi.h>
+#include <sst/elements/sizeClassPool.h>
 
 namespace SST {
 namespace Ember {
@@ -61,6 +62,10 @@ public:
         m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0), m_retvalPtr(NULL) {}
 	~EmberEvent() {}
 
+    // events of every subclass are recycled through the pool
+    static void* operator new( size_t size ) { return SizeClassPool::allocate( size ); }
+    static void operator delete( void* ptr, size_t size ) { SizeClassPool::release( ptr, size ); }
+
 	virtual std::string getName() { return "?????"; };
 
     State state() { return m_state; }
@@ -75,6 +75,13 @@ class EmberGenerator : public SubComponent {
         assert(0);
     }
 
+    // Called by the engine whenever its event queue has drained.  Returns
+    // true once the motif is done.  The engine issues the queued events
+    // one at a time and calls generate() again, without any simulated
+    // time passing, as soon as the queue is empty.  A motif that would
+    // enqueue a number of events proportional to the job size can
+    // therefore enqueue them in bounded batches and return false until
+    // the last batch, keeping memory proportional to the batch size.
     virtual bool generate( std::queue<EmberEvent*>& evQ ) {
         assert(0);
     }
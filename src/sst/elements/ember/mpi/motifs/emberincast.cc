@@ -21,10 +21,15 @@ using namespace SST::Ember;
 
 #define TAG 0x10101
 
+// Number of irecvs the incast target enqueues per call to generate()
+#define RECV_BATCH 64
+
 EmberIncastGenerator::EmberIncastGenerator(SST::ComponentId_t id, Params& params ) :
 	EmberMessagePassingGenerator(id, params, "Incast"),
 	m_currentItr(0),
-	m_incastTarget(0)
+	m_incastTarget(0),
+	m_nextSrc(0),
+	m_nextIndex(0)
 {
 	m_messageSize = (uint32_t) params.find("arg.messageSize", 1024);
 	m_iterations = (uint32_t) params.find("arg.iterations", 1);
@@ -45,15 +50,25 @@ bool EmberIncastGenerator::generate( std::queue<EmberEvent*>& evQ)
 		return true;
 	} else {
 		if( rank() == m_incastTarget ) {
-			int next_index = 0;
+			// The irecvs are posted a batch at a time; the engine calls
+			// generate() again as soon as the batch has been issued
+			int posted = 0;
 
-			for( int i = 0; i < size(); ++i ) {
-				if( rank() != i ) {
-					enQ_irecv( evQ, &m_recvBuf[next_index * m_messageSize], m_messageSize, CHAR, i,
-                                               	TAG, GroupWorld, &m_req[next_index] );
-					next_index++;
+			while( m_nextSrc < size() && posted < RECV_BATCH ) {
+				if( rank() != m_nextSrc ) {
+					enQ_irecv( evQ, &m_recvBuf[m_nextIndex * m_messageSize], m_messageSize, CHAR, m_nextSrc,
+                                               	TAG, GroupWorld, &m_req[m_nextIndex] );
+					m_nextIndex++;
+					posted++;
 				}
+				m_nextSrc++;
+			}
+
+			if( m_nextSrc < size() ) {
+				return false;
 			}
+			m_nextSrc = 0;
+			m_nextIndex = 0;
 
 			verbose(CALL_INFO, 1, 0, "Incast target (rank=%d) is posting wait-all for %d irecv messages.\n", rank(), size() - 1);
 			enQ_waitall( evQ, size() - 1, m_req, NULL );
@@ -77,6 +77,10 @@ private:
     	uint32_t 	  m_currentItr;
 
     	int      	  m_incastTarget;
+
+	// Progress of the irecv batches in the current iteration
+	int      	  m_nextSrc;
+	int      	  m_nextIndex;
 };
 
 }
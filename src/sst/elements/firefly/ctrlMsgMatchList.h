@@ -0,0 +1,228 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_CTRL_MSG_MATCH_LIST_H
+#define COMPONENTS_FIREFLY_CTRL_MSG_MATCH_LIST_H
+
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "ctrlMsg.h"
+#include "ctrlMsgCommReq.h"
+
+namespace SST {
+namespace Firefly {
+namespace CtrlMsg {
+
+// Posted receive queue with hashed matching.
+//
+// Receives that name a source and a tag are binned on (group,rank,tag),
+// everything else (AnySrc, AnyTag, ignore bits) goes on a wildcard list.
+// Each receive gets a sequence number when it is posted; a message
+// matches the lowest numbered receive that accepts it, which is the
+// same receive a linear scan of the queue in posting order would find.
+//
+// The linear scan is also the cost model.  match() reports the position
+// of the receive in posting order (or the queue size if nothing
+// matched) as the number of entries searched, so the simulated matching
+// delay is unchanged.  The position is kept with a Fenwick tree over
+// the sequence numbers.
+class PostedRecvList {
+
+    struct Entry {
+        uint64_t  seq;
+        _CommReq* req;
+    };
+
+    struct Key {
+        MP::Communicator group;
+        MP::RankID       rank;
+        uint64_t         tag;
+        bool operator==( const Key& other ) const {
+            return group == other.group && rank == other.rank && tag == other.tag;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()( const Key& key ) const {
+            uint64_t h = key.tag * 0x9e3779b97f4a7c15ULL;
+            h ^= ( (uint64_t) key.rank << 32 | key.group ) + 0x7f4a7c159e3779b9ULL + ( h << 6 ) + ( h >> 2 );
+            return h;
+        }
+    };
+
+  public:
+    PostedRecvList() : m_size(0), m_base(0), m_nextSeq(0) {
+        m_tree.resize( minCapacity + 1, 0 );
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    void push_back( _CommReq* req ) {
+        if ( m_nextSeq - m_base >= m_tree.size() - 1 ) {
+            compact();
+        }
+        Entry entry = { m_nextSeq++, req };
+        if ( isWild( req ) ) {
+            m_wild.push_back( entry );
+        } else {
+            m_bins[ key( req->hdr() ) ].push_back( entry );
+        }
+        treeAdd( entry.seq, 1 );
+        ++m_size;
+    }
+
+    // Removes and returns the first posted receive, in posting order,
+    // for which check( hdr, req ) is true.  count is incremented by the
+    // number of entries a linear scan would have examined.
+    template< class CheckFunc >
+    _CommReq* match( MatchHdr& hdr, int& count, CheckFunc check ) {
+        std::deque<Entry>* binList = NULL;
+        std::deque<Entry>::iterator binIter;
+        auto bin = m_bins.find( key( hdr ) );
+        if ( bin != m_bins.end() ) {
+            binList = &bin->second;
+            binIter = findFirst( *binList, hdr, check );
+            if ( binIter == binList->end() ) binList = NULL;
+        }
+
+        std::deque<Entry>::iterator wildIter = findFirst( m_wild, hdr, check );
+
+        std::deque<Entry>* list;
+        std::deque<Entry>::iterator iter;
+        if ( binList && ( wildIter == m_wild.end() || binIter->seq < wildIter->seq ) ) {
+            list = binList;
+            iter = binIter;
+        } else if ( wildIter != m_wild.end() ) {
+            list = &m_wild;
+            iter = wildIter;
+        } else {
+            count += m_size;
+            return NULL;
+        }
+
+        _CommReq* req = iter->req;
+        count += treeSum( iter->seq );
+        erase( list, iter );
+        if ( binList && binList->empty() ) {
+            m_bins.erase( bin );
+        }
+        return req;
+    }
+
+    // Removes req if it is posted.  Returns true if it was found.
+    bool remove( _CommReq* req ) {
+        if ( isWild( req ) ) {
+            return removeFrom( m_wild, req );
+        }
+        auto bin = m_bins.find( key( req->hdr() ) );
+        if ( bin == m_bins.end() ) return false;
+        bool found = removeFrom( bin->second, req );
+        if ( bin->second.empty() ) {
+            m_bins.erase( bin );
+        }
+        return found;
+    }
+
+  private:
+    static constexpr size_t minCapacity = 1024;
+
+    static bool isWild( _CommReq* req ) {
+        return req->ignore() != 0 || req->hdr().tag == AnyTag ||
+                    req->hdr().rank == MP::AnySrc;
+    }
+
+    static Key key( MatchHdr& hdr ) {
+        Key k = { hdr.group, hdr.rank, hdr.tag };
+        return k;
+    }
+
+    template< class CheckFunc >
+    static std::deque<Entry>::iterator findFirst( std::deque<Entry>& list, MatchHdr& hdr, CheckFunc& check ) {
+        std::deque<Entry>::iterator iter = list.begin();
+        for ( ; iter != list.end(); ++iter ) {
+            if ( check( hdr, iter->req ) ) break;
+        }
+        return iter;
+    }
+
+    bool removeFrom( std::deque<Entry>& list, _CommReq* req ) {
+        for ( std::deque<Entry>::iterator iter = list.begin(); iter != list.end(); ++iter ) {
+            if ( iter->req == req ) {
+                erase( &list, iter );
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void erase( std::deque<Entry>* list, std::deque<Entry>::iterator iter ) {
+        treeAdd( iter->seq, -1 );
+        list->erase( iter );
+        --m_size;
+    }
+
+    // Fenwick tree over seq - m_base, 1 based
+    void treeAdd( uint64_t seq, int value ) {
+        for ( size_t i = seq - m_base + 1; i < m_tree.size(); i += i & -i ) {
+            m_tree[i] += value;
+        }
+    }
+
+    size_t treeSum( uint64_t seq ) const {
+        size_t sum = 0;
+        for ( size_t i = seq - m_base + 1; i > 0; i -= i & -i ) {
+            sum += m_tree[i];
+        }
+        return sum;
+    }
+
+    // Renumbers the posted receives from m_base so the tree only has
+    // to cover the receives that are still posted
+    void compact() {
+        std::vector<Entry*> entries;
+        entries.reserve( m_size );
+        for ( auto& bin : m_bins ) {
+            for ( auto& entry : bin.second ) entries.push_back( &entry );
+        }
+        for ( auto& entry : m_wild ) entries.push_back( &entry );
+
+        std::sort( entries.begin(), entries.end(),
+            []( const Entry* a, const Entry* b ) { return a->seq < b->seq; } );
+
+        m_base = m_nextSeq;
+        m_tree.assign( std::max( minCapacity, 2 * entries.size() ) + 1, 0 );
+        for ( auto entry : entries ) {
+            entry->seq = m_nextSeq++;
+            treeAdd( entry->seq, 1 );
+        }
+    }
+
+    std::unordered_map< Key, std::deque<Entry>, KeyHash > m_bins;
+    std::deque<Entry>   m_wild;
+    std::vector<int>    m_tree;
+    size_t              m_size;
+    uint64_t            m_base;
+    uint64_t            m_nextSeq;
+};
+
+}
+}
+}
+
+#endif
@@ -408,15 +408,10 @@ void ProcessQueuesState::processMakeProgress( Stack* stack )
 
 void ProcessQueuesState::enterCancel( MP::MessageRequest req, uint64_t exitDelay ) {
 
-    std::deque< _CommReq* >:: iterator iter = m_pstdRcvQ.begin();
-    for ( ; iter != m_pstdRcvQ.end(); ++iter ) {
-
-		if ( *iter == req ) {
-    		dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",*iter);
-			delete( *iter );
-        	m_pstdRcvQ.erase(iter);
-			break;
-		}
+    _CommReq* _req = static_cast<_CommReq*>( req );
+    if ( m_pstdRcvQ.remove( _req ) ) {
+    	dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",_req);
+		delete( _req );
     }
     enterMakeProgress(m_exitDelay);
 }
@@ -1007,6 +1002,21 @@ _CommReq* ProcessQueuesState::searchPostedRecv( std::deque< _CommReq* >& pstd, M
     return req;
 }
 
+_CommReq* ProcessQueuesState::searchPostedRecv( PostedRecvList& pstd, MatchHdr& hdr, int& count )
+{
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"posted size %lu\n",pstd.size());
+
+    _CommReq* req = pstd.match( hdr, count,
+        [this]( MatchHdr& hdr, _CommReq* posted ) {
+            return checkMatchHdr( hdr, posted->hdr(), posted->ignore() );
+        }
+    );
+
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"req=%p\n",req);
+
+    return req;
+}
+
 bool ProcessQueuesState::checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
                                     uint64_t ignore )
 {
@@ -27,6 +27,7 @@
 #include "loopBack.h"
 
 #include "ctrlMsgCommReq.h"
+#include "ctrlMsgMatchList.h"
 #include "ctrlMsgWaitReq.h"
 
 #define DBG_MSK_PQS_APP_SIDE 1 << 0
@@ -386,6 +387,7 @@ class ProcessQueuesState : public SubComponent
 
     bool        checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr, uint64_t ignore );
     _CommReq*	searchPostedRecv( std::deque< _CommReq* >& pstd, MatchHdr& hdr, int& delay );
+    _CommReq*	searchPostedRecv( PostedRecvList& pstd, MatchHdr& hdr, int& delay );
 
     void exit( int delay = 0 ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"exit ProcessQueuesState\n");
@@ -486,7 +488,7 @@ class ProcessQueuesState : public SubComponent
     int     m_numRecvLooped;
     bool    m_missedInt;
 
-    std::deque< _CommReq* >         m_pstdRcvQ;
+    PostedRecvList                  m_pstdRcvQ;
     std::deque< _CommReq* >         m_pstdRcvPreQ;
     std::vector<std::deque< Msg* >> m_recvdMsgQ;
 	int m_recvdMsgQpos;
@@ -17,6 +17,9 @@
 #define CACHEARRAY_H
 
 #include <vector>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 #include <sst/core/output.h>
 
@@ -51,7 +54,15 @@ class CacheArray {
         unsigned int    banks_;
         vector<T*>      lines_; // The actual cache
         State* setStates;
-        std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+
+        /* Optional contiguous tag store. tags_ mirrors each line's address, indexed like lines_,
+         * so that a set's tags sit next to each other in memory and can be compared without
+         * dereferencing the line objects. Unallocated ways hold NO_ADDR. */
+        bool            contiguous_tags_;
+        vector<Addr>    tags_;
+
+        /** Return the way in the set starting at 'tags' whose tag matches addr, or -1 */
+        int probeTags(const Addr* tags, Addr addr) const;
     public:
 
         CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
@@ -87,6 +98,8 @@ class CacheArray {
 
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
+        void setTagStore(std::string layout);
+        void setSharerIndex(SharerIndex* index);    // Only for line types that track sharers
         void setBanked(unsigned int numBanks);
         void printCacheArray(Output &out);
 
@@ -141,19 +154,17 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
     slice_step_ = 1;
     slice_size_ = 1;
     banks_ = 1;
+    contiguous_tags_ = false;
 
     for (unsigned int i = 0; i < num_lines_; i++) {
         lines_[i] = new T(line_size_, i);
     }
 
-    // Construct rInfo
-    for (unsigned int i = 0; i < num_sets_; i++) {
-        std::vector<ReplacementInfo*> setInfo;
-        for (unsigned int j = 0; j < associativity; j++)
-            setInfo.push_back(lines_[i*associativity + j]->getReplacementInfo());
-        rInfo.insert(std::make_pair(i, setInfo));
-    }
-    ReplacementInfo * info = rInfo.find(0)->second.front();
+    // Bind each line's replacement info to the replacement policy's per-set state
+    for (unsigned int i = 0; i < num_lines_; i++)
+        replacement_mgr_->bindReplacementInfo(lines_[i]->getReplacementInfo());
+
+    ReplacementInfo * info = lines_[0]->getReplacementInfo();
     if (!replacement_mgr_->checkCompatibility(info))
         debug_->fatal(CALL_INFO, -1, "CacheArray, Error: The replacement policy expects cache line state that is not provided by the cache line type of this cache. Check the type of the ReplacementInfo returned by the coherence protocol's line type and the ReplacementInfo type expected by the replacement policy.\n");
 
@@ -182,6 +193,16 @@ T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
     int setBegin = set * associativity_;
     int setEnd = setBegin + associativity_;
 
+    if (contiguous_tags_) {
+        int way = probeTags(&tags_[setBegin], addr);
+        if (way < 0)
+            return nullptr; // Not found
+        int i = setBegin + way;
+        if (updateReplacement)
+            replacement_mgr_->update(i, lines_[i]->getReplacementInfo());
+        return lines_[i];
+    }
+
     for (int i = setBegin; i < setEnd; i++) {
         if (lines_[i]->getAddr() == addr) {
             if (updateReplacement)
@@ -192,12 +213,44 @@ T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
     return nullptr; // Not found
 }
 
+/*
+ * Compare every way of a set against addr without early exit so that the compiler (or the
+ * AVX2 path) can vectorize the comparison. Ways are checked in blocks of 8 and the first
+ * block with a match returns. At most one way in a set can hold a given address.
+ */
+template <class T>
+int CacheArray<T>::probeTags(const Addr* tags, Addr addr) const {
+    unsigned int way = 0;
+#if defined(__AVX2__)
+    const __m256i key = _mm256_set1_epi64x((long long)addr);
+    for (; way + 4 <= associativity_; way += 4) {
+        __m256i cmp = _mm256_cmpeq_epi64(_mm256_loadu_si256((const __m256i*)(tags + way)), key);
+        int mask = _mm256_movemask_pd(_mm256_castsi256_pd(cmp));
+        if (mask)
+            return way + __builtin_ctz(mask);
+    }
+#else
+    for (; way + 8 <= associativity_; way += 8) {
+        uint32_t mask = 0;
+        for (unsigned int j = 0; j < 8; j++)
+            mask |= (uint32_t)(tags[way + j] == addr) << j;
+        if (mask)
+            return way + __builtin_ctz(mask);
+    }
+#endif
+    for (; way < associativity_; way++) {
+        if (tags[way] == addr)
+            return way;
+    }
+    return -1;
+}
+
 template <class T>
 T * CacheArray<T>::findReplacementCandidate(Addr addr) {
     Addr laddr = toLineAddr(addr);
     int set = hash_->hash(0, laddr) % num_sets_;
 
-    unsigned int id = replacement_mgr_->findBestCandidate(rInfo[set]);
+    unsigned int id = replacement_mgr_->findSetCandidate(set);
 
     return lines_[id];
 }
@@ -208,6 +261,8 @@ void CacheArray<T>::replace(Addr addr, T* candidate) {
     replacement_mgr_->replaced(index);
     candidate->reset();
     candidate->setAddr(addr);
+    if (contiguous_tags_)
+        tags_[index] = addr;
     replacement_mgr_->update(index, lines_[index]->getReplacementInfo());
 }
 
@@ -216,6 +271,8 @@ void CacheArray<T>::deallocate(T* candidate) {
     unsigned int index = candidate->getIndex();
     replacement_mgr_->replaced(index);
     candidate->reset();
+    if (contiguous_tags_)
+        tags_[index] = NO_ADDR;
 }
 
 template <class T>
@@ -226,6 +283,33 @@ void CacheArray<T>::setSliceAware(Addr size, Addr step) {
     if (slice_step_ == 0) slice_step_ = 1;
 }
 
+/*
+ * Select how tags are probed on lookup
+ *  pointer:    walk the line objects and compare each line's address
+ *  contiguous: compare against a per-set contiguous tag array (vectorized)
+ */
+template <class T>
+void CacheArray<T>::setTagStore(std::string layout) {
+    to_lower(layout);
+    if (layout == "pointer") {
+        contiguous_tags_ = false;
+        tags_.clear();
+    } else if (layout == "contiguous") {
+        contiguous_tags_ = true;
+        tags_.resize(num_lines_);
+        for (unsigned int i = 0; i < num_lines_; i++)
+            tags_[i] = lines_[i]->getAddr();
+    } else {
+        debug_->fatal(CALL_INFO, -1, "CacheArray, Error: invalid tag store layout '%s'. Options are 'pointer' and 'contiguous'.\n", layout.c_str());
+    }
+}
+
+template <class T>
+void CacheArray<T>::setSharerIndex(SharerIndex* index) {
+    for (unsigned int i = 0; i < num_lines_; i++)
+        lines_[i]->setSharerIndex(index);
+}
+
 template <class T>
 void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
@@ -254,7 +338,8 @@ void CacheArray<T>::serialize_order(SST::Core::Serialization::serializer& ser)
     SST_SER(banks_);
     SST_SER(lines_);
     SST_SER(setStates);
-    SST_SER(rInfo);
+    SST_SER(contiguous_tags_);
+    SST_SER(tags_);
 }
 
 }}
@@ -18,6 +18,8 @@
 #include <sst/core/interfaces/stringEvent.h>
 #include <sst/core/timeLord.h>
 
+#include <algorithm>
+
 #include "cacheController.h"
 #include "memEvent.h"
 #include "mshr.h"
@@ -114,16 +116,18 @@ bool Cache::clockTick(Cycle_t time) {
     // MSHR occupancy
     statMSHROccupancy->addData(mshr_->getSize());
 
-    // Clear bank status to prepare for event handling
-    for (unsigned int bank = 0; bank < bankStatus_.size(); bank++)
-        bankStatus_[bank] = false;
-
+    // Banks are stamped with the cycle of their last access so only the address list needs to be reset
     addrsThisCycle_.clear();
 
+    // Requeue parked events if the MSHR released an entry since they were parked
+    checkParkedEvents();
+
     // Handle events from each of the buffers
     // 1. Retry buffer      -> Events that need to be retried, e.g., were stalled due to a pending action that is now resolved
     // 2. Event buffer      -> Incoming (new) events
     // 3. Prefetch buffer   -> Drop any prefetch that can't be handled immediately
+    // Events that the coherence manager rejects are parked until the MSHR releases an entry
+    // Events that lose bank/line arbitration stay in place and are tried again next cycle
 
     int accepted = 0;
     size_t entries = retryBuffer_.size();
@@ -137,10 +141,15 @@ bool Cache::clockTick(Cycle_t time) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (processEvent(*it, true)) {
+        MemEventStatus status = processEvent(*it, true);
+        if (status == MemEventStatus::OK) {
             accepted++;
             statRetryEvents->addData(1);
             it = retryBuffer_.erase(it);
+        } else if (status == MemEventStatus::Reject) {
+            std::list<MemEventBase*>::iterator next = std::next(it);
+            parkedRetryBuffer_.splice(parkedRetryBuffer_.end(), retryBuffer_, it);
+            it = next;
         } else {
             it++;
         }
@@ -161,11 +170,16 @@ bool Cache::clockTick(Cycle_t time) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (processEvent(*it, false)) {
+        MemEventStatus status = processEvent(*it, false);
+        if (status == MemEventStatus::OK) {
             accepted++;
             statRecvEvents->addData(1);
             it = eventBuffer_.erase(it);
             //printf("DBG: %s, erased <%" PRIu64 ", %d>, it=%d, size=%zu\n", getName().c_str(), id.first, id.second, it == eventBuffer_.end(), eventBuffer_.size());
+        } else if (status == MemEventStatus::Reject) {
+            std::list<MemEventBase*>::iterator next = std::next(it);
+            parkedEventBuffer_.splice(parkedEventBuffer_.end(), eventBuffer_, it);
+            it = next;
         } else {
             it++;
             //printf("DBG: %s, left <%" PRIu64 ", %d>, it=%d, size=%zu\n", getName().c_str(), id.first, id.second, it == eventBuffer_.end(), eventBuffer_.size());
@@ -177,7 +191,7 @@ bool Cache::clockTick(Cycle_t time) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), prefetchBuffer_.front()->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
+        if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false) == MemEventStatus::OK) {
             accepted++;
             // Accepted prefetches are profiled in the coherence manager
 	    prefetchBuffer_.pop();
@@ -195,9 +209,13 @@ bool Cache::clockTick(Cycle_t time) {
     std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
     coherenceMgr_->clearRetryBuffer();
 
+    // Requeue events parked this cycle if an entry was released after they were rejected
+    checkParkedEvents();
+
     idle &= coherenceMgr_->checkIdle();
 
     // Disable lower-level cache clocks if they're idle
+    // Parked events do not keep the clock on; whatever releases the resource they wait on also wakes the cache
     if (eventBuffer_.empty() && retryBuffer_.empty() && idle) {
         turnClockOff();
         return true;
@@ -207,6 +225,23 @@ bool Cache::clockTick(Cycle_t time) {
     return false;
 }
 
+/*
+ * Return parked events to the front of the buffers they came from, preserving order,
+ * if the MSHR has released an entry or a flush has made progress since the last check.
+ * Rejections are due to a full MSHR or an in-progress flush so re-evaluating them
+ * any sooner would only be rejected again.
+ */
+void Cache::checkParkedEvents() {
+    uint64_t releases = mshr_->getReleaseCount();
+    if (releases == parkedReleaseCount_ && !parkedWakeup_)
+        return;
+    parkedReleaseCount_ = releases;
+    parkedWakeup_ = false;
+
+    retryBuffer_.splice(retryBuffer_.begin(), parkedRetryBuffer_);
+    eventBuffer_.splice(eventBuffer_.begin(), parkedEventBuffer_);
+}
+
 void Cache::turnClockOn() {
     if (clockIsOn_) return;
     Cycle_t time = reregisterClock(defaultTimeBase_, clockHandler_);
@@ -237,7 +272,7 @@ void Cache::turnClockOff() {
  *
  *   Returns: whether event was accepted/can be popped off event queue
  */
-bool Cache::processEvent(MemEventBase* ev, bool retry) {
+MemEventStatus Cache::processEvent(MemEventBase* ev, bool retry) {
     // Global noncacheable request flag
     if (allNoncacheableRequests_) {
         ev->setFlag(MemEvent::F_NONCACHEABLE);
@@ -245,7 +280,7 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
 
     if (MemEventTypeArr[(int)ev->getCmd()] != MemEventType::Cache || ev->queryFlag(MemEventBase::F_NONCACHEABLE)) {
         processNoncacheable(ev);
-        return true;
+        return MemEventStatus::OK;
     }
 
     /* Handle cache events */
@@ -262,7 +297,7 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(), CommandString[(int)event->getCmd()],
                     addr, id.str().c_str(), "", "", "Stall", "(bank busy)");
         }
-        return false;
+        return MemEventStatus::Stall;
     }
 
     bool dbgevent = mem_h_is_debug_event(event);
@@ -367,23 +402,38 @@ bool Cache::processEvent(MemEventBase* ev, bool retry) {
     if (dbgevent)
         coherenceMgr_->printDebugInfo();
 
-    if (accepted)
-        updateAccessStatus(addr);
+    if (!accepted)
+        return MemEventStatus::Reject;
+
+    updateAccessStatus(addr);
+
+    /* Flush progress can unblock events that were rejected while the flush was in progress */
+    switch (event->getCmd()) {
+        case Command::FlushAll:
+        case Command::FlushAllResp:
+        case Command::ForwardFlush:
+        case Command::AckFlush:
+        case Command::UnblockFlush:
+            parkedWakeup_ = true;
+            break;
+        default:
+            break;
+    }
 
-    return accepted;
+    return MemEventStatus::OK;
 }
 
 /* Arbitrate for access. Return whether successful */
 bool Cache::arbitrateAccess(Addr addr) {
     if (!banked_) {
-        if (addrsThisCycle_.find(addr) == addrsThisCycle_.end()) {
+        if (std::find(addrsThisCycle_.begin(), addrsThisCycle_.end(), addr) == addrsThisCycle_.end()) {
             return true;
         }
         return false;
     }
 
     Addr bank = coherenceMgr_->getBank(addr);
-    if (bankStatus_[bank]) {
+    if (bankStatus_[bank] == timestamp_) {
         statBankConflicts->addData(1);
         return false;
     } else {
@@ -393,10 +443,10 @@ bool Cache::arbitrateAccess(Addr addr) {
 
 /* Block banks that have been accessed */
 void Cache::updateAccessStatus(Addr addr) {
-    addrsThisCycle_.insert(addr);
+    addrsThisCycle_.push_back(addr);
     if (banked_) {
         Addr bank = coherenceMgr_->getBank(addr);
-        bankStatus_[bank] = true;
+        bankStatus_[bank] = timestamp_;
     }
 }
 
@@ -645,6 +695,7 @@ void Cache::printStatus(Output &out) {
     out.output("MemHierarchy::Cache %s\n", getName().c_str());
     out.output("  Clock is %s. Last active cycle: %" PRIu64 "\n", clockIsOn_ ? "on" : "off", timestamp_);
     out.output("  Events in queues: Retry = %zu, Event = %zu, Prefetch = %zu\n", retryBuffer_.size(), eventBuffer_.size(), prefetchBuffer_.size());
+    out.output("  Parked events: Retry = %zu, Event = %zu\n", parkedRetryBuffer_.size(), parkedEventBuffer_.size());
     if (mshr_) {
         out.output("  MSHR Status:\n");
         mshr_->printStatus(out);
@@ -712,6 +763,10 @@ void Cache::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(addrsThisCycle_);
     SST_SER(retryBuffer_);
     SST_SER(eventBuffer_);
+    SST_SER(parkedRetryBuffer_);
+    SST_SER(parkedEventBuffer_);
+    SST_SER(parkedReleaseCount_);
+    SST_SER(parkedWakeup_);
     SST_SER(prefetchBuffer_);
     SST_SER(noncacheableResponseDst_);
 
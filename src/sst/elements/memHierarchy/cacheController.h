@@ -78,6 +78,9 @@ public:
             {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
             {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
+            {"slice_partition",         "(bool) For distributed, shared caches. If true, cache_size, noninclusive_directory_entries, mshr_num_entries, banks, and max_requests_per_cycle "
+                                        "describe the whole shared cache and this slice takes a 1/num_cache_slices share of each. Allows the slices of one large cache to be "
+                                        "instantiated as separate components (e.g., on different threads) from a single parameter set.", "false"},
             {"maxRequestDelay",         "(uint) Set an error timeout if memory requests take longer than this in ns (0: disable)", "0"},
             {"snoop_l1_invalidations",  "(bool) Forward invalidations from L1s to processors. Options: 0[off], 1[on]", "false"},
             {"llsc_block_cycles",       "(uint64_t) Number of cycles to prevent competing access to an LL/LR line. Encourages forward progress", "0"},
@@ -87,6 +90,7 @@ public:
             {"verbose",                 "(uint) Output verbosity for warnings/errors. 0[fatal error only], 1[warnings], 2[full state dump on fatal error]","1"},
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
+            {"tag_store",               "(string) Layout used to probe the tag array on lookups. Simulated behavior is identical for both. Options: pointer[compare each line's address], contiguous[compare a per-set contiguous tag array with a vectorized probe]", "pointer"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
             {"node",			        "(uint) Node number in multinode environment", "0"})
 
@@ -207,6 +211,9 @@ private:
     // Check for deprecated params and warn
     void checkDeprecatedParams(Params &params);
 
+    // Scale shared-cache parameters down to this slice's share
+    void partitionSliceParams(Params &params);
+
     // Create the cache array
     void createCacheArray(Params &params);
 
@@ -242,7 +249,9 @@ private:
     void handlePrefetchEvent(SST::Event *event);
 
     // Process events
-    bool processEvent(MemEventBase * ev, bool inMSHR);
+    // Returns OK if the event was accepted, Stall if it lost bank/line arbitration this cycle,
+    // and Reject if the coherence manager could not take it (e.g., MSHR full, flush in progress)
+    MemEventStatus processEvent(MemEventBase * ev, bool inMSHR);
 
     // Process an incoming event that is not meant for the cache
     void processNoncacheable(MemEventBase* event);
@@ -257,6 +266,9 @@ private:
     void turnClockOn();
     void turnClockOff();
 
+    // Move rejected events back to their buffers once the resource they wait on may be available
+    void checkParkedEvents();
+
     // Trigger timeouts if events sit in MSHR for too long
     void timeoutWakeup(SST::Event * ev);
     void checkTimeout();
@@ -302,10 +314,16 @@ private:
     /** Cache state ************************************************************/
     uint64_t                    timestamp_;
     int                         requestsThisCycle_;
-    std::vector<bool>           bankStatus_;
-    std::set<Addr>              addrsThisCycle_;
+    std::vector<uint64_t>       bankStatus_;        // Timestamp of the last cycle each bank was accessed
+    std::vector<Addr>           addrsThisCycle_;    // At most a few addresses, cleared every cycle without freeing
     std::list<MemEventBase*>    retryBuffer_;
     std::list<MemEventBase*>    eventBuffer_;
+    // Events rejected by the coherence manager wait here instead of being retried every cycle.
+    // They return to the front of their original buffer when the MSHR releases an entry or a flush makes progress.
+    std::list<MemEventBase*>    parkedRetryBuffer_;
+    std::list<MemEventBase*>    parkedEventBuffer_;
+    uint64_t                    parkedReleaseCount_;    // MSHR release count when parked events were last checked
+    bool                        parkedWakeup_;          // A flush event was accepted, parked events should be retried
     std::queue<MemEventBase*>   prefetchBuffer_;
     std::map<SST::Event::id_type, std::string> noncacheableResponseDst_;
 
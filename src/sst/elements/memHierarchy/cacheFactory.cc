@@ -51,12 +51,15 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     /* Pull out parameters that the cache keeps - the rest will be pulled as needed */
     lineSize_ = params.find<uint64_t>("cache_line_size", 64);
 
+    /* Partitioned slice of a larger shared cache, adjust sizes to this slice's share */
+    partitionSliceParams(params);
+
     /* Construct cache structures */
     createCacheArray(params);
 
     /* Banks */
     uint64_t banks = params.find<uint64_t>("banks", 0);
-    bankStatus_.resize(banks, false);
+    bankStatus_.resize(banks, 0);
     banked_ = banks;
 
     /* Create clock, deadlock timeout, etc. */
@@ -82,7 +85,10 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
     if (maxRequestsPerCycle_ == 0) {
         maxRequestsPerCycle_ = -1;  // Simplify compare
     }
+    addrsThisCycle_.reserve(maxRequestsPerCycle_ > 0 ? maxRequestsPerCycle_ + 1 : 16);
     requestsThisCycle_ = 0;
+    parkedReleaseCount_ = 0;
+    parkedWakeup_ = false;
 
     /* Configure links */
     configureLinks(params, defaultTimeBase_); // Must be called after createClock so timeebase is initialized
@@ -159,6 +165,7 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("associativity", params.find<std::string>("associativity", "-1"));
     coherenceParams.insert("lines", params.find<std::string>("lines", "0"));
     coherenceParams.insert("replacement_policy", params.find<std::string>("replacement_policy", "lru"));
+    coherenceParams.insert("tag_store", params.find<std::string>("tag_store", "pointer"));
     coherenceParams.insert("dlines", params.find<std::string>("noninclusive_directory_entries", "0"));
     coherenceParams.insert("dassoc", params.find<std::string>("noninclusive_directory_associativity", "0"));
     coherenceParams.insert("drpolicy", params.find<std::string>("noninclusive_directory_repl", "lru"));
@@ -738,6 +745,79 @@ uint64_t Cache::createMSHR(Params &params, uint64_t accessLatency, bool L1) {
     return mshrLatency;
 }
 
+/*
+ * Divide the parameters that size a shared cache among its slices
+ * Each slice of a round-robin sliced cache indexes its array with the slice bits removed (see CacheArray::toLineAddr)
+ * so a slice with 1/N of the lines sees exactly the sets of the monolithic cache that map to it.
+ */
+void Cache::partitionSliceParams(Params &params) {
+    if (!params.find<bool>("slice_partition", false))
+        return;
+
+    uint64_t slices = params.find<uint64_t>("num_cache_slices", 1);
+    if (slices <= 1)
+        return;
+
+    bool found;
+    std::string sizeStr = params.find<std::string>("cache_size", "", found);
+    if (!found) out_->fatal(CALL_INFO, -1, "%s, Param not specified: cache_size\n", getName().c_str());
+    fixByteUnits(sizeStr);
+
+    uint64_t cacheSize = 0;
+    try {
+        UnitAlgebra ua(sizeStr);
+        if (!ua.hasUnits("B")) {
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param: cache_size - must have units of bytes(B). Ex: '32KiB'. SI units are ok. You specified '%s'.", getName().c_str(), sizeStr.c_str());
+        }
+        cacheSize = ua.getRoundedValue();
+    } catch (UnitAlgebra::UnitAlgebraException& exc) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: Exception occurred while parsing 'cache_size'. '%s'\n", getName().c_str(), exc.what());
+    }
+    if (cacheSize % slices != 0) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: slice_partition - cache_size must be divisible by num_cache_slices. You specified cache_size = '%s', num_cache_slices = %" PRIu64 ".\n",
+                getName().c_str(), sizeStr.c_str(), slices);
+    }
+    params.insert("cache_size", std::to_string(cacheSize / slices) + "B");
+
+    uint64_t dEntries = params.find<uint64_t>("noninclusive_directory_entries", 0);
+    if (dEntries % slices != 0) {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: slice_partition - noninclusive_directory_entries must be divisible by num_cache_slices. You specified noninclusive_directory_entries = %" PRIu64 ", num_cache_slices = %" PRIu64 ".\n",
+                getName().c_str(), dEntries, slices);
+    }
+    if (dEntries != 0)
+        params.insert("noninclusive_directory_entries", std::to_string(dEntries / slices));
+
+    int mshrSize = params.find<int>("mshr_num_entries", -1);
+    if (mshrSize > 0) { // Negative is unlimited
+        if (mshrSize % slices != 0 || mshrSize / slices < 2) {
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: slice_partition - mshr_num_entries must be divisible by num_cache_slices with at least 2 entries per slice. You specified mshr_num_entries = %d, num_cache_slices = %" PRIu64 ".\n",
+                    getName().c_str(), mshrSize, slices);
+        }
+        params.insert("mshr_num_entries", std::to_string(mshrSize / slices));
+    }
+
+    uint64_t banks = params.find<uint64_t>("banks", 0);
+    if (banks != 0) { // 0 is unlimited
+        if (banks % slices != 0) {
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: slice_partition - banks must be divisible by num_cache_slices. You specified banks = %" PRIu64 ", num_cache_slices = %" PRIu64 ".\n",
+                    getName().c_str(), banks, slices);
+        }
+        params.insert("banks", std::to_string(banks / slices));
+    }
+
+    int maxRequests = params.find<int>("max_requests_per_cycle", -1);
+    if (maxRequests > 0) { // 0 or negative is unlimited
+        if (maxRequests % slices != 0) {
+            out_->fatal(CALL_INFO, -1, "%s, Invalid param combo: slice_partition - max_requests_per_cycle must be divisible by num_cache_slices. You specified max_requests_per_cycle = %d, num_cache_slices = %" PRIu64 ".\n",
+                    getName().c_str(), maxRequests, slices);
+        }
+        params.insert("max_requests_per_cycle", std::to_string(maxRequests / slices));
+    }
+
+    out_->verbose(CALL_INFO, 2, 0, "%s: Partitioned slice of a %" PRIu64 "-slice shared cache. Slice cache_size = %s.\n",
+            getName().c_str(), slices, params.find<std::string>("cache_size", "").c_str());
+}
+
 /* Create the cache array */
 void Cache::createCacheArray(Params &params) {
     /* Get parameters and error check */
@@ -46,6 +46,7 @@ Incoherent::Incoherent(SST::ComponentId_t id, Params& params, Params& owner_para
 
     cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
+    cache_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
 
     stat_event_state_[(int)Command::GetS][I] = registerStatistic<uint64_t>("stateEvent_GetS_I");
     stat_event_state_[(int)Command::GetS][E] = registerStatistic<uint64_t>("stateEvent_GetS_E");
@@ -423,7 +424,7 @@ bool Incoherent::handlePutE(MemEvent * event, bool in_mshr) {
         case I:
             status = allocateLine(event, line, in_mshr);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(E);
                 if (send_writeback_ack_)
                     sendWritebackAck(event);
@@ -466,7 +467,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
         case I:
             status = allocateLine(event, line, in_mshr);
             if (status == MemEventStatus::OK) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(M);
                 if (send_writeback_ack_)
                     sendWritebackAck(event);
@@ -476,7 +477,7 @@ bool Incoherent::handlePutM(MemEvent * event, bool in_mshr) {
         case E:
             line->setState(M);
         case M:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (send_writeback_ack_)
                 sendWritebackAck(event);
             cleanUpAfterRequest(event, in_mshr);
@@ -515,7 +516,7 @@ bool Incoherent::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     if (line) {
         line->setState(E);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         // Has to be a local prefetch
         line->setPrefetch(true);
         recordPrefetchLatency(req->getID(), LatType::MISS);
@@ -801,7 +802,7 @@ void Incoherent::doEvict(MemEvent * event, PrivateCacheLine * line) {
     if (state == E || state == M) {
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
         }
 
         event->setEvict(false);
@@ -48,6 +48,7 @@ IncoherentL1::IncoherentL1(ComponentId_t id, Params& params, Params& owner_param
 
     cache_array_ = new CacheArray<L1CacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
+    cache_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
 
     llsc_block_cycles_ = params.find<Cycle_t>("llsc_block_cycles", 0);
 
@@ -292,7 +293,7 @@ bool IncoherentL1::handleGetX(MemEvent* event, bool in_mshr) {
 
             // Handle
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { /* Don't write on a non-atomic SC */
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -528,7 +529,7 @@ bool IncoherentL1::handleGetSResp(MemEvent * event, bool in_mshr) {
         event_debuginfo_.prefill(event->getID(), Command::GetSResp, (local_prefetch ? "-pref" : ""), addr, state);
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(E);
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -579,7 +580,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool in_mshr) {
     request->setMemFlags(event->getMemFlags());
 
     // Set line data
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     if (mem_h_is_debug_addr(line->getAddr()))
         printDataValue(line->getAddr(), line->getData(), true);
 
@@ -592,7 +593,7 @@ bool IncoherentL1::handleGetXResp(MemEvent * event, bool in_mshr) {
     bool success = true;
     if (request->getCmd() == Command::GetX || request->getCmd() == Command::Write) {
         if (!request->isStoreConditional() || line->isAtomic(request->getThreadID())) {
-            line->setData(request->getPayload(), offset);
+            line->setData(request->getPayloadBuffer(), offset);
             if (mem_h_is_debug_addr(line->getAddr()))
                 printDataValue(line->getAddr(), line->getData(), true);
             line->atomicEnd();
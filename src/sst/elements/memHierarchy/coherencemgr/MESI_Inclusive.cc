@@ -69,6 +69,9 @@ MESIInclusive::MESIInclusive(SST::ComponentId_t id, Params& params, Params& owne
     HashFunction * ht = createHashFunction(params);
     cache_array_ = new CacheArray<SharedCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
+    cache_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
+    sharer_index_ = new SharerIndex();
+    cache_array_->setSharerIndex(sharer_index_);
 
     /* Statistics */
     stat_evict_[I] =         registerStatistic<uint64_t>("evict_I");
@@ -1781,7 +1784,7 @@ bool MESIInclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
     }
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(S);
 
     if (mem_h_is_debug_addr(addr))
@@ -1830,7 +1833,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
     switch (state) {
         case IS:
         {
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
 
             if (event->getDirty())  {
                 line->setState(M); // Sometimes get dirty data from a noninclusive cache
@@ -1860,7 +1863,7 @@ bool MESIInclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
             break;
         }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_addr(line->getAddr()))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -2479,7 +2482,7 @@ State MESIInclusive::doEviction(MemEvent * event, SharedCacheLine * line, State
     recordPrefetchResult(line, stat_prefetch_evict_);
 
     if (event->getDirty()) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         if (mem_h_is_debug_addr(event->getBaseAddr())) {
                 printDataValue(event->getBaseAddr(), line->getData(), true);
         }
@@ -2680,7 +2683,7 @@ bool MESIInclusive::invalidateExceptRequestor(MemEvent * event, SharedCacheLine
     uint64_t delivery_time = 0;
     std::string rqstr = event->getSrc();
 
-    for (set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
+    for (auto it = line->getSharers().begin(); it != line->getSharers().end(); ++it) {
         if (*it == rqstr) continue;
 
         delivery_time =  invalidateSharer(*it, event, line, in_mshr);
@@ -2699,7 +2702,7 @@ bool MESIInclusive::invalidateAll(MemEvent * event, SharedCacheLine * line, bool
     } else {
         if (cmd == Command::NULLCMD)
             cmd = Command::Inv;
-        for (std::set<std::string>::iterator it = line->getSharers()->begin(); it != line->getSharers()->end(); it++) {
+        for (auto it = line->getSharers().begin(); it != line->getSharers().end(); ++it) {
             delivery_time = invalidateSharer(*it, event, line, in_mshr, cmd);
         }
         if (delivery_time != 0) {
@@ -2925,7 +2928,7 @@ void MESIInclusive::processCompleteEvent(MemEventInit* event, MemLinkBase* highl
         }
     } else if (event->getCmd() == Command::Write ) {
         SharedCacheLine * line = cache_array_->lookup(event->getAddr(), false);
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         line->setState(M); // Force a writeback of this data
     }
     delete event; // Nothing for now
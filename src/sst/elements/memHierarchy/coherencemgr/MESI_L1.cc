@@ -63,6 +63,7 @@ MESIL1::MESIL1(ComponentId_t id, Params& params, Params& owner_params, bool pref
 
     cache_array_ = new CacheArray<L1CacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
+    cache_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
 
     // Register statistics
     stat_event_state_[(int)Command::GetS][I] =      registerStatistic<uint64_t>("stateEvent_GetS_I");
@@ -442,7 +443,7 @@ bool MESIL1::handleGetX(MemEvent* event, bool in_mshr) {
             }
 
             if (!event->isStoreConditional() || line->isAtomic(event->getThreadID())) { // Don't write on a non-atomic SC
-                line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+                line->setData(event->getPayloadBuffer(), event->getAddr() - event->getBaseAddr());
                 line->atomicEnd();
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
@@ -1243,7 +1244,7 @@ bool MESIL1::handleGetSResp(MemEvent* event, bool in_mshr) {
     request->setMemFlags(event->getMemFlags()); // Copy MemFlags through
 
     // Update line
-    line->setData(event->getPayload(), 0);
+    line->setData(event->getPayloadBuffer(), 0);
     line->setState(S);
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, line->getData(), false);
@@ -1301,7 +1302,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
     switch (state) {
         case IS:
             {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, line->getData(), true);
 
@@ -1322,7 +1323,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
                 break;
             }
         case IM:
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, line->getData(), true);
         case SM:
@@ -1331,7 +1332,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool in_mshr) {
 
                 if (request->getCmd() == Command::Write || request->getCmd() == Command::GetX) {
                     if (!request->isStoreConditional() || line->isAtomic(request->getThreadID())) { // Normal or successful store-conditional
-                        line->setData(request->getPayload(), offset);
+                        line->setData(request->getPayloadBuffer(), offset);
 
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(addr, line->getData(), true);
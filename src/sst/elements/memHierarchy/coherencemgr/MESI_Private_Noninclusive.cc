@@ -54,6 +54,7 @@ MESIPrivNoninclusive::MESIPrivNoninclusive(SST::ComponentId_t id, Params& params
     HashFunction * ht = createHashFunction(params);
     cache_array_ = new CacheArray<PrivateCacheLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     cache_array_->setBanked(params.find<uint64_t>("banks", 0));
+    cache_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
 
     flush_state_ = FlushState::Ready;
     shutdown_flush_counter_ = 0;
@@ -447,7 +448,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                     mshr_->setProfiled(addr);
                 }
             } else if (mshr_->getAcksNeeded(addr) != 0 && event->getEvict()) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 if ((static_cast<MemEvent*>(mshr_->getFrontEvent(addr)))->getCmd() == Command::FetchInvX) {
                     responses_.erase(addr);
@@ -475,7 +476,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                     line->setOwned(false);
                     line->setShared(true);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer(), 0);
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(line->getAddr(), line->getData(), true);
                     }
@@ -496,7 +497,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
                 line->setOwned(false);
                 line->setShared(true);
                 if (event->getDirty()) {
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     line->setState(M_Inv);
@@ -510,7 +511,7 @@ bool MESIPrivNoninclusive::handleFlushLine(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(true);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
                 line->setState(M_Inv);
@@ -581,7 +582,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
                     break;
 
                 // Copy data in and update state to resolve race with conflicting event
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 if (race->getCmd() == Command::FetchInvX) {
                     event->setDirty(false);
                 } else if (race->getCmd() != Command::Fetch) { // FetchInv, ForceInv, or Inv
@@ -613,7 +614,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
                     line->setOwned(false);
                     line->setShared(false);
                     if (event->getDirty()) {
-                        line->setData(event->getPayload(), 0);
+                        line->setData(event->getPayloadBuffer(), 0);
                         line->setState(M);
                         if (mem_h_is_debug_addr(addr))
                             printDataValue(line->getAddr(), line->getData(), true);
@@ -643,7 +644,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 line->setState(M);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
@@ -662,7 +663,7 @@ bool MESIPrivNoninclusive::handleFlushLineInv(MemEvent * event, bool in_mshr) {
             line->setOwned(false);
             line->setShared(false);
             if (event->getDirty()) {
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -873,14 +874,14 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                     sendWritebackAck(event);
                     delete event;
                 } else {
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     responses_.erase(addr);
                     mshr_->decrementAcksNeeded(addr);
                     if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::Fetch) {
                         status = allocateLine(event, line, false);
                         if (status == MemEventStatus::OK) {
                             line->setState(S);
-                            line->setData(event->getPayload(), 0);
+                            line->setData(event->getPayloadBuffer(), 0);
                             if (mem_h_is_debug_addr(addr))
                                 printDataValue(line->getAddr(), line->getData(), true);
                             mshr_->clearData(addr);
@@ -898,7 +899,7 @@ bool MESIPrivNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     line->setState(S);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
@@ -980,13 +981,13 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1, false);
                 } else {
-                    mshr_->setData(addr, event->getPayload(), false);
+                    mshr_->setData(addr, event->getPayloadBuffer(), false);
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
                     sendWritebackAck(event);
@@ -997,7 +998,7 @@ bool MESIPrivNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     sendWritebackAck(event);
@@ -1070,13 +1071,13 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 if (mshr_->getFrontType(addr) == MSHREntryType::Event && mshr_->getFrontEvent(addr)->getCmd() == Command::FetchInvX) {
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     event->setCmd(Command::PutS);
                     event->setDirty(false);
                     retry(addr);
                     status = allocateMSHR(event, false, 1);
                 } else { // Eviction or invalidation -> we won't need a line
-                    mshr_->setData(addr, event->getPayload(), true);
+                    mshr_->setData(addr, event->getPayloadBuffer(), true);
                     mshr_->decrementAcksNeeded(addr);
                     responses_.erase(addr);
                     sendWritebackAck(event);
@@ -1087,7 +1088,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     line->setState(M);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     if (mshr_->hasData(addr)) mshr_->clearData(addr);
@@ -1100,7 +1101,7 @@ bool MESIPrivNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
         case M:
             line->setOwned(false);
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
             sendWritebackAck(event);
@@ -1155,7 +1156,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
     switch (state) {
         case I:
             if (mshr_->getAcksNeeded(addr)) {
-                mshr_->setData(addr, event->getPayload(), event->getDirty());
+                mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 sendWritebackAck(event);
                 delete event;
 
@@ -1168,7 +1169,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 status = allocateLine(event, line, in_mshr);
                 if (status == MemEventStatus::OK) {
                     event->getDirty() ? line->setState(M) : line->setState(E);
-                    line->setData(event->getPayload(), 0);
+                    line->setData(event->getPayloadBuffer(), 0);
                     if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
                     sendWritebackAck(event);
@@ -1183,7 +1184,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -1196,7 +1197,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M_Inv);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(line->getAddr(), line->getData(), true);
             }
@@ -1211,7 +1212,7 @@ bool MESIPrivNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
             line->setShared(true);
             if (event->getDirty()) {
                 line->setState(M);
-                line->setData(event->getPayload(), 0);
+                line->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                         printDataValue(line->getAddr(), line->getData(), true);
             } else {
@@ -1477,7 +1478,7 @@ bool MESIPrivNoninclusive::handleForceInv(MemEvent * event, bool in_mshr) {
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::ForceInv, upper_cache_name_, line_size_, 0, in_mshr);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
@@ -1640,7 +1641,7 @@ bool MESIPrivNoninclusive::handleFetchInv(MemEvent * event, bool in_mshr){
             } else if (mshr_->exists(addr) && mshr_->getFrontEvent(addr)->getCmd() == Command::PutX) { // Drop PutX, Ack it, forward request up
                 MemEvent * put = static_cast<MemEvent*>(mshr_->swapFrontEvent(addr, event));
                 sendWritebackAck(put);
-                mshr_->setData(addr, put->getPayload(), put->getDirty());
+                mshr_->setData(addr, put->getPayloadBuffer(), put->getDirty());
                 delete put;
                 sendFwdRequest(event, Command::FetchInv, upper_cache_name_, line_size_, 0, in_mshr);
             } else if (mshr_->exists(addr) && (CommandWriteback[(int)mshr_->getFrontEvent(addr)->getCmd()])) {
@@ -1843,7 +1844,7 @@ bool MESIPrivNoninclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     // Update line
     if (line) {
-        line->setData(event->getPayload(), 0);
+        line->setData(event->getPayloadBuffer(), 0);
         line->setState(S);
         line->setShared(true);
         line->setTimestamp(send_time-1);
@@ -1995,7 +1996,7 @@ bool MESIPrivNoninclusive::handleFetchResp(MemEvent * event, bool in_mshr) {
     } else {    // FetchInv only
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
         } else if (state == M_Inv) {
@@ -2042,7 +2043,7 @@ bool MESIPrivNoninclusive::handleFetchXResp(MemEvent * event, bool in_mshr) {
         line->setShared(true);
         if (event->getDirty()) {
             line->setState(M);
-            line->setData(event->getPayload(), 0);
+            line->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_addr(addr))
                 printDataValue(line->getAddr(), line->getData(), true);
         } else if (state == M_InvX) {
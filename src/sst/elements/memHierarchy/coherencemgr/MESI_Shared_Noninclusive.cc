@@ -52,6 +52,7 @@ MESISharNoninclusive::MESISharNoninclusive(ComponentId_t id, Params& params, Par
     HashFunction * ht = createHashFunction(params);
     data_array_ = new CacheArray<DataLine>(debug_, lines, assoc, line_size_, rmgr, ht);
     data_array_->setBanked(params.find<uint64_t>("banks", 0));
+    data_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
 
     uint64_t dir_lines = params.find<uint64_t>("dlines");
     uint64_t dir_assoc = params.find<uint64_t>("dassoc");
@@ -59,6 +60,9 @@ MESISharNoninclusive::MESISharNoninclusive(ComponentId_t id, Params& params, Par
     ReplacementPolicy *drmgr = createReplacementPolicy(dir_lines, dir_assoc, params, false, 1);
     dir_array_ = new CacheArray<DirectoryLine>(debug_, dir_lines, dir_assoc, line_size_, drmgr, ht);
     dir_array_->setBanked(params.find<uint64_t>("banks", 0));
+    dir_array_->setTagStore(params.find<std::string>("tag_store", "pointer"));
+    sharer_index_ = new SharerIndex();
+    dir_array_->setSharerIndex(sharer_index_);
 
     flush_state_ = FlushState::Ready;
     shutdown_flush_counter_ = 0;
@@ -390,7 +394,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool in_mshr) {
                 }
                 if (status == MemEventStatus::OK) {
                     recordLatencyType(event->getID(), LatType::INV);
-                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                     tag->setState(S_D);
                     tag->setTimestamp(send_time - 1);
                     if (mem_h_is_debug_event(event))
@@ -456,7 +460,7 @@ bool MESISharNoninclusive::handleGetS(MemEvent* event, bool in_mshr) {
                         mshr_->setProfiled(addr, event->getID());
                 }
                 if (status == MemEventStatus::OK) {
-                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                     state == E ? tag->setState(E_D) : tag->setState(M_D);
                     tag->setTimestamp(send_time - 1);
                     if (mem_h_is_debug_event(event))
@@ -857,7 +861,7 @@ bool MESISharNoninclusive::handleFlushLineInv(MemEvent* event, bool in_mshr) {
         case SM_D:
         case SB_D:
             if (event->getEvict()) {
-                if (*(tag->getSharers()->begin()) == event->getSrc()) {
+                if (*(tag->getSharers().begin()) == event->getSrc()) {
                     removeSharerViaInv(event, tag, data, true);
                     mshr_->decrementAcksNeeded(addr);
                     tag->setState(NextState[tag->getState()]);
@@ -1145,7 +1149,7 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
                     break;
                 }
                 data = data_array_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 in_mshr = true;
@@ -1192,10 +1196,10 @@ bool MESISharNoninclusive::handlePutS(MemEvent * event, bool in_mshr) {
         case E_D:
         case M_D:
         case SB_D:
-            if (event->getSrc() == *(tag->getSharers()->begin())) { // Sent fetch to this requestor
+            if (event->getSrc() == *(tag->getSharers().begin())) { // Sent fetch to this requestor
                 // Retry the pending fetch
                 mshr_->decrementAcksNeeded(addr);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 responses_.find(addr)->second.erase(event->getSrc());
                 if (responses_.find(addr)->second.empty())
                     responses_.erase(addr);
@@ -1278,7 +1282,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
                     break;
                 }
                 data = data_array_->lookup(addr, true);
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 in_mshr = true;
@@ -1295,7 +1299,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
             tag->removeOwner();
             mshr_->decrementAcksNeeded(addr);
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1324,7 +1328,7 @@ bool MESISharNoninclusive::handlePutE(MemEvent * event, bool in_mshr) {
         case M_Inv:
             tag->removeOwner();
             if (!data && !mshr_->hasData(addr))
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1407,7 +1411,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
             data = data_array_->lookup(addr, true);
-            data->setData(event->getPayload(), 0);
+            data->setData(event->getPayloadBuffer(), 0);
             if (mem_h_is_debug_event(event))
                 event_debuginfo_.reason = "hit";
 
@@ -1431,7 +1435,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
                 if (!in_mshr || !mshr_->getProfiled(addr)) {
                     stat_event_state_[(int)Command::PutM][state]->addData(1);
                 }
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
                 sendWritebackAck(event);
@@ -1439,7 +1443,7 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             } else {
                 tag->addSharer(event->getSrc());
                 event->setCmd(Command::PutS);
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
                 if (in_mshr)
                     mshr_->removeFront(addr); // Need to reinsert after the conflicting request
                 MemEventBase* entry = mshr_->getEntryEvent(addr, 1);
@@ -1461,9 +1465,9 @@ bool MESISharNoninclusive::handlePutM(MemEvent * event, bool in_mshr) {
             tag->removeOwner();
 
             if (!data)
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
             else
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
             responses_.find(addr)->second.erase(event->getSrc());
             if (responses_.find(addr)->second.empty())
                 responses_.erase(addr);
@@ -1523,7 +1527,7 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(M);
 
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             }
@@ -1537,9 +1541,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(E);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
 
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
@@ -1554,9 +1558,9 @@ bool MESISharNoninclusive::handlePutX(MemEvent * event, bool in_mshr) {
                 tag->setState(M_Inv);
 
             if (data)
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
             else
-                mshr_->setData(addr, event->getPayload());
+                mshr_->setData(addr, event->getPayloadBuffer());
 
             if (mem_h_is_debug_addr(addr))
                 printDataValue(addr, &(event->getPayload()), true);
@@ -1619,7 +1623,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool in_mshr) {
                     mshr_->setProfiled(addr);
                     tag->setState(S_D);
                     if (!applyPendingReplacement(addr))
-                        send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                        send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                 }
             }
             break;
@@ -1645,7 +1649,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool in_mshr) {
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
                     tag->setState(SM_D);
-                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                 }
             }
             break;
@@ -1669,7 +1673,7 @@ bool MESISharNoninclusive::handleFetch(MemEvent * event, bool in_mshr) {
                 if (status == MemEventStatus::OK) {
                     mshr_->setProfiled(addr);
                     tag->setState(SB_D);
-                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                 }
             }
             break;
@@ -2300,7 +2304,7 @@ bool MESISharNoninclusive::handleFetchInvX(MemEvent * event, bool in_mshr) {
                 mshr_->setProfiled(addr);
             } else if (!data && !mshr_->hasData(addr)) {
                 if (!applyPendingReplacement(addr)) {
-                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers()->begin()), in_mshr, tag->getTimestamp());
+                    send_time = sendFetch(Command::Fetch, event, *(tag->getSharers().begin()), in_mshr, tag->getTimestamp());
                     tag->setTimestamp(send_time-1);
                 }
                 state == E ? tag->setState(E_D) : tag->setState(M_D);
@@ -2376,7 +2380,7 @@ bool MESISharNoninclusive::handleGetSResp(MemEvent * event, bool in_mshr) {
 
     tag->setState(S);
     if (data) {
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
         if (mem_h_is_debug_addr(addr))
             printDataValue(addr, &(event->getPayload()), true);
     }
@@ -2427,7 +2431,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
         {
             // Update line if we have it locally
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             }
@@ -2458,7 +2462,7 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
         }
         case IM:
             if (data) {
-                data->setData(event->getPayload(), 0);
+                data->setData(event->getPayloadBuffer(), 0);
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
             } // fall-thru
@@ -2489,9 +2493,9 @@ bool MESISharNoninclusive::handleGetXResp(MemEvent * event, bool in_mshr) {
             mshr_->setInProgress(addr, false);
             if (event->getPayloadSize() != 0) {
                 if (data) {
-                    data->setData(event->getPayload(), 0);
+                    data->setData(event->getPayloadBuffer(), 0);
                 } else {
-                    mshr_->setData(addr, event->getPayload());
+                    mshr_->setData(addr, event->getPayloadBuffer());
                 }
                 if (mem_h_is_debug_addr(addr))
                     printDataValue(addr, &(event->getPayload()), true);
@@ -2603,9 +2607,9 @@ bool MESISharNoninclusive::handleFetchResp(MemEvent * event, bool in_mshr) {
         responses_.erase(addr);
 
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload(), event->getDirty());
+        mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -2710,9 +2714,9 @@ bool MESISharNoninclusive::handleFetchXResp(MemEvent * event, bool in_mshr) {
 
     // Save data
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload(), event->getDirty());
+        mshr_->setData(addr, event->getPayloadBuffer(), event->getDirty());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -3593,7 +3597,7 @@ bool MESISharNoninclusive::invalidateExceptRequestor(MemEvent * event, Directory
     if (getData && tag->isSharer(event->getSrc()))
         getData = false;
 
-    for (set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+    for (auto it = tag->getSharers().begin(); it != tag->getSharers().end(); ++it) {
         if (*it == rqstr) continue;
 
         if (getData) { // FetchInv
@@ -3616,7 +3620,7 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
         return true;
     } else {
         bool data_requested = !needData;
-        for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+        for (auto it = tag->getSharers().begin(); it != tag->getSharers().end(); ++it) {
             if (!data_requested) {
                 delivery_time = invalidateSharer(*it, event, tag, in_mshr, Command::FetchInv);
                 data_requested = true;
@@ -3634,7 +3638,7 @@ bool MESISharNoninclusive::invalidateAll(MemEvent * event, DirectoryLine * tag,
 
 void MESISharNoninclusive::invalidateSharers(MemEvent * event, DirectoryLine * tag, bool in_mshr, bool needData, Command cmd) {
     uint64_t delivery_time = 0;
-    for (std::set<std::string>::iterator it = tag->getSharers()->begin(); it != tag->getSharers()->end(); it++) {
+    for (auto it = tag->getSharers().begin(); it != tag->getSharers().end(); ++it) {
         if (needData) {
             delivery_time = invalidateSharer(*it, event, tag, in_mshr, Command::FetchInv);
             needData = false;
@@ -3765,7 +3769,7 @@ void MESISharNoninclusive::removeSharerViaInv(MemEvent * event, DirectoryLine *
     Addr addr = event->getBaseAddr();
     tag->removeSharer(event->getSrc());
     if (!data && !mshr_->hasData(addr))
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (remove) {
         responses_.find(addr)->second.erase(event->getSrc());
@@ -3778,9 +3782,9 @@ void MESISharNoninclusive::removeOwnerViaInv(MemEvent * event, DirectoryLine * t
     Addr addr = event->getBaseAddr();
     tag->removeOwner();
     if (data)
-        data->setData(event->getPayload(), 0);
+        data->setData(event->getPayloadBuffer(), 0);
     else
-        mshr_->setData(addr, event->getPayload());
+        mshr_->setData(addr, event->getPayloadBuffer());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &(event->getPayload()), true);
@@ -3944,7 +3948,7 @@ void MESISharNoninclusive::processCompleteEvent(MemEventInit* event, MemLinkBase
             event->setSrc(getName());
             lowlink->sendUntimedData(event, false, true);
         } else {
-            data->setData(event->getPayload(), 0);
+            data->setData(event->getPayloadBuffer(), 0);
             delete event;
             tag->setState(M); // Make sure data gets flushed
         }
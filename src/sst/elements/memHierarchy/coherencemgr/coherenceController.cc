@@ -575,6 +575,17 @@ void CoherenceController::setup() {
         }
         flush_dest_ = min.name;
     }
+
+    /* Number our sources so that sharers can be tracked as bits. Assign in name order so that
+     * iterating sharers visits them in the same order as a name-ordered set would. */
+    if (sharer_index_) {
+        std::set<std::string> names;
+        auto sources = link_up_->getSources();
+        for (auto it = sources->begin(); it != sources->end(); it++)
+            names.insert(it->name);
+        for (auto it = names.begin(); it != names.end(); it++)
+            sharer_index_->getIndex(*it);
+    }
 }
 
 void CoherenceController::processCompleteEvent(MemEventInit* event, MemLinkBase* highlink, MemLinkBase* lowlink) {
@@ -927,6 +938,7 @@ void CoherenceController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(event_debuginfo_);
     SST_SER(evict_debuginfo_);
     SST_SER(mshr_);
+    SST_SER(sharer_index_);
     SST_SER(listeners_);
     SST_SER(max_outstanding_prefetch_);
     SST_SER(drop_prefetch_level_);
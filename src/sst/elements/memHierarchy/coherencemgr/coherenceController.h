@@ -28,6 +28,7 @@
 #include "util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/sharerSet.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/hash.h"
@@ -301,6 +302,9 @@ protected:
     /* Miss status handling register */
     MSHR * mshr_;
 
+    /* Dense sharer numbering for managers that track sharers, nullptr otherwise */
+    SharerIndex * sharer_index_ = nullptr;
+
     /* Listeners: prefetchers, tracers, etc. */
     std::vector<CacheListener*> listeners_;
     size_t max_outstanding_prefetch_;
@@ -355,6 +355,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     int mshrSize    = params.find<int>("mshr_num_entries",-1);
     if (mshrSize == 0) dbg.fatal(CALL_INFO, -1, "Invalid param(%s): mshr_num_entries - must be at least 1 or else negative to indicate an unlimited size MSHR\n", getName().c_str());
     mshr                = loadComponentExtension<MSHR>(&dbg, mshrSize, getName(), debug_addr_filter_);
+    sharerIndex         = new SharerIndex();
 
     /* Get latencies */
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
@@ -815,6 +816,13 @@ void DirectoryController::setup(void){
     if (linkUp_ != linkDown_)
         linkDown_->setup();
 
+    // Number sources in name order so that sharers are visited in the same order as a name-ordered set
+    std::set<std::string> sources;
+    for (auto it = linkUp_->getSources()->begin(); it != linkUp_->getSources()->end(); it++)
+        sources.insert(it->name);
+    for (auto it = sources.begin(); it != sources.end(); it++)
+        sharerIndex->getIndex(*it);
+
     auto peers = linkUp_->getPeers();
     MemLinkBase::EndpointInfo min = linkUp_->getEndpointInfo();
     bool isFlushManager = true;
@@ -1236,7 +1244,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
                 if (event->getEvict()) {
                     entry->removeOwner();
                     entry->addSharer(event->getSrc());
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
                     issueFetch(event, entry, Command::FetchInvX);
@@ -1251,7 +1259,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
             }
@@ -1260,7 +1268,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (event->getEvict()) {
                 entry->removeOwner();
                 entry->addSharer(event->getSrc());
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
                 responses.find(addr)->second.erase(event->getSrc());
@@ -1333,7 +1341,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    mshr->setData(addr, event->getPayload(), event->getDirty());
+                    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                     event->setEvict(false);
                 }
 
@@ -1365,7 +1373,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                mshr->setData(addr, event->getPayload(), event->getDirty());
+                mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
                 event->setEvict(false);
                 responses.find(addr)->second.erase(event->getSrc());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
@@ -1619,14 +1627,14 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             update = true;
             break;
         case M_Inv:
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S_Inv);
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(S);
             break;
         default:
@@ -1681,7 +1689,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -1737,7 +1745,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
             mshr->decrementAcksNeeded(addr);
             responses.find(addr)->second.erase(event->getSrc());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
-            mshr->setData(addr, event->getPayload(), event->getDirty());
+            mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());
             entry->setState(I);
             break;
         default:
@@ -2013,7 +2021,7 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
     }
 
     sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-    mshr->setData(addr, event->getPayload(), false); // Save data for a subsequent GetS
+    mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for a subsequent GetS
     cleanUpAfterResponse(event, inMSHR);
 
     if (mem_h_is_debug_addr(addr)) {
@@ -2052,7 +2060,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
                 entry->addSharer(reqEv->getSrc());
             }
             sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
-            mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
+            mshr->setData(addr, event->getPayloadBuffer(), false); // So subsequent GetS can get data
             break;
         case IM:
             if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
@@ -2065,7 +2073,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
             break;
         case SM_Inv:
             entry->setState(S_Inv);
-            mshr->setData(addr, event->getPayload(), false); // Save data for when the invalidations finish
+            mshr->setData(addr, event->getPayloadBuffer(), false); // Save data for when the invalidations finish
             if (mem_h_is_debug_addr(addr)) {
                 eventDI.newst = entry->getState();
                 eventDI.verboseline = entry->getString();
@@ -2251,7 +2259,7 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
 
     entry->removeOwner();
     entry->addSharer(event->getSrc());
@@ -2286,7 +2294,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     responses.find(addr)->second.erase(event->getSrc());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
-    mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
+    mshr->setData(addr, event->getPayloadBuffer(), event->getDirty());       // Save data for retry
 
     entry->setState(I);
 
@@ -2398,7 +2406,7 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
     std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(addr);
 
     if (directory.end() == i) {
-        directory[addr] = new DirEntry(addr);
+        directory[addr] = new DirEntry(addr, sharerIndex);
         i = directory.find(addr);
         i->second->cacheIter = entryCache.end();
         i->second->setCached(true);
@@ -2604,11 +2612,12 @@ void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command c
 }
 
 void DirectoryController::issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd) {
-    std::string rqstr = (event->getSrc());
+    uint32_t rqstr = sharerIndex->findIndex(event->getSrc());
 
-    for (set<std::string>::iterator it = entry->getSharers()->begin(); it != entry->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
-        issueInvalidation(*it, event, entry, cmd);
+    SharerSet* sharers = entry->getSharerSet();
+    for (uint32_t shr = sharers->first(); shr != SharerIndex::NONE; shr = sharers->next(shr + 1)) {
+        if (shr == rqstr) continue;
+        issueInvalidation(sharerIndex->getName(shr), event, entry, cmd);
     }
 }
 
@@ -2862,6 +2871,7 @@ void DirectoryController::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(clockLinkDown_);
     SST_SER(dlevel);
     SST_SER(mshr);
+    SST_SER(sharerIndex);
     SST_SER(directory);
     SST_SER(cpuMsgQueue);
     SST_SER(memMsgQueue);
@@ -36,6 +36,7 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/sharerSet.h"
 
 using namespace std;
 
@@ -325,10 +326,12 @@ private:
         Addr                  addr;           // block address
         State                 state;          // state
         std::list<DirEntry*>::iterator cacheIter; // Location in cache (or end() if not cached)
-        std::set<std::string> sharers;        // set of sharers for block
+        SharerSet             sharers;        // set of sharers for block
+        SharerIndex*          sharerIndex;    // Maps sharer names to bits in sharers
         std::string           owner;          // Owner of block
 
-        DirEntry(Addr a) {
+        DirEntry(Addr a, SharerIndex* index) {
+            sharerIndex = index;
             clearEntry();
             addr = a;
             state = I;
@@ -347,10 +350,10 @@ private:
             str << "State: " << StateString[state];
             str << " Sharers: [";
             bool comma = false;
-            for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
+            for (auto& shr : getSharers()) {
                 if (comma)
                     str << ",";
-                str << *it;
+                str << shr;
                 comma = true;
             }
             str << "] Owner: " << owner;
@@ -368,15 +371,17 @@ private:
 
         void clearSharers() { sharers.clear(); }
 
-        void addSharer(std::string shr) { sharers.insert(shr); }
+        void addSharer(const std::string& shr) { sharers.add(sharerIndex->getIndex(shr)); }
 
-        bool isSharer(std::string shr) { return sharers.find(shr) != sharers.end(); }
+        bool isSharer(const std::string& shr) { return sharers.contains(sharerIndex->findIndex(shr)); }
 
         bool hasSharers() { return !(sharers.empty()); }
 
-        std::set<std::string>* getSharers() { return &sharers; }
+        SharerSet::Names getSharers() { return sharers.names(sharerIndex); }
 
-        void removeSharer(std::string shr) { sharers.erase(shr); }
+        SharerSet* getSharerSet() { return &sharers; }
+
+        void removeSharer(const std::string& shr) { sharers.remove(sharerIndex->findIndex(shr)); }
 
         std::string getOwner() { return owner; }
 
@@ -397,6 +402,7 @@ private:
             SST_SER(addr);
             SST_SER(state);
             SST_SER(sharers);
+            SST_SER(sharerIndex);
             SST_SER(owner);
             // Serialization of iterators isn't supported
             // Skip serializing and reconstruct on deserialization
@@ -435,6 +441,7 @@ private:
 
     MSHR * mshr;
     std::unordered_map<Addr, DirEntry*> directory; // Master list of all directory entries, including noncached ones
+    SharerIndex* sharerIndex;                       // Dense numbering of sources, shared by all directory entries
 
 
     struct MemMsg {
@@ -0,0 +1,160 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_IDMAP_H
+#define MEMHIERARCHY_IDMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <vector>
+
+#include <sst/core/serialization/serializer.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/* Reduce an ID to 64 bits for hashing */
+inline uint64_t idMapDigest(uint64_t id) { return id; }
+inline uint64_t idMapDigest(const std::pair<uint64_t, int>& id) { return id.first ^ ((uint64_t)(uint32_t)id.second << 48); }
+
+/*
+ * Map from request/event IDs to in-flight state
+ *
+ * IDs are handed out from a monotonically increasing counter and live only for the duration of a
+ * request, so the map stays small and lookups are on the critical path of every access. Entries are
+ * kept in a flat open-addressed (linear probing) table indexed by a Fibonacci hash of the ID. Deletion
+ * shifts later entries back so no tombstones accumulate. The table starts at 'capacity' slots and doubles
+ * when it becomes half full; it never shrinks so steady-state operation does not allocate.
+ */
+template <typename K, typename V>
+class IdMap {
+public:
+    IdMap(size_t capacity = 64) {
+        size_t cap = 16;
+        bits_ = 4;
+        while (cap < capacity) {
+            cap <<= 1;
+            bits_++;
+        }
+        slots_.resize(cap);
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /* Insert or overwrite */
+    void insert(const K& key, const V& value) {
+        if ((count_ + 1) * 2 > slots_.size())
+            grow();
+        size_t pos = probe(key);
+        if (!slots_[pos].used_) {
+            slots_[pos].used_ = true;
+            slots_[pos].key_ = key;
+            count_++;
+        }
+        slots_[pos].value_ = value;
+    }
+
+    /* Return a pointer to the value for key or nullptr if key is not present */
+    V* find(const K& key) {
+        Slot& slot = slots_[probe(key)];
+        return slot.used_ ? &slot.value_ : nullptr;
+    }
+
+    /* Remove key and return its value in 'value'. Returns false if key was not present. */
+    bool remove(const K& key, V& value) {
+        size_t pos = probe(key);
+        if (!slots_[pos].used_)
+            return false;
+        value = slots_[pos].value_;
+        erase(pos);
+        return true;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) {
+        std::vector<std::pair<K, V>> entries;
+        if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+            for (auto& slot : slots_) {
+                if (slot.used_)
+                    entries.push_back(std::make_pair(slot.key_, slot.value_));
+            }
+        }
+        SST_SER(entries);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            for (auto& entry : entries)
+                insert(entry.first, entry.second);
+        }
+    }
+
+private:
+    struct Slot {
+        K key_;
+        V value_;
+        bool used_ = false;
+    };
+
+    size_t home(const K& key) const {
+        return (idMapDigest(key) * 0x9E3779B97F4A7C15ULL) >> (64 - bits_);
+    }
+
+    /* Return the slot holding key, or the empty slot where it would be inserted */
+    size_t probe(const K& key) const {
+        size_t mask = slots_.size() - 1;
+        size_t pos = home(key);
+        while (slots_[pos].used_ && !(slots_[pos].key_ == key))
+            pos = (pos + 1) & mask;
+        return pos;
+    }
+
+    /* Backward-shift deletion keeps every entry reachable from its home slot without tombstones */
+    void erase(size_t pos) {
+        size_t mask = slots_.size() - 1;
+        size_t next = (pos + 1) & mask;
+        while (slots_[next].used_) {
+            size_t h = home(slots_[next].key_);
+            // Move next back into the hole unless its home lies cyclically in (pos, next]
+            if (((next - h) & mask) >= ((next - pos) & mask)) {
+                slots_[pos] = slots_[next];
+                pos = next;
+            }
+            next = (next + 1) & mask;
+        }
+        slots_[pos].used_ = false;
+        slots_[pos].value_ = V();
+        count_--;
+    }
+
+    void grow() {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.resize(old.size() * 2);
+        bits_++;
+        count_ = 0;
+        for (auto& slot : old) {
+            if (slot.used_)
+                insert(slot.key_, slot.value_);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    unsigned int bits_ = 0;
+    size_t count_ = 0;
+};
+
+}
+}
+
+#endif // MEMHIERARCHY_IDMAP_H
@@ -21,8 +21,10 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/replacementManager.h"
+#include "sst/elements/memHierarchy/sharerSet.h"
 
 using namespace std;
 
@@ -46,14 +48,15 @@ class DirectoryLine {
         const unsigned int index_;
         Addr addr_;
         State state_;
-        std::set<std::string> sharers_;
+        SharerSet sharers_;
+        SharerIndex* sharer_index_;
         std::string owner_;
         uint64_t last_send_timestamp_;
         CoherenceReplacementInfo* info_;
         bool was_prefetch_;
 
     public:
-        DirectoryLine(uint32_t size, unsigned int index) : index_(index) {
+        DirectoryLine(uint32_t size, unsigned int index) : index_(index), sharer_index_(nullptr) {
             info_ = new CoherenceReplacementInfo(index, I, false, false);
             reset();
         }
@@ -81,17 +84,18 @@ class DirectoryLine {
         void setState(State state) { state_ = state; }
 
         // Sharers
-        set<std::string>* getSharers() { return &sharers_; }
-        bool isSharer(std::string shr) {   return sharers_.find(shr) != sharers_.end(); }
+        void setSharerIndex(SharerIndex* index) { sharer_index_ = index; }
+        SharerSet::Names getSharers() { return sharers_.names(sharer_index_); }
+        bool isSharer(const std::string& shr) { return sharers_.contains(sharer_index_->findIndex(shr)); }
         size_t numSharers() { return sharers_.size(); }
         bool hasSharers() { return !sharers_.empty(); }
-        bool hasOtherSharers(std::string shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.find(shr) != sharers_.end())); }
-        void addSharer(std::string shr) {
-            sharers_.insert(shr);
+        bool hasOtherSharers(const std::string& shr) { return !(sharers_.empty() || (sharers_.size() == 1 && isSharer(shr))); }
+        void addSharer(const std::string& shr) {
+            sharers_.add(sharer_index_->getIndex(shr));
             info_->setShared(true);
         }
-        void removeSharer(std::string shr) {
-            sharers_.erase(shr);
+        void removeSharer(const std::string& shr) {
+            sharers_.remove(sharer_index_->findIndex(shr));
             info_->setShared(!sharers_.empty());
         }
 
@@ -127,20 +131,23 @@ class DirectoryLine {
             std::ostringstream str;
             str << "O: " << (owner_.empty() ? "-" : owner_);
             str << " S: [";
-            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
-                if (it != sharers_.begin()) str << ",";
-                str << *it;
+            bool comma = false;
+            for (auto& shr : getSharers()) {
+                if (comma) str << ",";
+                str << shr;
+                comma = true;
             }
             str << "]";
             return str.str();
         }
 
-        DirectoryLine() : index_(0) {}
+        DirectoryLine() : index_(0), sharer_index_(nullptr) {}
         void serialize_order(SST::Core::Serialization::serializer& ser) {
             SST_SER(const_cast<unsigned int&>(index_));
             SST_SER(addr_);
             SST_SER(state_);
             SST_SER(sharers_);
+            SST_SER(sharer_index_);
             SST_SER(owner_);
             SST_SER(last_send_timestamp_);
             SST_SER(info_);
@@ -186,9 +193,12 @@ class DataLine {
 
         // Data
         vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> data, uint32_t offset) {
+        void setData(const vector<uint8_t>& data, uint32_t offset) {
             std::copy(data.begin(), data.end(), data_.begin() + offset);
         }
+        void setData(const PayloadBuffer& data, uint32_t offset) {
+            std::copy(data.data(), data.data() + data.size(), data_.begin() + offset);
+        }
 
         // Replacement
         ReplacementInfo* getReplacementInfo() { return (tag_ != nullptr ? tag_->getReplacementInfo() : info_); }
@@ -253,9 +263,12 @@ class CacheLine : public SST::Core::Serialization::serializable {
 
         // Data
         vector<uint8_t>* getData() { return &data_; }
-        void setData(vector<uint8_t> in, uint32_t offset) {
+        void setData(const vector<uint8_t>& in, uint32_t offset) {
             std::copy(in.begin(), in.end(), std::next(data_.begin(), offset));
         }
+        void setData(const PayloadBuffer& in, uint32_t offset) {
+            std::copy(in.data(), in.data() + in.size(), std::next(data_.begin(), offset));
+        }
 
         // Timestamp
         uint64_t getTimestamp() { return lastSendTimestamp_; }
@@ -383,7 +396,8 @@ class L1CacheLine : public CacheLine {
 /* With owner/sharer state for shared caches */
 class SharedCacheLine : public CacheLine {
     private:
-        std::set<std::string> sharers_;
+        SharerSet sharers_;
+        SharerIndex* sharer_index_ = nullptr;
         std::string owner_;
         CoherenceReplacementInfo * info_;
     protected:
@@ -405,17 +419,18 @@ class SharedCacheLine : public CacheLine {
         }
 
         // Sharers
-        set<std::string>* getSharers() { return &sharers_; }
-        bool isSharer(std::string name) {   return sharers_.find(name) != sharers_.end(); }
+        void setSharerIndex(SharerIndex* index) { sharer_index_ = index; }
+        SharerSet::Names getSharers() { return sharers_.names(sharer_index_); }
+        bool isSharer(const std::string& shr) { return sharers_.contains(sharer_index_->findIndex(shr)); }
         size_t numSharers() { return sharers_.size(); }
         bool hasSharers() { return !sharers_.empty(); }
-        bool hasOtherSharers(std::string shr) { return !(sharers_.empty() || (sharers_.size() == 1 && sharers_.find(shr) != sharers_.end())); }
-        void addSharer(std::string s) {
-            sharers_.insert(s);
+        bool hasOtherSharers(const std::string& shr) { return !(sharers_.empty() || (sharers_.size() == 1 && isSharer(shr))); }
+        void addSharer(const std::string& shr) {
+            sharers_.add(sharer_index_->getIndex(shr));
             info_->setShared(true);
         }
-        void removeSharer(std::string s) {
-            sharers_.erase(s);
+        void removeSharer(const std::string& shr) {
+            sharers_.remove(sharer_index_->findIndex(shr));
             info_->setShared(!sharers_.empty());
         }
 
@@ -439,9 +454,11 @@ class SharedCacheLine : public CacheLine {
             std::ostringstream str;
             str << "O: " << (owner_.empty() ? "-" : owner_);
             str << " S: [";
-            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
-                if (it != sharers_.begin()) str << ",";
-                str << *it;
+            bool comma = false;
+            for (auto& shr : getSharers()) {
+                if (comma) str << ",";
+                str << shr;
+                comma = true;
             }
             str << "]";
             return str.str();
@@ -451,6 +468,7 @@ class SharedCacheLine : public CacheLine {
         void serialize_order(SST::Core::Serialization::serializer& ser) override {
             CacheLine::serialize_order(ser);
             SST_SER(sharers_);
+            SST_SER(sharer_index_);
             SST_SER(owner_);
             SST_SER(info_);
         }
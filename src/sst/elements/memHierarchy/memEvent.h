@@ -17,6 +17,7 @@
 #define MEMHIERARCHY_MEMEVENT_H
 
 #include <utility>
+#include <algorithm>
 
 #include <sst/core/sst_types.h>
 #include <sst/core/component.h>
@@ -31,6 +32,138 @@ namespace SST { namespace MemHierarchy {
 
 using namespace std;
 
+/**
+ * Storage for a MemEvent's data payload
+ *
+ * Data-carrying events are created and destroyed at every hop, so payloads of up to INLINE_SIZE bytes
+ * (a typical cache line) are stored inline in the event and never touch the heap. Callers that need
+ * a std::vector (getPayload()) move the payload into a vector, which is then used for the rest of the
+ * event's lifetime. Those vectors, and larger transfers, are recycled through per-thread free lists
+ * bucketed by power-of-two size class up to MAX_POOLED_SIZE. A buffer released on one thread (e.g.,
+ * after crossing a partition) simply joins that thread's list; each list holds at most MAX_FREE buffers.
+ */
+class PayloadBuffer {
+public:
+    /* Largest payload kept inline: 64B, the common cache line size. Every MemEvent carries this
+     * many bytes, so it is not raised to cover bigger lines. Caches with 128B or larger lines move
+     * their payloads into vectors, which come from the size-class free lists below and so only
+     * touch the heap until the lists are warm. */
+    static const size_t INLINE_SIZE = 64;
+    static const size_t MIN_POOLED_SHIFT = 6;   /* Smallest size class is 64B */
+    static const size_t MAX_POOLED_SHIFT = 20;  /* Largest size class is 1MiB */
+    static const size_t MAX_POOLED_SIZE = size_t(1) << MAX_POOLED_SHIFT;
+    static const size_t MAX_FREE = 256;
+
+    PayloadBuffer() = default;
+    PayloadBuffer(const PayloadBuffer& o) { assign(o.data(), o.size()); }
+    PayloadBuffer& operator=(const PayloadBuffer& o) {
+        if (this != &o) assign(o.data(), o.size());
+        return *this;
+    }
+    ~PayloadBuffer() { release(); }
+
+    /* Read access that does not require a vector */
+    const uint8_t* data() const { return inVector_ ? data_.data() : inline_; }
+    size_t size() const { return inVector_ ? data_.size() : inlineSize_; }
+    bool empty() const { return size() == 0; }
+
+    /* Vector access; moves an inline payload into a (recycled) vector */
+    std::vector<uint8_t>& get() {
+        if (!inVector_) {
+            reserve(inlineSize_);
+            data_.assign(inline_, inline_ + inlineSize_);
+            inVector_ = true;
+        }
+        return data_;
+    }
+
+    void assign(const std::vector<uint8_t>& data) {
+        assign(data.data(), data.size());
+    }
+
+    void assign(const uint8_t* data, size_t size) {
+        if (!inVector_ && size <= INLINE_SIZE) {
+            std::copy(data, data + size, inline_);
+            inlineSize_ = size;
+        } else {
+            get();
+            reserve(size);
+            data_.assign(data, data + size);
+        }
+    }
+
+    void resize(size_t size, uint8_t value = 0) {
+        if (!inVector_ && size <= INLINE_SIZE) {
+            if (size > inlineSize_)
+                std::fill(inline_ + inlineSize_, inline_ + size, value);
+            inlineSize_ = size;
+        } else {
+            get();
+            reserve(size);
+            data_.resize(size, value);
+        }
+    }
+
+    void clear() {
+        inlineSize_ = 0;
+        data_.clear();
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer &ser) {
+        get(); // Checkpoints go through the vector representation
+        SST_SER(data_);
+    }
+
+private:
+    /* Size class that can hold 'size' bytes */
+    static size_t sizeClass(size_t size) {
+        size_t c = 0;
+        while ((size_t(1) << (c + MIN_POOLED_SHIFT)) < size) c++;
+        return c;
+    }
+
+    /* Make sure data_ can hold 'size' bytes, taking a recycled buffer if it has to grow */
+    void reserve(size_t size) {
+        if (data_.capacity() >= size)
+            return;
+        if (size > MAX_POOLED_SIZE) {
+            data_.reserve(size);
+            return;
+        }
+        size_t c = sizeClass(size);
+        std::vector<std::vector<uint8_t> >& pool = freeList(c);
+        if (!pool.empty()) {
+            pool.back().assign(data_.begin(), data_.end());
+            data_.swap(pool.back());
+            pool.pop_back();
+        } else {
+            data_.reserve(size_t(1) << (c + MIN_POOLED_SHIFT));
+        }
+    }
+
+    void release() {
+        size_t cap = data_.capacity();
+        if (cap < (size_t(1) << MIN_POOLED_SHIFT) || cap > MAX_POOLED_SIZE)
+            return;
+        /* File under the largest class this buffer can satisfy */
+        size_t c = sizeClass(cap);
+        if ((size_t(1) << (c + MIN_POOLED_SHIFT)) > cap) c--;
+        std::vector<std::vector<uint8_t> >& pool = freeList(c);
+        if (pool.size() < MAX_FREE)
+            pool.push_back(std::move(data_));
+    }
+
+    static std::vector<std::vector<uint8_t> >& freeList(size_t sizeClass) {
+        static thread_local std::vector<std::vector<uint8_t> > pools[MAX_POOLED_SHIFT - MIN_POOLED_SHIFT + 1];
+        return pools[sizeClass];
+    }
+
+    std::vector<uint8_t> data_;
+    uint8_t inline_[INLINE_SIZE];
+    size_t inlineSize_ = 0;
+    bool inVector_ = false;
+};
+
 /**
  * Interface Event used to represent Memory-based communication.
  *
@@ -185,6 +318,12 @@ public:
     /** @return  the data payload. */
     dataVec& getPayload(void) {
         /* Lazily allocate space for payload */
+        if ( payload_.size() < size_ )  payload_.resize(size_);
+        return payload_.get();
+    }
+
+    /** @return  the data payload without moving it into a vector. */
+    const PayloadBuffer& getPayloadBuffer(void) {
         if ( payload_.size() < size_ )  payload_.resize(size_);
         return payload_;
     }
@@ -195,7 +334,7 @@ public:
      */
     void setPayload(std::vector<uint8_t>& data) {
         setSize(data.size());
-        payload_ = data;
+        payload_.assign(data);
     }
 
     /** Sets the data payload and payload size.
@@ -204,10 +343,7 @@ public:
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
-        payload_.resize(size);
-        for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
-        }
+        payload_.assign(data, size);
     }
 
     void setZeroPayload(uint32_t size) {
@@ -252,13 +388,14 @@ public:
         else
             str << std::hex << " Addr: 0x" << baseAddr_;
         str << (addrGlobal_ ? " (G)" : " (L)");
+        const uint8_t* payload = payload_.data();
         if (payload_.empty() || level < 11)
             str << " Data: " << (payload_.empty() ? "F" : "T");
         else {
             std::stringstream value;
             value << std::hex << std::setfill('0');
             for (unsigned int i = 0; i < payload_.size(); i++)
-                value << std::hex << std::setw(2) << (int)payload_[i];
+                value << std::hex << std::setw(2) << (int)payload[i];
             str << " Data: 0x" << value.str();
         }
         str << " VA: 0x" << vAddr_ << " IP: 0x" << instPtr_;
@@ -304,7 +441,7 @@ private:
     bool      addrGlobal_;        // Whether address is a local or global address
     MemEvent* NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int       retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec   payload_;           // Data
+    PayloadBuffer payload_;       // Data
     bool      prefetch_;          // Whether this request came from a prefetcher
     bool      dirty_;             // For a replacement, whether the data is dirty or not
     bool      isEvict_;           // Whether an event is an eviction
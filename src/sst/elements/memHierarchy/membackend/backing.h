@@ -50,6 +50,46 @@ public:
     // Print contents of backing to stdout (testing purposes)
     virtual void printToScreen(Addr addr_offset, Addr addr_start, Addr addr_interleave_size, Addr addr_interleave_step) = 0;
 
+    // Get a pointer to the bytes at 'addr' so they can be read or written in place.
+    // On entry 'size' is the number of bytes wanted, on return it is the number of contiguous bytes at the
+    // returned pointer, which is less than requested if the range crosses an allocation boundary.
+    // Returns nullptr (and size = 0) if the backing does not support direct access.
+    virtual uint8_t* getSpan( Addr UNUSED(addr), size_t& size ) { size = 0; return nullptr; }
+
+    // Copy 'size' bytes from 'data' into the backing at 'addr', one contiguous span at a time
+    void setBytes( Addr addr, size_t size, const uint8_t* data ) {
+        while (size != 0) {
+            size_t len = size;
+            uint8_t* span = getSpan(addr, len);
+            if (span == nullptr) {
+                set(addr, *data);
+                len = 1;
+            } else {
+                memcpy(span, data, len);
+            }
+            addr += len;
+            data += len;
+            size -= len;
+        }
+    }
+
+    // Copy 'size' bytes at 'addr' out of the backing into 'data', one contiguous span at a time
+    void getBytes( Addr addr, size_t size, uint8_t* data ) {
+        while (size != 0) {
+            size_t len = size;
+            uint8_t* span = getSpan(addr, len);
+            if (span == nullptr) {
+                *data = get(addr);
+                len = 1;
+            } else {
+                memcpy(data, span, len);
+            }
+            addr += len;
+            data += len;
+            size -= len;
+        }
+    }
+
     void serialize_order(SST::Core::Serialization::serializer& ser) override {}
     ImplementVirtualSerializable(SST::MemHierarchy::Backend::Backing);
 };
@@ -123,8 +163,7 @@ public:
     }
 
     void set( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        for (size_t i = 0; i < size; i++)
-            buffer_[addr + i] = data[i];
+        memcpy(buffer_ + (addr - offset_), data.data(), size);
     }
 
     uint8_t get( Addr addr ) override {
@@ -132,8 +171,14 @@ public:
     }
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        for (size_t i = 0; i < size; i++)
-            data[i] = buffer_[addr + i];
+        data.resize(size);
+        memcpy(data.data(), buffer_ + (addr - offset_), size);
+    }
+
+    uint8_t* getSpan( Addr addr, size_t& size ) override {
+        size_t avail = size_ - (addr - offset_);
+        if (size > avail) size = avail;
+        return buffer_ + (addr - offset_);
     }
 
     void printToFile( std::string UNUSED(outfile) ) override { }
@@ -261,6 +306,10 @@ private:
 };
 
 /*
+ * Sparse backing store allocated in units of 'size' bytes (pages) on first touch
+ * Pages are located through a two-level radix table indexed by page number so that finding a page
+ * is two array lookups. The first level grows to cover the highest page touched.
+ *
  * Throws:
  * 1: Unable to open infile
  */
@@ -290,89 +339,73 @@ public:
             auto buf = (uint8_t*) malloc( alloc_unit_);
             (void) !fread(&addr, sizeof(addr), 1, fp);
             (void) !fread(buf, sizeof(uint8_t), alloc_unit_, fp);
-            buffer_[addr] = buf;
+            insertPage(addr, buf);
+        }
+        fclose(fp);
+    }
+
+    ~BackingMalloc() {
+        for ( auto& table : pages_ ) {
+            for ( auto page : table )
+                free(page);
         }
     }
 
     void set( Addr addr, uint8_t value ) override {
         Addr bAddr = addr >> shift_;
         Addr offset = addr - (bAddr << shift_);
-        allocIfNeeded(bAddr);
-        buffer_[bAddr][offset] = value;
+        getPage(bAddr)[offset] = value;
     }
 
     void set( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        /* Account for size exceeding alloc unit size */
-        Addr bAddr = addr >> shift_;
-        Addr offset = addr - (bAddr << shift_);
-        size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
-
-        while (dataOffset != size) {
-            buffer_[bAddr][offset] = data[dataOffset];
-            offset++;
-            dataOffset++;
-
-            if (offset == alloc_unit_) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
-        }
+        setBytes(addr, size, data.data());
     }
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        Addr bAddr = addr >> shift_;
-        Addr offset = addr - (bAddr << shift_);
-        size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
-        assert( data.size() == size );
-
-        assert( buffer_.find(bAddr) != buffer_.end() );
-        auto buf = buffer_[bAddr];
-        while (dataOffset != size) {
-
-            data[dataOffset] = buf[offset];
-            offset++;
-            dataOffset++;
-            if (offset == alloc_unit_) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
-        }
+        data.resize(size);
+        getBytes(addr, size, data.data());
     }
 
     uint8_t get( Addr addr ) override {
         Addr bAddr = addr >> shift_;
         Addr offset = addr - (bAddr << shift_);
-        allocIfNeeded(bAddr);
-        return buffer_[bAddr][offset];
+        return getPage(bAddr)[offset];
     }
 
+    /* Spans end at the page boundary */
+    uint8_t* getSpan( Addr addr, size_t& size ) override {
+        Addr bAddr = addr >> shift_;
+        Addr offset = addr - (bAddr << shift_);
+        if (size > alloc_unit_ - offset)
+            size = alloc_unit_ - offset;
+        return getPage(bAddr) + offset;
+    }
 
     void printToFile( std::string outfile ) override {
         auto fp = fopen(outfile.c_str(),"wb+");
         if (!fp) { throw 1; }
-        size_t count = buffer_.size();
+        size_t count = page_count_;
         fwrite(&count, sizeof(count), 1, fp);
         fwrite(&alloc_unit_, sizeof(alloc_unit_), 1, fp);
         fwrite(&shift_, sizeof(shift_), 1, fp);
         fwrite(&init_, sizeof(init_), 1, fp);
 
-        for ( auto const& x : buffer_ ) {
-            fwrite(&(x.first), sizeof(Addr), 1, fp);
-            fwrite(x.second, sizeof(uint8_t), alloc_unit_, fp);
+        for ( size_t i = 0; i < pages_.size(); i++ ) {
+            for ( size_t j = 0; j < pages_[i].size(); j++ ) {
+                if (pages_[i][j] == nullptr) continue;
+                Addr bAddr = (i << table_shift_) + j;
+                fwrite(&bAddr, sizeof(Addr), 1, fp);
+                fwrite(pages_[i][j], sizeof(uint8_t), alloc_unit_, fp);
+            }
         }
+        fclose(fp);
     }
 
     void printToScreen(Addr addr_offset, Addr addr_start, Addr addr_interleave_size, Addr addr_interleave_step) override {
         Output out("", 1, 0, Output::STDOUT);
         out.output("==================================================================================================\n");
         out.output("Printing contents of dynamically allocated memory backing buffer\n");
-        out.output("Number of buffer chunks: %zu\n", buffer_.size());
+        out.output("Number of buffer chunks: %zu\n", page_count_);
         out.output("Chunk size: %d B\n", alloc_unit_);
         out.output("==================================================================================================\n");
         out.output("Address    | Value (hex)\n");
@@ -380,9 +413,11 @@ public:
         Addr output_unit = (alloc_unit_ % 64 == 0) ? 64 : (alloc_unit_ % 32 == 0) ? 32 : alloc_unit_;
         Addr units_per_buffer = alloc_unit_ / output_unit;
 
-        for ( auto const& x : buffer_ ) {
-            Addr local_addr = x.first << shift_;
-            uint8_t* value_ptr = x.second;
+        for ( size_t i = 0; i < pages_.size(); i++ ) {
+          for ( size_t j = 0; j < pages_[i].size(); j++ ) {
+            if (pages_[i][j] == nullptr) continue;
+            Addr local_addr = ((i << table_shift_) + j) << shift_;
+            uint8_t* value_ptr = pages_[i][j];
             for (Addr line = 0; line < units_per_buffer; line++) {
                 Addr global_addr = local_addr - addr_offset;
                 if (addr_interleave_size == 0) {
@@ -405,6 +440,7 @@ public:
                 out.output("%s\n", value.str().c_str());
                 local_addr += output_unit;
             }
+          }
         }
         out.output("==================================================================================================\n");
     }
@@ -418,19 +454,24 @@ public:
         SST_SER(shift_);
         SST_SER(init_);
 
-        // Manually serialize buffer_ because the uint8_t* array isn't automatically serializable
+        // Manually serialize the pages because the uint8_t* arrays aren't automatically serializable
+        // Pages are written as (page number, data) pairs in address order
         switch (ser.mode()) {
         case SST::Core::Serialization::serializer::SIZER:
         case SST::Core::Serialization::serializer::PACK:
-            SST_SER(buffer_.size());
-            for ( auto& x : buffer_ ) { // Serialize each key/value pair
-                Addr key = x.first;
-                uint8_t* value = x.second;
-                SST_SER(key);
-                SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
+            SST_SER(page_count_);
+            for ( size_t i = 0; i < pages_.size(); i++ ) {
+                for ( size_t j = 0; j < pages_[i].size(); j++ ) {
+                    if (pages_[i][j] == nullptr) continue;
+                    Addr key = (i << table_shift_) + j;
+                    uint8_t* value = pages_[i][j];
+                    SST_SER(key);
+                    SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
+                }
             }
             break;
         case SST::Core::Serialization::serializer::UNPACK:
+        {
             size_t buffer_size;
             Addr key;
 
@@ -439,9 +480,10 @@ public:
                 uint8_t* value = (uint8_t*) malloc(sizeof(uint8_t)*alloc_unit_);
                 SST_SER(key);
                 SST_SER(SST::Core::Serialization::array(value, alloc_unit_));
-                buffer_[key] = value;
+                insertPage(key, value);
             }
             break;
+        }
         case SST::Core::Serialization::serializer::MAP:
             break; // Nothing to do
         }
@@ -450,21 +492,45 @@ public:
     ImplementSerializable(SST::MemHierarchy::Backend::BackingMalloc)
 
 private:
-    void allocIfNeeded( Addr bAddr ) {
-        if (buffer_.find(bAddr) == buffer_.end()) {
-            uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*alloc_unit_);
-            if ( init_ ) {
-                bzero( data, alloc_unit_ );
-            }
-            if (!data) {
-                Output out("", 1, 0, Output::STDOUT);
-                out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
-            }
-            buffer_[bAddr] = data;
+    /* Return the page for page number 'bAddr', allocating it if needed */
+    uint8_t* getPage( Addr bAddr ) {
+        Addr table = bAddr >> table_shift_;
+        if (table < pages_.size() && !pages_[table].empty()) {
+            uint8_t* page = pages_[table][bAddr & table_mask_];
+            if (page) return page;
         }
+
+        uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*alloc_unit_);
+        if (!data) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
+        }
+        if ( init_ ) {
+            bzero( data, alloc_unit_ );
+        }
+        insertPage(bAddr, data);
+        return data;
+    }
+
+    void insertPage( Addr bAddr, uint8_t* data ) {
+        Addr table = bAddr >> table_shift_;
+        if (table >= pages_.size())
+            pages_.resize(table + 1);
+        if (pages_[table].empty())
+            pages_[table].resize((Addr)1 << table_shift_, nullptr);
+        uint8_t*& page = pages_[table][bAddr & table_mask_];
+        if (page == nullptr)
+            page_count_++;
+        else
+            free(page);
+        page = data;
     }
 
-    std::map<Addr,uint8_t*> buffer_;
+    static const unsigned int table_shift_ = 10;                            // Pages per second-level table = 2^table_shift_
+    static const Addr table_mask_ = ((Addr)1 << table_shift_) - 1;
+
+    std::vector<std::vector<uint8_t*> > pages_;    // pages_[page >> table_shift_][page & table_mask_], empty tables are unallocated
+    size_t page_count_ = 0;
     unsigned int alloc_unit_;
     unsigned int shift_;
     bool init_;
@@ -509,8 +575,7 @@ public:
     }
 
     void set( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
-        Backing* backing = getBacking(addr);
-        backing->set(addr, size, data);
+        setBytes(addr, size, data.data());
     }
 
     uint8_t get( Addr addr ) override {
@@ -520,9 +585,20 @@ public:
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data ) override {
         data.resize(size);
-        for (size_t i = 0; i < size; i++) {
-            data[i] = getBacking(addr + i)->get(addr + i);
+        getBytes(addr, size, data.data());
+    }
+
+    /* Spans do not cross from one region to another */
+    uint8_t* getSpan( Addr addr, size_t& size ) override {
+        for ( hybridStruct* item : mmapList ) {
+            if ( item->startAddr <= addr && addr < item->endAddr ) {
+                if (size > item->endAddr - addr) size = item->endAddr - addr;
+                return item->myBacking->getSpan(addr, size);
+            } else if ( addr < item->startAddr && size > item->startAddr - addr ) {
+                size = item->startAddr - addr;
+            }
         }
+        return backingMalloc->getSpan(addr, size);
     }
 
     void printToFile(std::string outfile) override
@@ -134,6 +134,20 @@ class SimpleMemBackend : public MemBackend {
 
     virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes ) = 0;
 
+    typedef MemBackendConvertor::BackendReq BackendReq;
+
+    /*
+     * Batched issue, called at most a few times per cycle with the requests at the head of the convertor's queue.
+     * Must issue a prefix of 'reqs' in order and return the number accepted, as if issueRequest() had been
+     * called on each until one was rejected. Backends can override this to avoid per-request overhead.
+     */
+    virtual size_t issueRequests( const std::vector<BackendReq>& reqs ) {
+        size_t i = 0;
+        while ( i < reqs.size() && issueRequest( reqs[i].id, reqs[i].addr, reqs[i].isWrite, reqs[i].numBytes ) )
+            i++;
+        return i;
+    }
+
     void handleMemResponse( ReqId id ) {
         m_respFunc( id );
     }
@@ -31,7 +31,7 @@ using namespace SST::MemHierarchy;
 
 
 MemBackendConvertor::MemBackendConvertor(ComponentId_t id, Params& params, MemBackend* backend, uint32_t request_width) :
-    SubComponent(id), m_cycleCount(0), m_reqId(0), m_backend(backend)
+    SubComponent(id), m_cycleCount(0), m_pendingCount(0), m_backend(backend), m_batchIssue(false)
 {
     m_dbg.init("",
             params.find<uint32_t>("debug_level", 0),
@@ -91,7 +91,7 @@ void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, evId, rqstr, id );
     m_requestQueue.push_back( req );
-    m_pendingRequests[id] = req;
+    addPending( id, req );
 }
 
 bool MemBackendConvertor::clock(Cycle_t cycle) {
@@ -99,7 +99,9 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
 
     int reqsThisCycle = 0;
     bool cycleWithIssue = false;
-    while ( !m_requestQueue.empty()) {
+    if ( m_batchIssue ) {
+        cycleWithIssue = issueBatched();
+    } else while ( !m_requestQueue.empty()) {
         if ( reqsThisCycle == m_backend->getMaxReqPerCycle() ) {
             break;
         }
@@ -127,7 +129,7 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
     if (cycleWithIssue)
         stat_cyclesWithIssue->addData(1);
 
-    stat_outstandingReqs->addData( m_pendingRequests.size() );
+    stat_outstandingReqs->addData( m_pendingCount );
 
     bool unclock = !m_clockBackend;
     if (m_clockBackend)
@@ -142,13 +144,78 @@ bool MemBackendConvertor::clock(Cycle_t cycle) {
     return false;
 }
 
+/*
+ * Issue up to the backend's per-cycle request limit in batches
+ * A batch holds the next backend-width pieces of the memory requests at the head of the queue, in queue order,
+ * so the backend sees the same sequence as with one-at-a-time issue. Custom requests are issued individually.
+ * Returns whether this cycle counts as a cycle with issue; as in the unbatched loop, a cycle that ends in a
+ * rejection does not.
+ */
+bool MemBackendConvertor::issueBatched() {
+    int maxReqs = m_backend->getMaxReqPerCycle(); // -1 is unlimited
+    int reqsThisCycle = 0;
+    bool cycleWithIssue = false;
+
+    while ( !m_requestQueue.empty() && reqsThisCycle != maxReqs ) {
+        BaseReq* front = m_requestQueue.front();
+        if ( !front->isMemEv() ) {
+            Debug(_L10_, "Processing request: %s\n", front->getString().c_str());
+            if ( !issue( front ) ) {
+                stat_cyclesAttemptIssueButRejected->addData(1);
+                return false;
+            }
+            cycleWithIssue = true;
+            reqsThisCycle++;
+            front->increment( m_backendRequestWidth );
+            if ( front->issueDone() )
+                m_requestQueue.pop_front();
+            continue;
+        }
+
+        size_t limit = MAX_BATCH;
+        if ( maxReqs > 0 && (size_t)(maxReqs - reqsThisCycle) < limit )
+            limit = maxReqs - reqsThisCycle;
+
+        m_batch.clear();
+        for ( std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end() && m_batch.size() < limit; it++ ) {
+            if ( !(*it)->isMemEv() )
+                break;
+            MemReq* req = static_cast<MemReq*>(*it);
+            uint32_t offset = req->processed();
+            do {
+                m_batch.push_back( { req->idAt(offset), req->baseAddr() + offset, req->isWrite(), m_backendRequestWidth } );
+                offset += m_backendRequestWidth;
+            } while ( offset < req->size() && m_batch.size() < limit );
+        }
+
+        size_t accepted = issueBatch( m_batch );
+        Debug(_L10_, "Issued %zu of a batch of %zu requests\n", accepted, m_batch.size());
+
+        for ( size_t i = 0; i < accepted; i++ ) {
+            BaseReq* req = m_requestQueue.front();
+            req->increment( m_backendRequestWidth );
+            if ( req->issueDone() )
+                m_requestQueue.pop_front();
+        }
+        reqsThisCycle += accepted;
+        if ( accepted )
+            cycleWithIssue = true;
+
+        if ( accepted < m_batch.size() ) {
+            stat_cyclesAttemptIssueButRejected->addData(1);
+            return false;
+        }
+    }
+    return cycleWithIssue;
+}
+
 /*
  * Called by MemController to turn the clock back on
  * cycle = current cycle
  */
 void MemBackendConvertor::turnClockOn(Cycle_t cycle) {
     Cycle_t cyclesOff = cycle - m_cycleCount;
-    stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingRequests.size() );
+    stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingCount );
     m_cycleCount = cycle;
     m_clockOn = true;
 }
@@ -171,23 +238,23 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     uint32_t id = BaseReq::getBaseId(reqId);
     MemEvent* resp = NULL;
 
-    if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+    BaseReq* req = findPending( id );
+    if ( req == nullptr ) {
         m_dbg.fatal(CALL_INFO, -1, "memory request not found; id=%" PRId32 "\n", id);
     }
 
-    BaseReq* req = m_pendingRequests[id];
-
     req->decrement( );
 
     if ( req->isDone() ) {
-        m_pendingRequests.erase(id);
+        removePending(id);
 
         if (!req->isMemEv()) {
             CustomReq* creq = static_cast<CustomReq*>(req);
             sendResponse(creq->getEvId(), flags);
         } else {
 
-            MemEvent* event = static_cast<MemReq*>(req)->getMemEvent();
+            MemReq* mreq = static_cast<MemReq*>(req);
+            MemEvent* event = mreq->getMemEvent();
 
             Debug(_L10_,"doResponse req is done. %s\n", event->getBriefString().c_str());
 
@@ -196,23 +263,16 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
             doResponseStat( event->getCmd(), latency );
 
             if (!flags) flags = event->getFlags();
-            SST::Event::id_type evID = event->getID();
             sendResponse(event->getID(), flags); // Needs to occur before a flush is completed since flush is dependent
 
             // TODO clock responses
             // Check for flushes that are waiting on this event to finish
-            if (m_dependentRequests.find(evID) != m_dependentRequests.end()) {
-                std::set<MemEvent*, memEventCmp> flushes = m_dependentRequests.find(evID)->second;
-
-                for (std::set<MemEvent*, memEventCmp>::iterator it = flushes.begin(); it != flushes.end(); it++) {
-                    (m_waitingFlushes.find(*it)->second).erase(evID);
-                    if ((m_waitingFlushes.find(*it)->second).empty()) {
-                        MemEvent * flush = *it;
-                        sendResponse(flush->getID(), flush->getFlags());
-                        m_waitingFlushes.erase(flush);
-                    }
+            for (MemEvent* flush : mreq->getDependentFlushes()) {
+                std::unordered_map<MemEvent*, uint32_t>::iterator it = m_waitingFlushes.find(flush);
+                if (--(it->second) == 0) {
+                    sendResponse(flush->getID(), flush->getFlags());
+                    m_waitingFlushes.erase(it);
                 }
-                m_dependentRequests.erase(evID);
             }
         }
         delete req;
@@ -232,7 +292,7 @@ void MemBackendConvertor::finish(Cycle_t endCycle) {
     // stat_outstandingReqs may vary slightly in parallel & serial
     if (endCycle > m_cycleCount) {
         Cycle_t cyclesOff = endCycle - m_cycleCount;
-        stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingRequests.size() );
+        stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingCount );
         m_cycleCount = endCycle;
     }
     stat_totalCycles->addData(m_cycleCount);
@@ -253,15 +313,16 @@ void MemBackendConvertor::serialize_order(SST::Core::Serialization::serializer&
     SST_SER(m_backend);
     SST_SER(m_backendRequestWidth);
     SST_SER(m_clockBackend);
+    SST_SER(m_batchIssue);
     SST_SER(m_dbg);
     SST_SER(m_cycleCount);
     SST_SER(m_clockOn);
-    SST_SER(m_reqId);
     SST_SER(m_requestQueue);
     SST_SER(m_pendingRequests);
+    SST_SER(m_freeReqIds);
+    SST_SER(m_pendingCount);
     SST_SER(m_frontendRequestWidth);
     SST_SER(m_waitingFlushes);
-    SST_SER(m_dependentRequests);
     SST_SER(stat_GetSLatency);
     SST_SER(stat_GetSXLatency);
     SST_SER(stat_GetXLatency);
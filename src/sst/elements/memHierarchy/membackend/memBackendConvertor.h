@@ -21,6 +21,9 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <unordered_map>
+#include <vector>
+
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
@@ -61,6 +64,14 @@ class MemBackendConvertor : public SubComponent {
 
     typedef uint64_t ReqId;
 
+    /* One backend-width piece of a request, as passed to a backend's batched issue */
+    struct BackendReq {
+        ReqId       id;
+        Addr        addr;
+        bool        isWrite;
+        unsigned    numBytes;
+    };
+
     class BaseReq : public SST::Core::Serialization::serializable {
     public:
 
@@ -139,6 +150,7 @@ class MemBackendConvertor : public SubComponent {
 
         uint32_t processed()    { return m_offset; }
         uint64_t id()           { return ((uint64_t)m_reqId << 32) | m_offset; }
+        uint64_t idAt(uint32_t offset) { return ((uint64_t)m_reqId << 32) | offset; }
         MemEvent* getMemEvent() { return m_event; }
         bool isWrite()          { return (m_event->getCmd() == Command::PutM || m_event->getCmd() == Command::Write); }
         uint32_t size()         { return m_event->getSize(); }
@@ -156,6 +168,10 @@ class MemBackendConvertor : public SubComponent {
             return ( m_offset >= m_event->getSize() && 0 == m_numReq );
         }
 
+        /* Flushes that cannot complete until this request does */
+        void addDependentFlush(MemEvent* flush) { m_flushes.push_back(flush); }
+        std::vector<MemEvent*>& getDependentFlushes() { return m_flushes; }
+
         std::string getString() {
             std::ostringstream str;
             str << "addr: " << addr() << " baseAddr: " << baseAddr() << " processed: " << processed();
@@ -169,12 +185,14 @@ class MemBackendConvertor : public SubComponent {
             SST_SER(m_event);
             SST_SER(m_offset);
             SST_SER(m_numReq);
+            SST_SER(m_flushes);
         }
         ImplementSerializable(SST::MemHierarchy::MemBackendConvertor::MemReq)
       private:
         MemEvent*   m_event;
         uint32_t    m_offset;
         uint32_t    m_numReq;
+        std::vector<MemEvent*> m_flushes;
     };
 
   public:
@@ -191,12 +209,12 @@ class MemBackendConvertor : public SubComponent {
     virtual bool isBackendClocked() { return m_clockBackend; }
 
     virtual const std::string getRequestor( ReqId reqId ) {
-        uint32_t id = BaseReq::getBaseId(reqId);
-        if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+        BaseReq* req = findPending( BaseReq::getBaseId(reqId) );
+        if ( req == nullptr ) {
             m_dbg.fatal(CALL_INFO, -1, "memory request not found\n");
         }
 
-        return m_pendingRequests[id]->getRqstr();
+        return req->getRqstr();
     }
 
     virtual void setCallbackHandlers(std::function<void(Event::id_type,uint32_t)> responseCB, std::function<Cycle_t()> clockenableCB);
@@ -225,35 +243,35 @@ protected:
     uint32_t    m_backendRequestWidth;
 
     bool m_clockBackend;
+    bool m_batchIssue;      // Set by convertors that override issueBatch()
 
   private:
     virtual bool issue(BaseReq*) = 0;
 
+    /* Batched issue to the backend. Issue a prefix of 'reqs', in order, and return how many were accepted */
+    virtual size_t issueBatch( const std::vector<BackendReq>& UNUSED(reqs) ) { return 0; }
+
+    bool issueBatched();
 
+    static const size_t MAX_BATCH = 64;     // Limit on batch size when the backend accepts unlimited requests per cycle
+    std::vector<BackendReq> m_batch;        // Reused each cycle, not serialized
 
 
     bool setupMemReq( MemEvent* ev ) {
         if ( Command::FlushLine == ev->getCmd() || Command::FlushLineInv == ev->getCmd() ) {
             // TODO optimize if this becomes a problem, it is slow
-            std::set<SST::Event::id_type> dependsOn;
+            uint32_t dependsOn = 0;
             for (std::deque<BaseReq*>::iterator it = m_requestQueue.begin(); it != m_requestQueue.end(); it++) {
                 if (!(*it)->isMemEv())
                     continue;
                 MemReq * mr = static_cast<MemReq*>(*it);
                 if (mr->baseAddr() == ev->getBaseAddr()) {
-                    MemEvent * req = mr->getMemEvent();
-                    dependsOn.insert(req->getID());
-                    if (m_dependentRequests.find(req->getID()) == m_dependentRequests.end()) {
-                        std::set<MemEvent*, memEventCmp> flushSet;
-                        flushSet.insert(ev);
-                        m_dependentRequests.insert(std::make_pair(req->getID(), flushSet));
-                    } else {
-                        (m_dependentRequests.find(req->getID())->second).insert(ev);
-                    }
+                    mr->addDependentFlush(ev);
+                    dependsOn++;
                 }
             }
 
-            if (dependsOn.empty()) return false;
+            if (dependsOn == 0) return false;
             m_waitingFlushes.insert(std::make_pair(ev, dependsOn));
             return true;
         }
@@ -261,7 +279,7 @@ protected:
         uint32_t id = genReqId();
         MemReq* req = new MemReq( ev, id );
         m_requestQueue.push_back( req );
-        m_pendingRequests[id] = req;
+        addPending( id, req );
         return true;
     }
 
@@ -323,18 +341,44 @@ protected:
     std::function<Cycle_t()> m_enableClock; // Re-enable parent's clock
     std::function<void(Event::id_type id, uint32_t)> m_notifyResponse; // notify parent of response
 
-    uint32_t genReqId( ) { return ++m_reqId; }
+    /*
+     * Pending requests are kept in a dense table indexed by request ID - 1.
+     * IDs of completed requests are reused so the table stays the size of the maximum number in flight.
+     */
+    uint32_t genReqId( ) {
+        if (!m_freeReqIds.empty()) {
+            uint32_t id = m_freeReqIds.back();
+            m_freeReqIds.pop_back();
+            return id;
+        }
+        m_pendingRequests.push_back(nullptr);
+        return m_pendingRequests.size();
+    }
 
-    uint32_t m_reqId;
+    void addPending( uint32_t id, BaseReq* req ) {
+        m_pendingRequests[id - 1] = req;
+        m_pendingCount++;
+    }
 
-    typedef std::map<uint32_t,BaseReq*> PendingRequests;
+    BaseReq* findPending( uint32_t id ) {
+        if (id == 0 || id > m_pendingRequests.size())
+            return nullptr;
+        return m_pendingRequests[id - 1];
+    }
+
+    void removePending( uint32_t id ) {
+        m_pendingRequests[id - 1] = nullptr;
+        m_freeReqIds.push_back(id);
+        m_pendingCount--;
+    }
 
     std::deque<BaseReq*>    m_requestQueue;
-    PendingRequests         m_pendingRequests;
+    std::vector<BaseReq*>   m_pendingRequests;
+    std::vector<uint32_t>   m_freeReqIds;
+    size_t                  m_pendingCount;
     uint32_t                m_frontendRequestWidth;
 
-    std::map<MemEvent*, std::set<SST::Event::id_type> > m_waitingFlushes; // Set of request IDs for each flush
-    std::map<SST::Event::id_type, std::set<MemEvent*, memEventCmp> > m_dependentRequests; // Reverse map, set of flushes for each request ID, for faster lookup
+    std::unordered_map<MemEvent*, uint32_t> m_waitingFlushes; // Number of requests each flush is waiting on
 
     Statistic<uint64_t>* stat_GetSLatency;
     Statistic<uint64_t>* stat_GetSXLatency;
@@ -29,6 +29,7 @@ SimpleMemBackendConvertor::SimpleMemBackendConvertor(ComponentId_t id, Params &p
 {
     using std::placeholders::_1;
     static_cast<SimpleMemBackend*>(m_backend)->setResponseHandler( std::bind( &SimpleMemBackendConvertor::handleMemResponse, this, _1 ) );
+    m_batchIssue = true;
 }
 
 bool SimpleMemBackendConvertor::issue( BaseReq* req ) {
@@ -41,6 +42,10 @@ bool SimpleMemBackendConvertor::issue( BaseReq* req ) {
     }
 }
 
+size_t SimpleMemBackendConvertor::issueBatch( const std::vector<BackendReq>& reqs ) {
+    return static_cast<SimpleMemBackend*>(m_backend)->issueRequests( reqs );
+}
+
 void SimpleMemBackendConvertor::serialize_order(SST::Core::Serialization::serializer& ser) {
     MemBackendConvertor::serialize_order(ser);
 
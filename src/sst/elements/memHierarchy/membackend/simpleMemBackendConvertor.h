@@ -39,6 +39,7 @@ public:
     SimpleMemBackendConvertor(ComponentId_t id, Params &params, MemBackend* backend, uint32_t);
 
     virtual bool issue( BaseReq* req ) override;
+    virtual size_t issueBatch( const std::vector<BackendReq>& reqs ) override;
 
     virtual void handleMemResponse( ReqId reqId ) {
         doResponse(reqId);
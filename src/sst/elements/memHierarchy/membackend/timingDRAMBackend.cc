@@ -12,6 +12,10 @@
 
 #include <sst_config.h>
 #include <sst/core/timeLord.h>
+
+#include <algorithm>
+#include <limits>
+
 #include "membackend/timingDRAMBackend.h"
 
 using namespace SST;
@@ -63,6 +67,7 @@ TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id,
         using std::placeholders::_1;
         m_channels.push_back(loadComponentExtension<Channel>( std::bind(&TimingDRAM::handleResponse, this, _1), tmpParams, dram_id, i, output, m_mapper ));
     }
+    m_nextCycle.resize( numChannels, 0 );
 }
 
 bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBytes )
@@ -72,6 +77,7 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
     bool ret = m_channels[chan]->issue(m_cycle, id, addr, isWrite, numBytes );
 
     if ( ret ) {
+        m_nextCycle[chan] = std::min( m_nextCycle[chan], m_cycle );
         output->verbose(CALL_INFO, 2, DBG_MASK, "chan=%d reqId=%" PRIu64 " addr=%#" PRIx64 "\n",chan,id,addr);
     } else {
         output->verbose(CALL_INFO, 5, DBG_MASK, "chan=%d reqId=%" PRIu64 " addr=%#" PRIx64 " failed\n",chan,id,addr);
@@ -79,11 +85,34 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
     return ret;
 }
 
+/*
+ * Dispatch a batch straight to the channels. Stops at the first request whose
+ * channel transaction queue is full so requests are still issued in order.
+ */
+size_t TimingDRAM::issueRequests( const std::vector<BackendReq>& reqs )
+{
+    size_t i = 0;
+    for ( ; i < reqs.size(); i++ ) {
+        const BackendReq& req = reqs[i];
+        unsigned chan = m_mapper->getChannel(req.addr);
+        if ( ! m_channels[chan]->issue(m_cycle, req.id, req.addr, req.isWrite, req.numBytes ) ) {
+            output->verbose(CALL_INFO, 5, DBG_MASK, "chan=%d reqId=%" PRIu64 " addr=%#" PRIx64 " failed\n",chan,req.id,req.addr);
+            break;
+        }
+        m_nextCycle[chan] = std::min( m_nextCycle[chan], m_cycle );
+        output->verbose(CALL_INFO, 2, DBG_MASK, "chan=%d reqId=%" PRIu64 " addr=%#" PRIx64 "\n",chan,req.id,req.addr);
+    }
+    return i;
+}
+
 bool TimingDRAM::clock(Cycle_t cycle)
 {
     output->verbose(CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",m_cycle);
     for ( unsigned i = 0; i < m_channels.size(); i++ ) {
-        m_channels[i]->clock(m_cycle);
+        if ( m_nextCycle[i] <= m_cycle ) {
+            m_channels[i]->clock(m_cycle);
+            m_nextCycle[i] = m_channels[i]->nextEventCycle(m_cycle);
+        }
     }
     ++m_cycle;
     return false;
@@ -174,6 +203,28 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     }
 }
 
+/*
+ * First cycle after the current one at which clocking the channel can change
+ * anything. While every bank with work is waiting on its last command the
+ * channel clock is a no-op until one of the issued commands finishes.
+ */
+SimTime_t TimingDRAM::Channel::nextEventCycle( SimTime_t cycle )
+{
+    if ( ! m_retiredTrans.empty() ) {
+        return cycle + 1;
+    }
+    for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
+        if ( ! m_ranks[i]->isBlocked() ) {
+            return cycle + 1;
+        }
+    }
+    SimTime_t next = std::numeric_limits<SimTime_t>::max();
+    for ( std::list<Cmd*>::iterator iter = m_issuedCmds.begin(); iter != m_issuedCmds.end(); ++iter ) {
+        next = std::min( next, (*iter)->getFiniTime() );
+    }
+    return std::max( next, cycle + 1 );
+}
+
 TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
 {
     Cmd* cmd = nullptr;
@@ -260,6 +311,16 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     return nullptr;
 }
 
+bool TimingDRAM::Rank::isBlocked()
+{
+    for ( std::set<unsigned>::iterator iter = m_banksActive.begin(); iter != m_banksActive.end(); ++iter ) {
+        if ( ! m_banks[*iter]->isBlocked() ) {
+            return false;
+        }
+    }
+    return true;
+}
+
 //==================================================================================
 // Bank
 //==================================================================================
@@ -316,6 +377,19 @@ TimingDRAM::Cmd* TimingDRAM::Bank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     return cmd;
 }
 
+/*
+ * Nothing can happen in this bank until its last command finishes: no new
+ * transaction to turn into commands and the next command is not a column
+ * access that could follow the last one on the data bus.
+ */
+bool TimingDRAM::Bank::isBlocked()
+{
+    if ( nullptr == m_lastCmd || ! m_transQ->empty() ) {
+        return false;
+    }
+    return m_cmdQ.empty() || ! ( m_cmdQ.front()->m_op == Cmd::COL && m_lastCmd->m_op == Cmd::COL );
+}
+
 void TimingDRAM::Bank::update( SimTime_t current )
 {
     if ( nullptr == m_lastCmd && m_row != -1 && m_pagePolicy->shouldClose( current ) ) {
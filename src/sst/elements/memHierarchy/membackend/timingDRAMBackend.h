@@ -105,6 +105,8 @@ private:
             return (m_row == -1 || !m_pagePolicy->canClose()) && m_cmdQ.empty() && m_transQ->empty();
         }
 
+        bool isBlocked();
+
         unsigned getRank() { return m_rank; }
         unsigned getBank() { return m_bank; }
 
@@ -211,6 +213,8 @@ private:
             return ( now >= m_finiTime );
         }
 
+        SimTime_t getFiniTime() { return m_finiTime; }
+
         // these are used for debugging
         std::string& getName()  { return m_name; }
         unsigned getRank()      { return m_bank->getRank(); }
@@ -258,6 +262,8 @@ private:
             return !m_banksActive.empty();
         }
 
+        bool isBlocked();
+
       private:
 
         const char* prefix() { return m_pre.c_str(); }
@@ -298,6 +304,7 @@ private:
         }
 
         void clock(SimTime_t );
+        SimTime_t nextEventCycle(SimTime_t );
 
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
@@ -325,6 +332,7 @@ public:
     TimingDRAM();
     TimingDRAM(ComponentId_t, Params& );
     virtual bool issueRequest( ReqId, Addr, bool, unsigned );
+    virtual size_t issueRequests( const std::vector<BackendReq>& reqs ) override;
     void handleResponse(ReqId  id ) {
         output->verbose(CALL_INFO, 2, DBG_MASK, "req=%" PRIu64 "\n", id );
         handleMemResponse( id );
@@ -334,6 +342,11 @@ public:
 
 private:
     std::vector<Channel*> m_channels;
+    // Cycle at which each channel next has to be clocked. Channels only
+    // interact through the requests coming in, so a channel that is waiting
+    // on its issued commands skips ahead to the first one finishing and is
+    // pulled back to the current cycle when it gets a transaction
+    std::vector<SimTime_t> m_nextCycle;
     AddrMapper* m_mapper;
     SimTime_t   m_cycle;
 
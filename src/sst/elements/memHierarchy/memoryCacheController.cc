@@ -630,8 +630,7 @@ void MemCacheController::readData(MemEvent* event) {
 void MemCacheController::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++)
-        backing_->set(addr + i, data->at(i));
+    backing_->setBytes(addr, data->size(), data->data());
 }
 
 
@@ -640,8 +639,7 @@ void MemCacheController::readData(Addr addr, size_t bytes, std::vector<uint8_t>
 
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->getBytes(addr, bytes, data.data());
 }
 
 
@@ -704,9 +704,7 @@ void MemController::readData(MemEvent* event) {
 void MemController::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++) {
-        backing_->set(addr + i, data->at(i));
-    }
+    backing_->setBytes(addr, data->size(), data->data());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, data, true);
@@ -718,8 +716,7 @@ void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data
 
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->getBytes(addr, bytes, data.data());
 
     if (mem_h_is_debug_addr(addr))
         printDataValue(addr, &data, false);
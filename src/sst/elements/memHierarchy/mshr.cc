@@ -36,6 +36,200 @@ MSHR::MSHR(ComponentId_t cid, Output* debug, int maxSize, string cacheName, std:
 
     flush_acks_needed_ = 0;
     flush_all_in_mshr_count_ = 0;
+
+    initStorage();
+}
+
+/*
+ * Size the address table and preallocate the register and entry pools from max_size_.
+ * Writebacks, evictions, and ack tracking do not count against max_size_ so the table is
+ * given headroom and grows if it ever becomes half full. An unlimited MSHR (max_size_ < 0)
+ * starts from a modest size and grows as needed.
+ */
+void MSHR::initStorage() {
+    size_t expected = max_size_ > 0 ? (size_t)max_size_ : 64;
+    table_bits_ = 4;
+    while (((size_t)1 << table_bits_) < 4 * expected)
+        table_bits_++;
+    table_.assign((size_t)1 << table_bits_, MSHRSlot{0, NIL});
+    table_count_ = 0;
+
+    registers_.clear();
+    free_registers_.clear();
+    entries_.clear();
+    free_entries_.clear();
+
+    registers_.resize(2 * expected);
+    free_registers_.reserve(registers_.size());
+    for (uint32_t i = registers_.size(); i > 0; i--)
+        free_registers_.push_back(i - 1);
+
+    entries_.resize(2 * expected);
+    free_entries_.reserve(entries_.size());
+    for (uint32_t i = entries_.size(); i > 0; i--)
+        free_entries_.push_back(i - 1);
+}
+
+size_t MSHR::hashSlot(Addr addr) const {
+    // Fibonacci hashing; line addresses have zero low-order bits so use the high bits of the product
+    return (size_t)((addr * 0x9E3779B97F4A7C15ULL) >> (64 - table_bits_));
+}
+
+MSHRAddrRegister* MSHR::findRegister(Addr addr) {
+    size_t mask = table_.size() - 1;
+    for (size_t i = hashSlot(addr); ; i = (i + 1) & mask) {
+        if (table_[i].reg_ == NIL)
+            return nullptr;
+        if (table_[i].addr_ == addr)
+            return &registers_[table_[i].reg_];
+    }
+}
+
+MSHRAddrRegister* MSHR::allocateRegister(Addr addr) {
+    if (2 * (table_count_ + 1) > table_.size())
+        growTable();
+
+    if (free_registers_.empty()) {
+        free_registers_.push_back(registers_.size());
+        registers_.emplace_back();
+    }
+    uint32_t index = free_registers_.back();
+    free_registers_.pop_back();
+
+    MSHRAddrRegister* reg = &registers_[index];
+    reg->addr_ = addr;
+    reg->head_ = NIL;
+    reg->tail_ = NIL;
+    reg->count_ = 0;
+    reg->acks_needed_ = 0;
+    reg->data_buffer_.clear();
+    reg->data_dirty_ = false;
+    reg->pending_retries_ = 0;
+
+    size_t mask = table_.size() - 1;
+    size_t i = hashSlot(addr);
+    while (table_[i].reg_ != NIL)
+        i = (i + 1) & mask;
+    table_[i].addr_ = addr;
+    table_[i].reg_ = index;
+    table_count_++;
+    return reg;
+}
+
+/* Remove an address from the table. Uses backward-shift deletion so lookups never need tombstones. */
+void MSHR::eraseRegister(Addr addr) {
+    size_t mask = table_.size() - 1;
+    size_t i = hashSlot(addr);
+    while (table_[i].addr_ != addr || table_[i].reg_ == NIL) {
+        if (table_[i].reg_ == NIL)
+            return;
+        i = (i + 1) & mask;
+    }
+
+    MSHRAddrRegister* reg = &registers_[table_[i].reg_];
+    while (reg->head_ != NIL)
+        unlinkEntry(reg, reg->head_);
+    reg->data_buffer_.clear();
+    free_registers_.push_back(table_[i].reg_);
+    table_count_--;
+
+    size_t hole = i;
+    for (size_t j = (i + 1) & mask; table_[j].reg_ != NIL; j = (j + 1) & mask) {
+        size_t home = hashSlot(table_[j].addr_);
+        // Move j into the hole if its home slot is not cyclically within (hole, j]
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            table_[hole] = table_[j];
+            hole = j;
+        }
+    }
+    table_[hole].reg_ = NIL;
+}
+
+void MSHR::growTable() {
+    std::vector<MSHRSlot> old;
+    old.swap(table_);
+    table_bits_++;
+    table_.assign((size_t)1 << table_bits_, MSHRSlot{0, NIL});
+    size_t mask = table_.size() - 1;
+    for (auto& slot : old) {
+        if (slot.reg_ == NIL) continue;
+        size_t i = hashSlot(slot.addr_);
+        while (table_[i].reg_ != NIL)
+            i = (i + 1) & mask;
+        table_[i] = slot;
+    }
+}
+
+uint32_t MSHR::entryAt(MSHRAddrRegister* reg, size_t index) {
+    uint32_t pos = reg->head_;
+    for (size_t i = 0; i < index; i++)
+        pos = entries_[pos].next_;
+    return pos;
+}
+
+uint32_t MSHR::allocateEntry(const MSHREntry& entry) {
+    if (free_entries_.empty()) {
+        free_entries_.push_back(entries_.size());
+        entries_.emplace_back();
+    }
+    uint32_t pos = free_entries_.back();
+    free_entries_.pop_back();
+    entries_[pos].entry_ = entry;
+    return pos;
+}
+
+void MSHR::pushBack(MSHRAddrRegister* reg, const MSHREntry& entry) {
+    uint32_t pos = allocateEntry(entry);
+    entries_[pos].prev_ = reg->tail_;
+    entries_[pos].next_ = NIL;
+    if (reg->tail_ != NIL)
+        entries_[reg->tail_].next_ = pos;
+    else
+        reg->head_ = pos;
+    reg->tail_ = pos;
+    reg->count_++;
+}
+
+void MSHR::pushFront(MSHRAddrRegister* reg, const MSHREntry& entry) {
+    uint32_t pos = allocateEntry(entry);
+    entries_[pos].prev_ = NIL;
+    entries_[pos].next_ = reg->head_;
+    if (reg->head_ != NIL)
+        entries_[reg->head_].prev_ = pos;
+    else
+        reg->tail_ = pos;
+    reg->head_ = pos;
+    reg->count_++;
+}
+
+void MSHR::insertBefore(MSHRAddrRegister* reg, uint32_t next, const MSHREntry& entry) {
+    if (next == reg->head_) {
+        pushFront(reg, entry);
+        return;
+    }
+    uint32_t pos = allocateEntry(entry);
+    uint32_t prev = entries_[next].prev_;
+    entries_[pos].prev_ = prev;
+    entries_[pos].next_ = next;
+    entries_[prev].next_ = pos;
+    entries_[next].prev_ = pos;
+    reg->count_++;
+}
+
+void MSHR::unlinkEntry(MSHRAddrRegister* reg, uint32_t pos) {
+    uint32_t prev = entries_[pos].prev_;
+    uint32_t next = entries_[pos].next_;
+    if (prev != NIL)
+        entries_[prev].next_ = next;
+    else
+        reg->head_ = next;
+    if (next != NIL)
+        entries_[next].prev_ = prev;
+    else
+        reg->tail_ = prev;
+    reg->count_--;
+    entries_[pos].entry_.getPointers()->clear();
+    free_entries_.push_back(pos);
 }
 
 int MSHR::getMaxSize() {
@@ -47,10 +241,11 @@ int MSHR::getSize() {
 }
 
 unsigned int MSHR::getSize(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
     else
-        return mshr_.find(addr)->second.entries_.size();
+        return reg->count_;
 }
 
 int MSHR::getFlushSize() {
@@ -58,148 +253,136 @@ int MSHR::getFlushSize() {
 }
 
 bool MSHR::exists(Addr addr) {
-    return mshr_.find(addr) != mshr_.end();
+    return findRegister(addr) != nullptr;
 }
 
 MSHREntry MSHR::getEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries_.size() <= index) {
-        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", owner_name_.c_str(), addr, index, mshr_.find(addr)->second.entries_.size());
+    if (reg->count_ <= index) {
+        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", owner_name_.c_str(), addr, index, (size_t)reg->count_);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    return *it;
+    return entries_[entryAt(reg, index)].entry_;
 }
 
 MSHREntry MSHR::getFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
 
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front();
+    return entries_[reg->head_].entry_;
 }
 
 void MSHR::removeEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.size() <= index) {
+    if (reg->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Entry list is shorter than requested index.\n", owner_name_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries_.begin();
-    std::advance(entry, index);
+    uint32_t pos = entryAt(reg, index);
+    MSHREntry* entry = &entries_[pos].entry_;
 
-    if (entry->getType() == MSHREntryType::Event)
+    if (entry->getType() == MSHREntryType::Event) {
         size_--;
+        release_count_++;
+    }
 
     if (mem_h_is_debug_addr(addr))
-        printDebug(10, "Remove", addr, (*entry).getString().c_str());
+        printDebug(10, "Remove", addr, entry->getString().c_str());
 
-    reg->entries_.erase(entry);
-    if (reg->entries_.empty()) {
+    unlinkEntry(reg, pos);
+    if (reg->count_ == 0) {
         if (mem_h_is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
-            //dbg_->debug(_L10_, "M: %-41" PRIu64 " %-20s Erase        0x%-16" PRIx64 " %-10d\n",
-            //        getCurrentSimCycle(), owner_name_.c_str(), addr, size_);
-            //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 void MSHR::removeFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
 
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::removeFront(0x%" PRIx64 ", %s)\n", addr, reg->entries_.front().getString().c_str());
-
-    if (getFrontType(addr) == MSHREntryType::Event)
+    MSHREntry* entry = &entries_[reg->head_].entry_;
+    if (entry->getType() == MSHREntryType::Event) {
         size_--;
+        release_count_++;
+    }
 
     if (mem_h_is_debug_addr(addr))
-        printDebug(10, "RemFr", addr, (reg->entries_.front()).getString().c_str());
+        printDebug(10, "RemFr", addr, entry->getString().c_str());
 
-    reg->entries_.pop_front();
-    if (reg->entries_.empty()) {
+    unlinkEntry(reg, reg->head_);
+    if (reg->count_ == 0) {
         if (mem_h_is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
-            //dbg_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 MSHREntryType MSHR::getEntryType(Addr addr, size_t index) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getEntryType(0x%" PRIx64 ", %zu)\n", addr, index);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries_.size() <= index) {
+    if (reg->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Entry list is shoerter than index.\n", owner_name_.c_str(), addr, index);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    return it->getType();
+    return entries_[entryAt(reg, index)].entry_.getType();
 }
 
 MSHREntryType MSHR::getFrontType(Addr addr) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getFrontType(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front().getType();
+    return entries_[reg->head_].entry_.getType();
 }
 
 MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getEntryEvent(0x%" PRIx64 ", %zu)\n", addr, index);
-
-    if (mshr_.find(addr) == mshr_.end() || mshr_.find(addr)->second.entries_.size() <= index)
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->count_ <= index)
         return nullptr;
 
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-    std::advance(it, index);
-    if (it->getType() != MSHREntryType::Event)
+    MSHREntry* entry = &entries_[entryAt(reg, index)].entry_;
+    if (entry->getType() != MSHREntryType::Event)
         return nullptr;
-    return it->getEvent();
+    return entry->getEvent();
 }
 
 
 MemEventBase* MSHR::getFrontEvent(Addr addr) {
-    //if (mem_h_is_debug_addr(addr))
-    //    dbg_->debug(_L20_, "    MSHR::getFrontEvent(0x%" PRIx64 ")\n", addr);
     if (getFrontType(addr) != MSHREntryType::Event) {
         return nullptr;
     }
-    return mshr_.find(addr)->second.entries_.front().getEvent();
+    return entries_[findRegister(addr)->head_].entry_.getEvent();
 }
 
 MemEventBase* MSHR::getFirstEventEntry(Addr addr, Command cmd) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getFirstEventEntry(0x%" PRIx64 ", %s)\n", addr, CommandString[(int)cmd]);
-
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return nullptr;
 
-    for (std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin(); it != mshr_.find(addr)->second.entries_.end(); it++) {
-        if (it->getType() == MSHREntryType::Event && it->getEvent()->getCmd() == cmd)
-            return it->getEvent();
+    for (uint32_t pos = reg->head_; pos != NIL; pos = entries_[pos].next_) {
+        MSHREntry* entry = &entries_[pos].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getCmd() == cmd)
+            return entry->getEvent();
     }
     return nullptr;
 }
@@ -213,6 +396,7 @@ void MSHR::removeFlush() {
     if (flushes_.empty())
         dbg_->fatal(CALL_INFO, -1, "%s, Error: removeFlush. Flush queue is empty.\n", owner_name_.c_str());
     size_--;
+    release_count_++;
     if (flushes_.front()->getCmd() == Command::FlushAll)
         flush_all_in_mshr_count_--;
     printDebug(10, "RemFlush", 0, flushes_.front()->toString().c_str());
@@ -224,7 +408,7 @@ std::list<Addr>* MSHR::getEvictPointers(Addr addr) {
     if (getFrontType(addr) != MSHREntryType::Evict)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEvictPointers(0x%" PRIx64 "). Entry type is not Evict.\n", owner_name_.c_str(), addr);
 
-    return mshr_.find(addr)->second.entries_.front().getPointers();
+    return entries_[findRegister(addr)->head_].entry_.getPointers();
 }
 
 // Return whether we should retry a new event or not
@@ -238,21 +422,22 @@ bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
         printDebug(10, "RemPtr", addr, reason.str());
     }
 
+    MSHRAddrRegister* reg = findRegister(addr);
+
     // Sometimes we insert a WB before the Evict & then remove the Evict pointer, othertimes the Evict is front
     if (getFrontType(addr) == MSHREntryType::Evict) {
-        MSHREntry * entry = &(mshr_.find(addr)->second.entries_.front());
+        MSHREntry * entry = &entries_[reg->head_].entry_;
         entry->getPointers()->remove(addrPtr);
         if (entry->getPointers()->empty()) {
             removeFront(addr);
             return true;
         }
     } else {
-        std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-        it++;
-        if (it->getType() != MSHREntryType::Evict)
+        MSHREntry * entry = &entries_[entries_[reg->head_].next_].entry_;
+        if (entry->getType() != MSHREntryType::Evict)
             dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Entry type is not Evict.\n", owner_name_.c_str(), addr, addrPtr);
-        it->getPointers()->remove(addrPtr);
-        if (it->getPointers()->empty()) {
+        entry->getPointers()->remove(addrPtr);
+        if (entry->getPointers()->empty()) {
             removeEntry(addr, 1);
         }
     }
@@ -265,7 +450,7 @@ bool MSHR::pendingWriteback(Addr addr) {
 
 bool MSHR::pendingWritebackIsDowngrade(Addr addr) {
     if (pendingWriteback(addr))
-        return mshr_.find(addr)->second.entries_.front().getDowngrade();
+        return entries_[findRegister(addr)->head_].entry_.getDowngrade();
     return false;
 }
 
@@ -282,11 +467,11 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
     // Success
     size_++;
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = allocateRegister(addr);
+        pushBack(reg, MSHREntry(event, stallEvict, getCurrentSimCycle()));
 
-        mshr_.insert(std::make_pair(addr, reg));
         if (mem_h_is_debug_addr(addr)) {
             stringstream reason;
             reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=0";
@@ -296,18 +481,19 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
 
         return 0;
     } else {
-        if (pos == -1 || pos > mshr_.find(addr)->second.entries_.size()) {
-            mshr_.find(addr)->second.entries_.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+        if (pos == -1 || pos > reg->count_) {
+            pushBack(reg, MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (mem_h_is_debug_addr(addr)) {
                 stringstream reason;
-                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries_.size() - 1);
+                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->count_ - 1);
                 printDebug(10, "InsEv", addr, reason.str());
             }
-            return (mshr_.find(addr)->second.entries_.size() - 1);
+            return (reg->count_ - 1);
         } else {
-            std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries_.begin();
-            std::advance(it, pos);
-            mshr_.find(addr)->second.entries_.insert(it, MSHREntry(event, stallEvict, getCurrentSimCycle()));
+            if (pos == reg->count_)
+                pushBack(reg, MSHREntry(event, stallEvict, getCurrentSimCycle()));
+            else
+                insertBefore(reg, entryAt(reg, pos), MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (mem_h_is_debug_addr(addr)) {
                 stringstream reason;
                 reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << pos;
@@ -326,7 +512,8 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
  *      -1 = conflict, not inserted
  */
 int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
 
     if (size_ == max_size_-1) { /* Assuming fwdEvent == false */
@@ -338,61 +525,70 @@ int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
         return -1;
     }
     size_++;
-    mshr_.find(addr)->second.entries_.push_back(MSHREntry(event, false, getCurrentSimCycle()));
+    pushBack(reg, MSHREntry(event, false, getCurrentSimCycle()));
     if (mem_h_is_debug_addr(addr)) {
         stringstream reason;
-        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries_.size() - 1);
+        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->count_ - 1);
         printDebug(10, "InsEv", addr, reason.str());
     }
-    return (mshr_.find(addr)->second.entries_.size() - 1);
+    return (reg->count_ - 1);
 }
 
 MemEventBase* MSHR::swapFrontEvent(Addr addr, MemEventBase* event) {
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "SwpEv", addr, "");
 
-    if (mshr_.find(addr)->second.entries_.empty())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->count_ == 0)
         return nullptr;
 
-    return  mshr_.find(addr)->second.entries_.front().swapEvent(event, getCurrentSimCycle());
+    return entries_[reg->head_].entry_.swapEvent(event, getCurrentSimCycle());
 }
 
 void MSHR::moveEntryToFront(Addr addr, unsigned int index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Address doesn't exist in MSHR.\n", owner_name_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
-    if (reg->entries_.size() <= index) {
+    if (reg->count_ <= index) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Entry list is shorter than requested index.\n", owner_name_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries_.begin();
-    std::advance(entry, index);
-
-    MSHREntry tmpEntry = *entry;
+    uint32_t pos = entryAt(reg, index);
 
     if (mem_h_is_debug_addr(addr))
-        printDebug(10, "MvEnt", addr, entry->getString());
-    reg->entries_.erase(entry);
-    reg->entries_.push_front(tmpEntry);
+        printDebug(10, "MvEnt", addr, entries_[pos].entry_.getString());
+
+    if (pos == reg->head_)
+        return;
+
+    // Relink in place rather than copying the entry
+    uint32_t prev = entries_[pos].prev_;
+    uint32_t next = entries_[pos].next_;
+    entries_[prev].next_ = next;
+    if (next != NIL)
+        entries_[next].prev_ = prev;
+    else
+        reg->tail_ = prev;
+    entries_[pos].prev_ = NIL;
+    entries_[pos].next_ = reg->head_;
+    entries_[reg->head_].prev_ = pos;
+    reg->head_ = pos;
 }
 
 bool MSHR::insertWriteback(Addr addr, bool downgrade) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::insertWriteback(0x%" PRIx64 ")\n", addr);
-
     if (mem_h_is_debug_addr(addr)) {
         stringstream reason;
         reason << "Downgrade: " << (downgrade ? "T" : "F");
         printDebug(10, "InsWB", addr, reason.str());
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(downgrade, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = allocateRegister(addr);
+        pushBack(reg, MSHREntry(downgrade, getCurrentSimCycle()));
     } else {
-        mshr_.find(addr)->second.entries_.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
+        pushFront(reg, MSHREntry(downgrade, getCurrentSimCycle()));
     }
 
     return true;
@@ -400,25 +596,21 @@ bool MSHR::insertWriteback(Addr addr, bool downgrade) {
 
 
 bool MSHR::insertEviction(Addr oldAddr, Addr newAddr) {
-//    if (mem_h_is_debug_addr(oldAddr) || mem_h_is_debug_addr(newAddr))
-//        dbg_->debug(_L10_, "    MSHR::insertEviction(0x%" PRIx64 ", 0x%" PRIx64 ")\n", oldAddr, newAddr);
-
     if (mem_h_is_debug_addr(oldAddr) || mem_h_is_debug_addr(newAddr)) {
         stringstream reason;
         reason << "to 0x" << std::hex << newAddr;
         printDebug(10, "InsPtr", oldAddr, reason.str());
     }
 
-    if (mshr_.find(oldAddr) == mshr_.end()) {  // No MSHR entry for oldAddr
-        MSHRRegister reg;
-        reg.entries_.push_back(MSHREntry(newAddr, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(oldAddr, reg));
+    MSHRAddrRegister* reg = findRegister(oldAddr);
+    if (reg == nullptr) {  // No MSHR entry for oldAddr
+        reg = allocateRegister(oldAddr);
+        pushBack(reg, MSHREntry(newAddr, getCurrentSimCycle()));
     } else {
-        list<MSHREntry>* entries = &(mshr_.find(oldAddr)->second.entries_);
-        if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
-            entries->back().getPointers()->push_back(newAddr);
+        if (reg->count_ != 0 && entries_[reg->tail_].entry_.getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
+            entries_[reg->tail_].entry_.getPointers()->push_back(newAddr);
         } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
-            entries->push_back(MSHREntry(newAddr, getCurrentSimCycle()));
+            pushBack(reg, MSHREntry(newAddr, getCurrentSimCycle()));
         }
     }
     return true;
@@ -468,53 +660,53 @@ void MSHR::addPendingRetry(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "IncRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::addPendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.addPendingRetry();
+    reg->pending_retries_++;
 }
 
 void MSHR::removePendingRetry(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "DecRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removePendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.removePendingRetry();
+    reg->pending_retries_--;
 }
 
 uint32_t MSHR::getPendingRetries(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
 
-    return mshr_.find(addr)->second.getPendingRetries();
+    return reg->pending_retries_;
 }
 
 
 void MSHR::setInProgress(Addr addr, bool value) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setInProgress(0x%" PRIx64 ")\n", addr);
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "InProg", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setInProgress(value);
+    entries_[reg->head_].entry_.setInProgress(value);
 }
 
 bool MSHR::getInProgress(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
-        return false;
-    }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->count_ == 0) {
         return false;
     }
-    return mshr_.find(addr)->second.entries_.front().getInProgress();
+    return entries_[reg->head_].entry_.getInProgress();
 }
 
 void MSHR::setStalledForEvict(Addr addr, bool set) {
@@ -525,58 +717,59 @@ void MSHR::setStalledForEvict(Addr addr, bool set) {
             printDebug(20, "Unstall", addr, "");
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setStalledForEvict(set);
+    entries_[reg->head_].entry_.setStalledForEvict(set);
 }
 
 bool MSHR::getStalledForEvict(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->count_ == 0) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
-        return false;
-    }
-    return mshr_.find(addr)->second.entries_.front().getStalledForEvict();
+    return entries_[reg->head_].entry_.getStalledForEvict();
 }
 
 void MSHR::setProfiled(Addr addr) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries_.front().setProfiled();
+    entries_[reg->head_].entry_.setProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getProfiled(0x%" PRIx64 "\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Entry list is empty.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries_.front().getProfiled();
+    return entries_[reg->head_].entry_.getProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr, SST::Event::id_type id) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", owner_name_.c_str(), addr, id.first, id.second);
-    if (mshr_.find(addr)->second.entries_.empty())
+    if (reg->count_ == 0)
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", owner_name_.c_str(), addr, id.first, id.second);
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries_.begin(); jt != mshr_.find(addr)->second.entries_.end(); jt++) {
-        if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
-            return jt->getProfiled();
+    for (uint32_t pos = reg->head_; pos != NIL; pos = entries_[pos].next_) {
+        MSHREntry* entry = &entries_[pos].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getID() == id) {
+            return entry->getProfiled();
         }
     }
     return true; // default so we don't attempt to profile what isn't there
@@ -586,146 +779,147 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", owner_name_.c_str(), addr, id.first, id.second);
     }
-    if (mshr_.find(addr)->second.entries_.empty()) {
+    if (reg->count_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", owner_name_.c_str(), addr, id.first, id.second);
     }
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries_.begin(); jt != mshr_.find(addr)->second.entries_.end(); jt++) {
-        if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
-            jt->setProfiled();
+    for (uint32_t pos = reg->head_; pos != NIL; pos = entries_[pos].next_) {
+        MSHREntry* entry = &entries_[pos].entry_;
+        if (entry->getType() == MSHREntryType::Event && entry->getEvent()->getID() == id) {
+            entry->setProfiled();
             return;
         }
     }
 }
 
 MSHREntry* MSHR::getOldestEntry() {
-    bool first = false;
-    MSHREntry* entry = nullptr;
-    uint64_t time;
-
-    for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++) {
-        for (list<MSHREntry>::iterator jt = it->second.entries_.begin(); jt != it->second.entries_.end(); jt++) {
-            if (jt->getType() == MSHREntryType::Event) {
-                if (!first) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                } else if (jt->getStartTime() < time) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                }
+    MSHREntry* oldest = nullptr;
+
+    for (auto& slot : table_) {
+        if (slot.reg_ == NIL) continue;
+        for (uint32_t pos = registers_[slot.reg_].head_; pos != NIL; pos = entries_[pos].next_) {
+            MSHREntry* entry = &entries_[pos].entry_;
+            if (entry->getType() == MSHREntryType::Event) {
+                if (oldest == nullptr || entry->getStartTime() < oldest->getStartTime())
+                    oldest = entry;
             }
         }
     }
-    return entry;
+    return oldest;
 }
 
 void MSHR::incrementAcksNeeded(Addr addr) {
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::incrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = allocateRegister(addr);
     }
-    mshr_.find(addr)->second.acks_needed_++;
+    reg->acks_needed_++;
 
     if (mem_h_is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acks_needed_ << " acks";
+        reason << reg->acks_needed_ << " acks";
         printDebug(10, "IncAck", addr, reason.str());
     }
 }
 
 /* Decrement acks needed and return if we're done waiting (acks_needed_ == 0) */
 bool MSHR::decrementAcksNeeded(Addr addr) {
-   // if (mem_h_is_debug_addr(addr))
-   //     dbg_->debug(_L10_, "    MSHR::decrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.acks_needed_ == 0) {
+    if (reg->acks_needed_ == 0) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). AcksNeeded is already 0.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.acks_needed_--;
+    reg->acks_needed_--;
 
     if (mem_h_is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acks_needed_ << " acks";
+        reason << reg->acks_needed_ << " acks";
         printDebug(10, "DecAck", addr, reason.str());
     }
 
-    return (mshr_.find(addr)->second.acks_needed_ == 0);
+    return (reg->acks_needed_ == 0);
 }
 
 uint32_t MSHR::getAcksNeeded(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         return 0;
     }
-    return (mshr_.find(addr)->second.acks_needed_);
+    return reg->acks_needed_;
 }
 
 void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
+    }
+
+    if (mem_h_is_debug_addr(addr))
+        printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
+
+    reg->data_buffer_ = data;
+    reg->data_dirty_ = dirty;
+}
+
+void MSHR::setData(Addr addr, const PayloadBuffer& data, bool dirty) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
 
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
-    mshr_.find(addr)->second.data_buffer_ = data;
-    mshr_.find(addr)->second.data_dirty_ = dirty;
+    reg->data_buffer_.assign(data.data(), data.data() + data.size());
+    reg->data_dirty_ = dirty;
 }
 
 void MSHR::clearData(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::clearData(0x%" PRIx64 ")\n", addr);
     if (mem_h_is_debug_addr(addr))
         printDebug(10, "ClrData", addr, "");
 
-    mshr_.find(addr)->second.data_buffer_.clear();
-    mshr_.find(addr)->second.data_dirty_ = false;
+    MSHRAddrRegister* reg = findRegister(addr);
+    reg->data_buffer_.clear();
+    reg->data_dirty_ = false;
 }
 
 vector<uint8_t>& MSHR::getData(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getData(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.data_buffer_;
+    return reg->data_buffer_;
 }
 
 bool MSHR::hasData(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return false;
-    return !(mshr_.find(addr)->second.data_buffer_.empty());
+    return !(reg->data_buffer_.empty());
 }
 
 bool MSHR::getDataDirty(Addr addr) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L20_, "    MSHR::getDataDirty(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.data_dirty_;
+    return reg->data_dirty_;
 }
 
 void MSHR::setDataDirty(Addr addr, bool dirty) {
-//    if (mem_h_is_debug_addr(addr))
-//        dbg_->debug(_L10_, "    MSHR::setDataDirty(0x%" PRIx64 ")\n", addr);
-
     if (mem_h_is_debug_addr(addr))
         printDebug(20, "SetDirt", addr, (dirty ? "Dirty" : "Clean"));
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRAddrRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         dbg_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", owner_name_.c_str(), addr);
     }
-    mshr_.find(addr)->second.data_dirty_ = dirty;
+    reg->data_dirty_ = dirty;
 
 }
 
@@ -751,19 +945,44 @@ void MSHR::printDebug(uint32_t lev, std::string action, Addr addr, std::string r
 // Print status. Called by cache controller on EmergencyShutdown and printStatus()
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\b", owner_name_.c_str(), size_, prefetch_count_);
-    for (std::map<Addr,MSHRRegister>::iterator it = mshr_.begin(); it != mshr_.end(); it++) {   // Iterate over addresses
-        out.output("      Entry: Addr = 0x%" PRIx64 "\n", (it->first));
-        for (std::list<MSHREntry>::iterator it2 = it->second.entries_.begin(); it2 != it->second.entries_.end(); it2++) { // Iterate over entries for each address
-            out.output("        %s\n", it2->getString().c_str());
+    std::vector<Addr> addrs;    // Print in address order
+    for (auto& slot : table_) {
+        if (slot.reg_ != NIL)
+            addrs.push_back(slot.addr_);
+    }
+    std::sort(addrs.begin(), addrs.end());
+    for (Addr addr : addrs) {   // Iterate over addresses
+        out.output("      Entry: Addr = 0x%" PRIx64 "\n", addr);
+        for (uint32_t pos = findRegister(addr)->head_; pos != NIL; pos = entries_[pos].next_) { // Iterate over entries for each address
+            out.output("        %s\n", entries_[pos].entry_.getString().c_str());
         }
     }
     out.output("    End MSHR Status for %s\n", owner_name_.c_str());
 }
 
+/*
+ * Checkpoints use the ordered MSHRBlock form so that the checkpoint layout does not depend on
+ * the table or pool layout. The table and pools are rebuilt on restart.
+ */
 void MSHR::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST::ComponentExtension::serialize_order(ser);
 
-    SST_SER(mshr_);
+    MSHRBlock mshr;
+    if (ser.mode() != SST::Core::Serialization::serializer::UNPACK) {
+        for (auto& slot : table_) {
+            if (slot.reg_ == NIL) continue;
+            MSHRAddrRegister* reg = &registers_[slot.reg_];
+            MSHRRegister& out = mshr[slot.addr_];
+            for (uint32_t pos = reg->head_; pos != NIL; pos = entries_[pos].next_)
+                out.entries_.push_back(entries_[pos].entry_);
+            out.acks_needed_ = reg->acks_needed_;
+            out.data_buffer_ = reg->data_buffer_;
+            out.data_dirty_ = reg->data_dirty_;
+            out.pending_retries_ = reg->pending_retries_;
+        }
+    }
+
+    SST_SER(mshr);
     SST_SER(flushes_);
     SST_SER(flush_all_in_mshr_count_);
     SST_SER(flush_acks_needed_);
@@ -771,6 +990,20 @@ void MSHR::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(size_);
     SST_SER(max_size_);
     SST_SER(prefetch_count_);
+    SST_SER(release_count_);
     SST_SER(owner_name_);
     SST_SER(debug_addr_filter_);
+
+    if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+        initStorage();
+        for (auto& it : mshr) {
+            MSHRAddrRegister* reg = allocateRegister(it.first);
+            for (auto& entry : it.second.entries_)
+                pushBack(reg, entry);
+            reg->acks_needed_ = it.second.acks_needed_;
+            reg->data_buffer_ = it.second.data_buffer_;
+            reg->data_dirty_ = it.second.data_dirty_;
+            reg->pending_retries_ = it.second.pending_retries_;
+        }
+    }
 }
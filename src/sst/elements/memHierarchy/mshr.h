@@ -17,7 +17,8 @@
 #define _MSHR_H_
 
 #include <list>
-
+#include <deque>
+#include <vector>
 #include <map>
 #include <string>
 #include <sstream>
@@ -180,6 +181,10 @@ public:
         bool downgrade_ = false;        // Specific to Writeback type
 };
 
+/*
+ * Ordered form of an address's MSHR state. The MSHR stores its state in pooled storage
+ * (see MSHRAddrRegister) but converts to and from this form for checkpoints.
+ */
 struct MSHRRegister {
     MSHRRegister() { }
     list<MSHREntry> entries_;
@@ -203,6 +208,25 @@ struct MSHRRegister {
 
 typedef map<Addr, MSHRRegister> MSHRBlock;
 
+/* An entry in the MSHR's entry pool. An address's entries are linked in order through the pool. */
+struct MSHRPoolEntry {
+    MSHREntry entry_;
+    uint32_t prev_;
+    uint32_t next_;
+};
+
+/* Per-address MSHR state, allocated from the MSHR's register pool */
+struct MSHRAddrRegister {
+    Addr addr_ = 0;
+    uint32_t head_;                 // First entry in the entry pool
+    uint32_t tail_;                 // Last entry in the entry pool
+    uint32_t count_ = 0;            // Number of entries for this address
+    uint32_t acks_needed_ = 0;
+    vector<uint8_t> data_buffer_;
+    bool data_dirty_ = false;
+    uint32_t pending_retries_ = 0;
+};
+
 /**
  *  Implements an MSHR with entries of type mshrEntry
  */
@@ -224,6 +248,10 @@ public:
     /* Return the size of the flush queue */
     int getFlushSize();
 
+    /* Return the number of times an entry that counts against max_size_ has been released.
+     * Owners compare successive values to detect that capacity may have become available. */
+    uint64_t getReleaseCount() { return release_count_; }
+
     /* Return whether an address exists in the MSHR (i.e., current outstanding events for that address) */
     bool exists(Addr addr);
 
@@ -312,6 +340,7 @@ public:
 
 // Functions to manage temporary data storage for an address
     void setData(Addr addr, vector<uint8_t>& data, bool dirty = false);
+    void setData(Addr addr, const PayloadBuffer& data, bool dirty = false);
     void clearData(Addr addr);
     vector<uint8_t>& getData(Addr addr);
     bool hasData(Addr addr);
@@ -330,7 +359,41 @@ private:
 
     void printDebug(uint32_t level, std::string action, Addr addr, std::string reason);
 
-    MSHRBlock mshr_;                                    // MSHR maps each address to a list of events/evictions/etc
+    /* Address table and pool management */
+    static const uint32_t NIL = 0xFFFFFFFF;
+    void initStorage();
+    size_t hashSlot(Addr addr) const;
+    MSHRAddrRegister* findRegister(Addr addr);
+    MSHRAddrRegister* allocateRegister(Addr addr);
+    void eraseRegister(Addr addr);
+    void growTable();
+
+    /* Per-address entry list management */
+    uint32_t entryAt(MSHRAddrRegister* reg, size_t index);
+    uint32_t allocateEntry(const MSHREntry& entry);
+    void pushBack(MSHRAddrRegister* reg, const MSHREntry& entry);
+    void pushFront(MSHRAddrRegister* reg, const MSHREntry& entry);
+    void insertBefore(MSHRAddrRegister* reg, uint32_t pos, const MSHREntry& entry);
+    void unlinkEntry(MSHRAddrRegister* reg, uint32_t pos);
+
+    /* MSHR maps each address to a list of events/evictions/etc
+     * Addresses are kept in an open-addressed (linear probing) table whose capacity is sized from max_size_,
+     * and both the per-address registers and the entries are taken from pools that are preallocated at
+     * construction and reused, so a miss does not allocate. Pools are deques so that pointers to registers
+     * and entries stay valid if a pool has to grow.
+     */
+    struct MSHRSlot {
+        Addr addr_;
+        uint32_t reg_;  // Index into registers_, NIL if the slot is empty
+    };
+    std::vector<MSHRSlot> table_;
+    unsigned int table_bits_ = 0;                       // log2(table_.size())
+    size_t table_count_ = 0;                            // Number of addresses in table_
+    std::deque<MSHRAddrRegister> registers_;            // Register pool
+    std::vector<uint32_t> free_registers_;
+    std::deque<MSHRPoolEntry> entries_;                 // Entry pool
+    std::vector<uint32_t> free_entries_;
+
     std::list<MemEventBase*> flushes_;                  // Flushes are not linked to a particular address so are stored outside the mshr_ structure
     int flush_all_in_mshr_count_ = 0;                   // Number of FlushAll (vs ForwardFlush) in the flushes_ list
     int flush_acks_needed_ = 0;                         // Number of things that need to complete before flush can retry
@@ -338,6 +401,7 @@ private:
     int size_ = 0;                                      // Current entries in mshr_ + flushes_
     int max_size_ = 0;                                  // Size limit for mshr_ + flushes_
     int prefetch_count_ = 0;                            // Number of prefetches in mshr_
+    uint64_t release_count_ = 0;                        // Number of entries released from mshr_ + flushes_
     string owner_name_ = "";                            // Name of owning component
     std::set<Addr> debug_addr_filter_;                          // Which addresses to print debug info for (empty = all)
 };
@@ -26,6 +26,32 @@ using namespace std;
 namespace SST {
 namespace MemHierarchy {
 
+/*
+ * Dense, line-indexed copy of the state that replacement policies rank lines on.
+ * Lines are numbered set-major (set * associativity + way) so the state for one set is contiguous.
+ * ReplacementInfo objects that are bound to an array write their state through to it, which lets
+ * a policy select a victim in a single linear pass over the set instead of dereferencing one
+ * ReplacementInfo per way.
+ */
+class ReplacementStateArray {
+    public:
+        void resize(uint64_t lines) {
+            state.resize(lines, I);
+            shared.resize(lines, 0);
+            owned.resize(lines, 0);
+        }
+
+        std::vector<State>   state;
+        std::vector<uint8_t> shared;
+        std::vector<uint8_t> owned;
+
+        void serialize_order(SST::Core::Serialization::serializer& ser) {
+            SST_SER(state);
+            SST_SER(shared);
+            SST_SER(owned);
+        }
+};
+
 /*
  * Generic/extendable class for passing information between a cache line & a replacement policy
  * To date the coherence policies in memHierarchy only use cache line state and sometimes owned/shared information
@@ -40,11 +66,21 @@ class ReplacementInfo : public SST::Core::Serialization::serializable {
         void setIndex(unsigned int i) { index = i; }
 
         State getState() { return state; }
-        void setState(State s) { state = s; }
+        void setState(State s) {
+            state = s;
+            if (dense) dense->state[index] = s;
+        }
+
+        virtual void reset() { setState(I); }
 
-        virtual void reset() { state = I; }
+        /* Mirror this line's state into a policy's dense state array from now on */
+        virtual void bind(ReplacementStateArray* array) {
+            dense = array;
+            dense->state[index] = state;
+        }
 
         ReplacementInfo() { }
+        /* The dense array binding is not serialized, the policy re-binds on restart */
         virtual void serialize_order(SST::Core::Serialization::serializer& ser) override {
             SST_SER(index);
             SST_SER(state);
@@ -54,6 +90,7 @@ class ReplacementInfo : public SST::Core::Serialization::serializable {
     protected:
         unsigned int index;
         State state;
+        ReplacementStateArray* dense = nullptr;
 };
 
 class CoherenceReplacementInfo : public ReplacementInfo {
@@ -63,12 +100,24 @@ class CoherenceReplacementInfo : public ReplacementInfo {
 
         bool getOwned() { return owned; }
         bool getShared() { return shared; }
-        void setOwned(bool o) { owned = o; }
-        void setShared(bool s) { shared = s; }
+        void setOwned(bool o) {
+            owned = o;
+            if (dense) dense->owned[index] = o;
+        }
+        void setShared(bool s) {
+            shared = s;
+            if (dense) dense->shared[index] = s;
+        }
         void reset() override {
             ReplacementInfo::reset();
-            owned = false;
-            shared = false;
+            setOwned(false);
+            setShared(false);
+        }
+
+        void bind(ReplacementStateArray* array) override {
+            ReplacementInfo::bind(array);
+            dense->shared[index] = shared;
+            dense->owned[index] = owned;
         }
 
         CoherenceReplacementInfo() { }
@@ -89,13 +138,22 @@ class ReplacementPolicy : public SubComponent{
     public:
         SST_ELI_REGISTER_SUBCOMPONENT_API(SST::MemHierarchy::ReplacementPolicy, uint64_t, uint64_t)
 
-        ReplacementPolicy(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SubComponent(id) { }
+        ReplacementPolicy(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SubComponent(id), set_ways_(associativity) {
+            line_state_.resize(lines);
+            line_info_.resize(lines, nullptr);
+        }
 
         virtual ~ReplacementPolicy() = default;
 
         /* Since we don't dynamic cast ReplacementInfo, do a check here to make sure the type provided by the cache line & the type the replacement policy expects are compatible */
         virtual bool checkCompatibility(ReplacementInfo * rInfo) = 0;
 
+        /* Bind a line's replacement info to this policy's dense state. Caches call this once per line. */
+        void bindReplacementInfo(ReplacementInfo * rInfo) {
+            line_info_[rInfo->getIndex()] = rInfo;
+            rInfo->bind(&line_state_);
+        }
+
         // Update state
         virtual void update(uint64_t id, ReplacementInfo * rInfo) = 0;
         virtual void replaced(uint64_t id) = 0;
@@ -104,11 +162,33 @@ class ReplacementPolicy : public SubComponent{
         virtual uint64_t getBestCandidate() = 0;
         virtual uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) = 0;
 
+        /* Select a victim from a set of bound lines. Policies in this file override this to scan
+         * the dense state directly; the default gathers the set's ReplacementInfo for findBestCandidate() */
+        virtual uint64_t findSetCandidate(uint64_t set) {
+            auto begin = line_info_.begin() + set * set_ways_;
+            set_info_.assign(begin, begin + set_ways_);
+            return findBestCandidate(set_info_);
+        }
+
         ReplacementPolicy() = default;
         void serialize_order(SST::Core::Serialization::serializer& ser) override {
             SST::SubComponent::serialize_order(ser);
+            SST_SER(set_ways_);
+            SST_SER(line_state_);
+            SST_SER(line_info_);
+            if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+                for (auto info : line_info_) {
+                    if (info) info->bind(&line_state_);
+                }
+            }
         }
         ImplementVirtualSerializable(SST::MemHierarchy::ReplacementPolicy);
+
+    protected:
+        uint64_t set_ways_;
+        ReplacementStateArray line_state_;                 // Line state, indexed by line
+        std::vector<ReplacementInfo*> line_info_;         // Bound ReplacementInfo, indexed by line
+        std::vector<ReplacementInfo*> set_info_;          // Scratch space for findSetCandidate()
 };
 
 /* ------------------------------------------------------------------------------------------
@@ -162,6 +242,25 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        bestCandidate = begin;
+        uint64_t bestTS = array[begin];
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            if (array[i] < bestTS) {
+                bestTS = array[i];
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     LRU() = default;
@@ -242,6 +341,28 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        const uint8_t* shared = line_state_.shared.data();
+        const uint8_t* owned = line_state_.owned.data();
+        bestCandidate = begin;
+        Rank bestRank = {array[begin], (bool)shared[begin], (bool)owned[begin], state[begin]};
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            Rank candRank = {array[i], (bool)shared[i], (bool)owned[i], state[i]};
+            if (candRank.lessThan(bestRank)) {
+                bestRank = candRank;
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     LRUOpt() = default;
@@ -332,6 +453,25 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        bestCandidate = begin;
+        LFUInfo bestLFU = array[begin];
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            if (array[i].lessThan(bestLFU, timestamp)) {
+                bestLFU = array[i];
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     void replaced(uint64_t id) override { array[id].acc = 0; }
@@ -429,6 +569,28 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        const uint8_t* shared = line_state_.shared.data();
+        const uint8_t* owned = line_state_.owned.data();
+        bestCandidate = begin;
+        Rank bestRank = {array[begin], (bool)shared[begin], (bool)owned[begin], state[begin]};
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            Rank candRank = {array[i], (bool)shared[i], (bool)owned[i], state[i]};
+            if (candRank.lessThan(bestRank, timestamp)) {
+                bestRank = candRank;
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     void replaced(uint64_t id) override { array[id].acc = 0; }
@@ -569,6 +731,26 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        bestCandidate = begin;
+        Rank bestRank = {array[begin], state[begin]};
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            Rank candRank = {array[i], state[i]};
+            if (candRank.biggerThan(bestRank)) {
+                bestRank = candRank;
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate;}
 
     MRU() {}
@@ -666,6 +848,28 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        const uint8_t* shared = line_state_.shared.data();
+        const uint8_t* owned = line_state_.owned.data();
+        bestCandidate = begin;
+        Rank bestRank = {array[begin], (bool)shared[begin], (bool)owned[begin], state[begin]};
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+            Rank candRank = {array[i], (bool)shared[i], (bool)owned[i], state[i]};
+            if (candRank.biggerThan(bestRank)) {
+                bestRank = candRank;
+                bestCandidate = i;
+            }
+        }
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     MRUOpt() {}
@@ -727,6 +931,20 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+        }
+        bestCandidate = begin + (gen->generateNextUInt64() % ways);
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     Random() {}
@@ -805,6 +1023,25 @@ public:
         return bestCandidate;
     }
 
+    uint64_t findSetCandidate(uint64_t set) override {
+        const uint64_t begin = set * ways;
+        const uint64_t end = begin + ways;
+        const State* state = line_state_.state.data();
+        for (uint64_t i = begin; i < end; i++) {
+            if (state[i] == I) {
+                bestCandidate = i;
+                return bestCandidate;
+            }
+        }
+        uint64_t index = gen->generateNextUInt64() % (ways-1);
+        if (index < array[set])
+            bestCandidate = begin + index;
+        else
+            bestCandidate = begin + index + 1;
+
+        return bestCandidate;
+    }
+
     uint64_t getBestCandidate() override { return bestCandidate; }
 
     NMRU() = default;
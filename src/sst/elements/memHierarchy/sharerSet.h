@@ -0,0 +1,196 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SHARERSET_H
+#define MEMHIERARCHY_SHARERSET_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+#include <sst/core/serialization/serializable.h>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Maps the name of each endpoint that can hold a copy of a block to a dense index.
+ * Owners (directories and shared caches) populate it from their sources at setup().
+ * A name that was not known at setup() is assigned the next free index the first time it is seen.
+ * A single SharerIndex is shared by all of an owner's entries so that sharers can be stored as bits.
+ */
+class SharerIndex : public SST::Core::Serialization::serializable {
+public:
+    static const uint32_t NONE = 0xFFFFFFFF;
+
+    SharerIndex() = default;
+
+    uint32_t getIndex(const std::string& name) {
+        auto it = index_.find(name);
+        if (it != index_.end())
+            return it->second;
+        uint32_t idx = names_.size();
+        names_.push_back(name);
+        index_.insert(std::make_pair(name, idx));
+        return idx;
+    }
+
+    /* Look up a name without assigning it an index */
+    uint32_t findIndex(const std::string& name) const {
+        auto it = index_.find(name);
+        return it == index_.end() ? NONE : it->second;
+    }
+
+    const std::string& getName(uint32_t idx) const { return names_[idx]; }
+
+    size_t size() const { return names_.size(); }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        SST_SER(names_);
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            for (uint32_t i = 0; i < names_.size(); i++)
+                index_.insert(std::make_pair(names_[i], i));
+        }
+    }
+    ImplementSerializable(SST::MemHierarchy::SharerIndex)
+
+private:
+    std::vector<std::string> names_;
+    std::unordered_map<std::string, uint32_t> index_;
+};
+
+/*
+ * Set of sharer indices stored as a bitset
+ * The first 64 indices are held inline; larger systems spill to a vector that is only allocated when needed.
+ */
+class SharerSet {
+public:
+    SharerSet() = default;
+
+    bool contains(uint32_t idx) const {
+        if (idx < 64)
+            return (bits_ >> idx) & 1;
+        size_t word = (idx >> 6) - 1;
+        return word < more_.size() && ((more_[word] >> (idx & 63)) & 1);
+    }
+
+    void add(uint32_t idx) {
+        uint64_t* word = getWord(idx, true);
+        uint64_t mask = (uint64_t)1 << (idx & 63);
+        if (!(*word & mask)) {
+            *word |= mask;
+            count_++;
+        }
+    }
+
+    void remove(uint32_t idx) {
+        uint64_t* word = getWord(idx, false);
+        uint64_t mask = (uint64_t)1 << (idx & 63);
+        if (word && (*word & mask)) {
+            *word &= ~mask;
+            count_--;
+        }
+    }
+
+    void clear() {
+        bits_ = 0;
+        more_.clear();
+        count_ = 0;
+    }
+
+    size_t size() const { return count_; }
+    bool empty() const { return count_ == 0; }
+
+    /* Lowest index in the set, SharerIndex::NONE if empty */
+    uint32_t first() const { return next(0); }
+
+    /* Lowest index in the set that is >= idx, SharerIndex::NONE if there is none */
+    uint32_t next(uint32_t idx) const {
+        if (idx < 64) {
+            uint64_t w = bits_ & (~(uint64_t)0 << idx);
+            if (w)
+                return __builtin_ctzll(w);
+            idx = 64;
+        }
+        for (size_t word = (idx >> 6) - 1; word < more_.size(); word++) {
+            uint64_t w = more_[word];
+            if (word == (idx >> 6) - 1)
+                w &= ~(uint64_t)0 << (idx & 63);
+            if (w)
+                return ((word + 1) << 6) + __builtin_ctzll(w);
+        }
+        return SharerIndex::NONE;
+    }
+
+    /*
+     * Iterates the names of the sharers in the set, in index order
+     * e.g., for (auto& name : line->getSharers()) { ... }
+     */
+    class Names {
+    public:
+        class iterator {
+        public:
+            iterator(const SharerSet* set, const SharerIndex* index, uint32_t pos) : set_(set), index_(index), pos_(pos) {}
+            const std::string& operator*() const { return index_->getName(pos_); }
+            iterator& operator++() { pos_ = set_->next(pos_ + 1); return *this; }
+            bool operator==(const iterator& o) const { return pos_ == o.pos_; }
+            bool operator!=(const iterator& o) const { return pos_ != o.pos_; }
+        private:
+            const SharerSet* set_;
+            const SharerIndex* index_;
+            uint32_t pos_;
+        };
+
+        Names(const SharerSet* set, const SharerIndex* index) : set_(set), index_(index) {}
+        iterator begin() const { return iterator(set_, index_, set_->first()); }
+        iterator end() const { return iterator(set_, index_, SharerIndex::NONE); }
+        size_t size() const { return set_->size(); }
+        bool empty() const { return set_->empty(); }
+    private:
+        const SharerSet* set_;
+        const SharerIndex* index_;
+    };
+
+    Names names(const SharerIndex* index) const { return Names(this, index); }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) {
+        SST_SER(bits_);
+        SST_SER(more_);
+        SST_SER(count_);
+    }
+
+private:
+    uint64_t* getWord(uint32_t idx, bool alloc) {
+        if (idx < 64)
+            return &bits_;
+        size_t word = (idx >> 6) - 1;
+        if (word >= more_.size()) {
+            if (!alloc)
+                return nullptr;
+            more_.resize(word + 1, 0);
+        }
+        return &more_[word];
+    }
+
+    uint64_t bits_ = 0;             // Indices 0-63
+    std::vector<uint64_t> more_;    // Indices 64+
+    uint32_t count_ = 0;
+};
+
+}
+}
+
+#endif // MEMHIERARCHY_SHARERSET_H
@@ -176,25 +176,24 @@ void StandardInterface::init(unsigned int phase) {
                     break;
                 case Command::GetS:
                     recv_req = new StandardMem::Read(memEvent->getAddr(), memEvent->getSize());
-                    responses_[recv_req->getID()] = memEvent;
+                    responses_.insert(recv_req->getID(), memEvent);
                     init_recv_queue_.push(recv_req);
                     break;
                 case Command::GetX:
                     recv_req = new StandardMem::Write(memEvent->getAddr(), memEvent->getSize(), memEvent->getPayload(), true);
-                    responses_[recv_req->getID()] = memEvent;
+                    responses_.insert(recv_req->getID(), memEvent);
                     init_recv_queue_.push(recv_req);
                     break;
                 case Command::GetSResp:
                 case Command::GetXResp:
                 {
                     MemEventBase::id_type orig_id = memEvent->getResponseToID();
-                    std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(orig_id);
-                    if (reqit == requests_.end()) {
+                    std::pair<StandardMem::Request*,Command> orig;
+                    if (!requests_.remove(orig_id, orig)) {
                         output_.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                             getName().c_str(), memEvent->getVerboseString(debug_level_).c_str());
                     }
-                    recv_req = reqit->second.first;
-                    requests_.erase(reqit);
+                    recv_req = orig.first;
 
                     // Construct StandardMem::ReadResp
                     StandardMem::ReadResp* resp = static_cast<StandardMem::ReadResp*>(recv_req->makeResponse());
@@ -284,7 +283,7 @@ void StandardInterface::send(StandardMem::Request* req) {
 #endif
 
     if (req->needsResponse())
-        requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
+        requests_.insert(me->getID(), std::make_pair(req,me->getCmd()));   /* Save this request so we can use it when a response is returned */
     else
         delete req;
 #ifdef __SST_DEBUG_OUTPUT__
@@ -320,7 +319,7 @@ void StandardInterface::handleTLBResponse(uintptr_t request_id, Addr physical_ad
 #endif
 
         if (req->needsResponse())
-            requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
+            requests_.insert(me->getID(), std::make_pair(req,me->getCmd()));   /* Save this request so we can use it when a response is returned */
         else
             delete req;
 
@@ -354,16 +353,15 @@ void StandardInterface::receive(SST::Event* ev) {
     /* Handle responses to requests we sent */
     if (isResponse) {
         MemEventBase::id_type origID = me->getResponseToID();
-        std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(origID);
-        if (reqit == requests_.end()) {
+        std::pair<StandardMem::Request*,Command> orig;
+        if (!requests_.remove(origID, orig)) {
             output_.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                 getName().c_str(), me->getVerboseString(debug_level_).c_str());
         }
-        StandardMem::Request* origReq = reqit->second.first;
-        Command origCmd = reqit->second.second;
+        StandardMem::Request* origReq = orig.first;
+        Command origCmd = orig.second;
         if (origCmd == Command::GetS || origCmd == Command::GetSX)
             cmd = Command::GetSResp;
-        requests_.erase(reqit);
         switch (cmd) {
             case Command::GetSResp:
                 deliverReq = convertResponseGetSResp(origReq, me);
@@ -435,7 +433,7 @@ void StandardInterface::receive(SST::Event* ev) {
                     getName().c_str(), CommandString[(int)cmd], me->getVerboseString(debug_level_).c_str());
         };
         if (deliverReq->needsResponse()) /* Endpoint will need to send a response to this */
-            responses_[deliverReq->getID()] = me;
+            responses_.insert(deliverReq->getID(), me);
         else
             delete me;
     }
@@ -776,11 +774,10 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req
 
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase* match = nullptr;
+    if (!iface->responses_.remove(resp->getID(), match))
         iface->output_.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(match); // Matching memEvent req
     MemEvent* meresp = mereq->makeResponse();
     meresp->setPayload(resp->data);
     if (!resp->getSuccess()) {
@@ -791,11 +788,10 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp*
 
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase* match = nullptr;
+    if (!iface->responses_.remove(resp->getID(), match))
         iface->output_.fatal(CALL_INFO, -1, "%s, Error: Handling a WriteResp but no matching Write found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(match); // Matching memEvent req
     MemEvent* meresp = mereq->makeResponse();
     if (!resp->getSuccess()) {
         meresp->setFail();
@@ -828,18 +824,16 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::InvNotify
 
 SST::Event* StandardInterface::UntimedMemEventConverter::convert(StandardMem::Read* req) {
     MemEventInit *me = new MemEventInit(iface->getName(), Command::GetS, req->pAddr, req->size);
-    iface->requests_[me->getID()] = std::make_pair(req,me->getCmd());   /* Save this request so we can use it when a response is returned */
+    iface->requests_.insert(me->getID(), std::make_pair(req,me->getCmd()));   /* Save this request so we can use it when a response is returned */
     return me;
 }
 
 
 SST::Event* StandardInterface::UntimedMemEventConverter::convert(StandardMem::ReadResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase* match = nullptr;
+    if (!iface->responses_.remove(resp->getID(), match))
         iface->output_.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-
-    MemEventInit* req = static_cast<MemEventInit*>(it->second);
-    iface->responses_.erase(it);
+    MemEventInit* req = static_cast<MemEventInit*>(match);
 
     MemEventInit* meresp = req->makeResponse();
     meresp->setPayload(resp->data);
@@ -934,12 +928,13 @@ SST::Event* StandardInterface::UntimedMemEventConverter::convert(StandardMem::In
 StandardMem::Request* StandardInterface::convertResponseGetSResp(StandardMem::Request* req, MemEventBase* meb) {
     MemEvent* me = static_cast<MemEvent*>(meb);
     StandardMem::ReadResp* resp = static_cast<StandardMem::ReadResp*>(req->makeResponse());
+    /* Copy out of the event's buffer so that the buffer is recycled when the event is deleted */
+    const PayloadBuffer& payload = me->getPayloadBuffer();
     if (resp->size == me->getSize()) {
-        resp->data = me->getPayload();
+        resp->data.assign(payload.data(), payload.data() + payload.size());
     } else { // Need to extract just the relevant bit of the payload
         Addr offset = me->getAddr() - me->getBaseAddr();
-        auto payload = me->getPayload();
-        resp->data.assign(payload.begin() + offset, payload.begin() + offset + resp->size);
+        resp->data.assign(payload.data() + offset, payload.data() + offset + resp->size);
     }
     if (!me->success()) {
         resp->setFail();
@@ -29,6 +29,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/idMap.h"
 #include "sst/elements/mmu/tlb.h"
 
 namespace SST {
@@ -133,8 +134,8 @@ protected:
     Addr        base_addr_mask_;
     Addr        line_size_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
-    std::map<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
+    IdMap<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
+    IdMap<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
     SST::MemHierarchy::MemLinkBase*  link_;
     bool cache_is_dst_; // Whether we've got a cache below us to handle certain conversions or we need to do it ourselves
 
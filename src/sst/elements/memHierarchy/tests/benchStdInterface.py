@@ -0,0 +1,56 @@
+import sst
+import sys
+
+# Microbenchmark for per-request overhead in memHierarchy.standardInterface
+#
+# Each core is connected through a standardInterface directly to its own memory controller.
+# The controller has no backing store and a near-zero latency backend, so almost all of the
+# simulation's wall time is spent creating, tracking, and converting requests and responses
+# at the interface. Compare the wall time reported by 'sst --print-timing-info' across builds.
+#
+# Usage:
+#   sst --print-timing-info benchStdInterface.py
+#
+# Optional arguments: <cores> <ops_per_core> <max_outstanding>
+
+cores = 4
+ops = 1000000
+outstanding = 64
+
+if len(sys.argv) > 1:
+    cores = int(sys.argv[1])
+if len(sys.argv) > 2:
+    ops = int(sys.argv[2])
+if len(sys.argv) > 3:
+    outstanding = int(sys.argv[3])
+
+for x in range(cores):
+    cpu = sst.Component("core" + str(x), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "clock" : "2GHz",
+        "rngseed" : 3 + x,
+        "memFreq" : 1,
+        "memSize" : "1GiB",
+        "maxOutstanding" : outstanding,
+        "opCount" : ops,
+        "reqsPerIssue" : 4,
+        "write_freq" : 40,
+        "read_freq" : 60,
+        "verbose" : 0,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    memctrl = sst.Component("memory" + str(x), "memHierarchy.MemController")
+    memctrl.addParams({
+        "clock" : "2GHz",
+        "backing" : "none",
+        "addr_range_end" : 1024*1024*1024-1,
+    })
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+    memory.addParams({
+        "access_time" : "1ps",
+        "mem_size" : "1GiB",
+    })
+
+    link = sst.Link("link_cpu_mem_" + str(x))
+    link.connect( (iface, "lowlink", "100ps"), (memctrl, "highlink", "100ps") )
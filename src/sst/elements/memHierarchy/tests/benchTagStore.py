@@ -0,0 +1,111 @@
+import sst
+import sys
+from mhlib import componentlist
+
+# Benchmark for the cache tag store layouts ('tag_store' cache parameter)
+#
+# Runs a set of cores, each with a private MESI L1, sharing a highly-associative
+# non-inclusive L2 with a directory (MESI_Shared_Noninclusive). Both layouts simulate
+# identically, so the statistics output of the two runs should match; compare the wall
+# time reported by 'sst --print-timing-info'.
+#
+# Usage:
+#   sst --print-timing-info benchTagStore.py -- pointer
+#   sst --print-timing-info benchTagStore.py -- contiguous
+#
+# Optional arguments: <tag_store> <cores> <l1_associativity> <l2_associativity> <ops_per_core>
+
+tag_store = "pointer"
+cores = 4
+l1_assoc = 16
+l2_assoc = 32
+ops = 200000
+
+if len(sys.argv) > 1:
+    tag_store = sys.argv[1]
+if len(sys.argv) > 2:
+    cores = int(sys.argv[2])
+if len(sys.argv) > 3:
+    l1_assoc = int(sys.argv[3])
+if len(sys.argv) > 4:
+    l2_assoc = int(sys.argv[4])
+if len(sys.argv) > 5:
+    ops = int(sys.argv[5])
+
+coreclock = "2.4GHz"
+uncoreclock = "2.0GHz"
+
+bus = sst.Component("bus", "memHierarchy.Bus")
+bus.addParams({ "bus_frequency" : uncoreclock })
+
+for x in range(cores):
+    cpu = sst.Component("core" + str(x), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "clock" : coreclock,
+        "rngseed" : 7 + x,
+        "memFreq" : 1,
+        "memSize" : "4MiB",         # Larger than the L2 so that the L2 misses and replaces
+        "maxOutstanding" : 16,
+        "opCount" : ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 30,
+        "read_freq" : 70,
+        "verbose" : 0,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 2,
+        "coherence_protocol" : "MESI",
+        "replacement_policy" : "lru",
+        "cache_size" : "32KiB",
+        "associativity" : l1_assoc,
+        "L1" : 1,
+        "tag_store" : tag_store,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(x))
+    link_cpu_l1.connect( (iface, "lowlink", "100ps"), (l1cache, "highlink", "100ps") )
+
+    link_l1_bus = sst.Link("link_l1_bus_" + str(x))
+    link_l1_bus.connect( (l1cache, "lowlink", "100ps"), (bus, "highlink" + str(x), "100ps") )
+
+l2cache = sst.Component("l2cache", "memHierarchy.Cache")
+l2cache.addParams({
+    "cache_frequency" : uncoreclock,
+    "access_latency_cycles" : 8,
+    "coherence_protocol" : "MESI",
+    "replacement_policy" : "lru",
+    "cache_size" : "1MiB",
+    "associativity" : l2_assoc,
+    "cache_type" : "noninclusive_with_directory",
+    "noninclusive_directory_entries" : 32768,
+    "noninclusive_directory_associativity" : l2_assoc,
+    "mshr_num_entries" : 64,
+    "tag_store" : tag_store,
+})
+
+link_bus_l2 = sst.Link("link_bus_l2")
+link_bus_l2.connect( (bus, "lowlink0", "100ps"), (l2cache, "highlink", "100ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "512MiB",
+})
+
+link_l2_mem = sst.Link("link_l2_mem")
+link_l2_mem.connect( (l2cache, "lowlink", "100ps"), (memctrl, "highlink", "100ps") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
@@ -0,0 +1,117 @@
+import sst
+import sys
+from mhlib import componentlist
+
+# Shared LLC instantiated either as one Cache component or as a set of partition components
+#
+# Each partition is a memHierarchy.Cache with the same parameters as the monolithic LLC plus
+# 'num_cache_slices', 'slice_id' and 'slice_partition'. Each partition takes an equal share of the
+# LLC's size, MSHR, and banks and caches the lines that interleave to it, so it can be placed on
+# its own thread. Run with one thread per partition to spread the LLC's work, e.g.,
+#   sst -n 4 testCachePartitions.py -- 4
+#   sst testCachePartitions.py -- 1      (monolithic LLC)
+#
+# Optional arguments: <partitions> <cores> <ops_per_core>
+
+partitions = 4
+cores = 8
+ops = 5000
+
+if len(sys.argv) > 1:
+    partitions = int(sys.argv[1])
+if len(sys.argv) > 2:
+    cores = int(sys.argv[2])
+if len(sys.argv) > 3:
+    ops = int(sys.argv[3])
+
+coreclock = "2.4GHz"
+uncoreclock = "2.0GHz"
+
+l2params = {
+    "cache_frequency" : uncoreclock,
+    "access_latency_cycles" : 10,
+    "coherence_protocol" : "MESI",
+    "replacement_policy" : "lru",
+    "cache_size" : "1MiB",
+    "associativity" : 16,
+    "mshr_num_entries" : 64,
+    "banks" : 8,
+}
+
+l1bus = sst.Component("l1bus", "memHierarchy.Bus")
+l1bus.addParams({ "bus_frequency" : uncoreclock })
+
+membus = sst.Component("membus", "memHierarchy.Bus")
+membus.addParams({ "bus_frequency" : uncoreclock })
+
+for x in range(cores):
+    cpu = sst.Component("core" + str(x), "memHierarchy.standardCPU")
+    cpu.addParams({
+        "clock" : coreclock,
+        "rngseed" : 11 + x,
+        "memFreq" : 2,
+        "memSize" : "8MiB",
+        "maxOutstanding" : 16,
+        "opCount" : ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 35,
+        "read_freq" : 60,
+        "flush_freq" : 3,
+        "flushinv_freq" : 2,
+        "verbose" : 0,
+    })
+    iface = cpu.setSubComponent("memory", "memHierarchy.standardInterface")
+
+    l1cache = sst.Component("l1cache" + str(x), "memHierarchy.Cache")
+    l1cache.addParams({
+        "cache_frequency" : coreclock,
+        "access_latency_cycles" : 2,
+        "coherence_protocol" : "MESI",
+        "replacement_policy" : "lru",
+        "cache_size" : "8KiB",
+        "associativity" : 4,
+        "L1" : 1,
+    })
+
+    link_cpu_l1 = sst.Link("link_cpu_l1_" + str(x))
+    link_cpu_l1.connect( (iface, "lowlink", "100ps"), (l1cache, "highlink", "100ps") )
+
+    link_l1_bus = sst.Link("link_l1_bus_" + str(x))
+    link_l1_bus.connect( (l1cache, "lowlink", "100ps"), (l1bus, "highlink" + str(x), "100ps") )
+
+for x in range(partitions):
+    l2cache = sst.Component("l2cache" + str(x), "memHierarchy.Cache")
+    l2cache.addParams(l2params)
+    if partitions > 1:
+        l2cache.addParams({
+            "num_cache_slices" : partitions,
+            "slice_id" : x,
+            "slice_allocation_policy" : "rr",
+            "slice_partition" : 1,
+        })
+
+    link_bus_l2 = sst.Link("link_bus_l2_" + str(x))
+    link_bus_l2.connect( (l1bus, "lowlink" + str(x), "100ps"), (l2cache, "highlink", "100ps") )
+
+    link_l2_bus = sst.Link("link_l2_membus_" + str(x))
+    link_l2_bus.connect( (l2cache, "lowlink", "100ps"), (membus, "highlink" + str(x), "100ps") )
+
+memctrl = sst.Component("memory", "memHierarchy.MemController")
+memctrl.addParams({
+    "clock" : "1GHz",
+    "backing" : "none",
+    "addr_range_end" : 512*1024*1024-1,
+})
+memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+memory.addParams({
+    "access_time" : "50ns",
+    "mem_size" : "512MiB",
+})
+
+link_bus_mem = sst.Link("link_membus_mem")
+link_bus_mem.connect( (membus, "lowlink0", "100ps"), (memctrl, "highlink", "100ps") )
+
+sst.setStatisticLoadLevel(7)
+sst.setStatisticOutput("sst.statOutputConsole")
+for a in componentlist:
+    sst.enableAllStatisticsForComponentType(a)
@@ -162,6 +162,9 @@ class testcase_memHierarchy_memHA(SSTTestCase):
 
     def test_memHA_RangeCheck(self):
         self.memHA_Template("RangeCheck", testtimeout=60)
+
+    def test_memHA_CachePartitions(self):
+        self.memHA_Partition_Template(partitions=2)
 #####
 
     def memHA_Template(self, testcase,
@@ -223,6 +226,56 @@ class testcase_memHierarchy_memHA(SSTTestCase):
             self.assertTrue(filesAreTheSame, "Output file {0} does not pass check against the Reference File {1} ".format(outfile, reffile))
 
 ###
+    # Run testCachePartitions.py with a monolithic LLC and with the LLC split into 'partitions'
+    # and check that both see the same trace. A partition indexes the same sets as the monolithic
+    # LLC so the summed LLC hits/misses and the traffic to memory must match exactly; only timing
+    # may differ. One core keeps the order of requests to each set independent of timing.
+    def memHA_Partition_Template(self, partitions, cores=1, ops=5000, testtimeout=240):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        sdlfile = "{0}/testCachePartitions.py".format(test_path)
+
+        stats = {}
+        for parts in [1, partitions]:
+            testDataFileName = "test_memHA_CachePartitions_{0}".format(parts)
+            outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+            errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+            mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+            args = '--model-options="{0} {1} {2}"'.format(parts, cores, ops)
+
+            self.run_sst(sdlfile, outfile, errfile, other_args=args, set_cwd=test_path,
+                         timeout_sec=testtimeout, mpi_out_files=mpioutfiles)
+
+            with open(outfile) as fp:
+                lines = fp.read().splitlines()
+            self.assertIn("Simulation is complete", " ".join(lines), "No end of simulation detected in output file {0}".format(outfile))
+
+            # Sum each statistic over the LLC partitions
+            stats[parts] = {}
+            for line in lines:
+                stat = self._is_stat(line)
+                if stat == None:
+                    continue
+                key = (re.sub(r'^l2cache\d+$', 'l2cache', stat[0]), stat[1])
+                stats[parts][key] = stats[parts].get(key, 0) + stat[2]
+
+        compare = [ ("core",    ["reads", "writes", "flushes", "flushinvs"]),
+                    ("l2cache", ["CacheHits", "CacheMisses", "GetS_recv", "GetX_recv", "PutM_recv", "FlushLine_recv", "FlushLineInv_recv"]),
+                    ("memory",  ["requests_received_GetS", "requests_received_GetX", "requests_received_PutM"]) ]
+
+        diffs = ""
+        for comp, names in compare:
+            for name in names:
+                if not any(key[0].startswith(comp) and key[1] == name for key in stats[1]):
+                    diffs += "{0}.{1}: not found in output\n".format(comp, name)
+                for key in stats[1]:
+                    if key[0].startswith(comp) and key[1] == name and stats[1][key] != stats[partitions].get(key):
+                        diffs += "{0}.{1}: monolithic = {2}, {3} partitions = {4}\n".format(key[0], name, stats[1][key], partitions, stats[partitions].get(key))
+        if diffs != "":
+            log_failure(diffs)
+        self.assertTrue(diffs == "", "Partitioned LLC statistics do not match the monolithic LLC")
+
     # Remove lines containing any string found in 'remove_strs' from in_file
     # If out_file != None, output is out_file
     # Otherwise, in_file is overwritten
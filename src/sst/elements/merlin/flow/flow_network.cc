@@ -0,0 +1,439 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "flow/flow_network.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "merlin.h"
+#include "router.h"
+#include "flow/flow_router.h"
+#include "interfaces/flowControl.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+
+std::map<std::string,FlowNetwork*> FlowNetwork::networks;
+std::mutex FlowNetwork::networks_lock;
+
+// Credits reported to the topologies for every output VC
+static const int flow_credits = 1 << 20;
+
+// Limit on router traversals, used to catch routing loops
+static const int max_hops = 1024;
+
+// A flow with less than this many bits left is finished
+static const double done_threshold = 0.5;
+
+
+FlowNetwork*
+FlowNetwork::getNetwork(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(networks_lock);
+    FlowNetwork*& net = networks[name];
+    if ( net == nullptr ) net = new FlowNetwork(name);
+    net->refs++;
+    return net;
+}
+
+void
+FlowNetwork::release(FlowNetwork* net)
+{
+    if ( net == nullptr ) return;
+    std::lock_guard<std::mutex> lock(networks_lock);
+    if ( --net->refs > 0 ) return;
+    networks.erase(net->name);
+    delete net;
+}
+
+FlowNetwork::~FlowNetwork()
+{
+    // Flows still in progress own their events
+    for ( int fid : active_flows ) delete flows[fid].ev;
+}
+
+
+void
+FlowNetwork::addRouter(int id, flow_router* rtr, Topology* topo, int num_ports, int num_vns)
+{
+    if ( id >= (int)routers.size() ) routers.resize(id + 1);
+    router_info& ri = routers[id];
+    if ( ri.rtr != nullptr ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: more than one flow_router has id %d\n", id);
+    }
+
+    ri.rtr = rtr;
+    ri.topo = topo;
+    ri.num_ports = num_ports;
+
+    // Output link for every port, followed by the input link for
+    // every port.  Only the input links of host ports are used.
+    ri.link_base = links.size();
+    links.resize(links.size() + 2 * num_ports);
+
+    ri.peers.assign(num_ports, std::make_pair(-1,-1));
+    ri.link_latency.assign(num_ports, 0);
+    ri.input_latency.assign(num_ports, 0);
+    ri.output_latency.assign(num_ports, 0);
+
+    std::vector<int> vcs_per_vn(num_vns);
+    topo->getVCsPerVN(vcs_per_vn);
+    int num_vcs = 0;
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    ri.credits.assign(num_ports * num_vcs, flow_credits);
+    ri.queue_lengths.assign(num_ports * num_vcs, 0);
+    topo->setOutputBufferCreditArray(ri.credits.data(), num_vcs);
+    topo->setOutputQueueLengthsArray(ri.queue_lengths.data(), num_vcs);
+}
+
+void
+FlowNetwork::setPortParams(int rtr, int port, double bw, SimTime_t link_latency, SimTime_t input_latency, SimTime_t output_latency)
+{
+    if ( bw <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: link_bw for port %d of router %d must be greater than zero\n", port, rtr);
+    }
+    router_info& ri = routers[rtr];
+    links[ri.link_base + port].capacity = bw;
+    links[ri.link_base + ri.num_ports + port].capacity = bw;
+    ri.link_latency[port] = link_latency;
+    ri.input_latency[port] = input_latency;
+    ri.output_latency[port] = output_latency;
+}
+
+void
+FlowNetwork::addHostPort(nid_t ep_id, int rtr, int port)
+{
+    if ( (size_t)ep_id >= endpoints.size() ) endpoints.resize(ep_id + 1);
+    endpoints[ep_id].rtr = rtr;
+    endpoints[ep_id].port = port;
+}
+
+void
+FlowNetwork::connect(int rtr, int port, int peer_rtr, int peer_port)
+{
+    if ( peer_rtr < 0 || peer_rtr >= (int)routers.size() || routers[peer_rtr].rtr == nullptr ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: port %d of router %d is connected to something other than a flow_router\n",
+                           port, rtr);
+    }
+    routers[rtr].peers[port] = std::make_pair(peer_rtr, peer_port);
+}
+
+void
+FlowNetwork::addEndpoint(nid_t id, FlowControl* ep, double bw)
+{
+    if ( (size_t)id >= endpoints.size() || endpoints[id].rtr == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: endpoint %" PRI_NID " is not attached to a host port\n", id);
+    }
+    endpoint_info& ei = endpoints[id];
+    ei.ep = ep;
+
+    // The host link runs at the slower of the two ends
+    router_info& ri = routers[ei.rtr];
+    flow_link& out = links[ri.link_base + ei.port];
+    flow_link& in = links[ri.link_base + ri.num_ports + ei.port];
+    out.capacity = std::min(out.capacity, bw);
+    in.capacity = std::min(in.capacity, bw);
+
+    if ( timer_owner == nullptr ) timer_owner = ep;
+}
+
+void
+FlowNetwork::routeUntimedData(int rtr, int port, Event* ev)
+{
+    RtrEvent* rev = static_cast<RtrEvent*>(ev);
+    nid_t dest = rev->getDest();
+
+    if ( dest == SimpleNetwork::INIT_BROADCAST_ADDR ) {
+        // Send to every endpoint except the one it came from
+        for ( auto& ei : endpoints ) {
+            if ( ei.rtr == -1 ) continue;
+            if ( ei.rtr == rtr && ei.port == port ) continue;
+            routers[ei.rtr].rtr->sendUntimedData(ei.port, rev->clone());
+        }
+        delete rev;
+        return;
+    }
+
+    if ( (size_t)dest >= endpoints.size() || endpoints[dest].rtr == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: untimed data sent to unknown endpoint %" PRI_NID "\n", dest);
+    }
+    endpoint_info& ei = endpoints[dest];
+    routers[ei.rtr].rtr->sendUntimedData(ei.port, rev);
+}
+
+
+// Walks the topology objects from the source host port to find the
+// links used by ev and the latency of the path
+void
+FlowNetwork::findPath(int rtr, int port, RtrEvent* ev, std::vector<int>& path, SimTime_t& latency)
+{
+    router_info* ri = &routers[rtr];
+
+    // Link from the endpoint into the router
+    path.push_back(ri->link_base + ri->num_ports + port);
+    latency = ri->link_latency[port];
+
+    ev->computeSizeInFlits(ri->rtr->getFlitSize());
+    internal_router_event* ire = ri->topo->process_input(ev);
+    ire->setCreditReturnVC(ev->getRouteVN());
+
+    for ( int hops = 0; ; hops++ ) {
+        if ( hops == max_hops ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: packet from %" PRI_NID " to %" PRI_NID " did not reach its destination after %d hops\n",
+                               ev->getTrustedSrc(), ev->getDest(), max_hops);
+        }
+
+        ri->topo->route_packet(port, ire->getVC(), ire);
+        int out = ire->getNextPort();
+        path.push_back(ri->link_base + out);
+        latency += ri->input_latency[port] + ri->output_latency[out] + ri->link_latency[out];
+
+        if ( ri->topo->isHostPort(out) ) {
+            if ( ri->topo->getEndpointID(out) != (int)ev->getDest() ) {
+                merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: packet for %" PRI_NID " was routed to endpoint %d\n",
+                                   ev->getDest(), ri->topo->getEndpointID(out));
+            }
+            break;
+        }
+
+        const auto& peer = ri->peers[out];
+        if ( peer.first == -1 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: packet was routed to unconnected port %d of router %d\n",
+                               out, (int)(ri - routers.data()));
+        }
+        ri = &routers[peer.first];
+        port = peer.second;
+    }
+
+    // ev is still owned by the flow
+    ire->setEncapsulatedEvent(nullptr);
+    delete ire;
+}
+
+
+void
+FlowNetwork::startFlow(FlowControl* src, RtrEvent* ev, SimTime_t now)
+{
+    nid_t dest = ev->getDest();
+    if ( (size_t)dest >= endpoints.size() || endpoints[dest].ep == nullptr ) {
+        merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: packet sent to unknown endpoint %" PRI_NID "\n", dest);
+    }
+
+    // Bring the flows in progress up to date before anything changes
+    advance(now);
+
+    int fid;
+    if ( free_flows.empty() ) {
+        fid = flows.size();
+        flows.emplace_back();
+    }
+    else {
+        fid = free_flows.back();
+        free_flows.pop_back();
+    }
+
+    flow& f = flows[fid];
+    f.ev = ev;
+    f.src = src;
+    f.dest = endpoints[dest].ep;
+    f.remaining = ev->getSizeInBits();
+    f.rate = 0;
+    f.frozen = false;
+    f.path.clear();
+    f.path_pos.clear();
+
+    const endpoint_info& si = endpoints[src->getPhysicalID()];
+    findPath(si.rtr, si.port, ev, f.path, f.latency);
+
+    for ( int l : f.path ) {
+        flow_link& link = links[l];
+        f.path_pos.push_back(link.flows.size());
+        link.flows.push_back(fid);
+        if ( !link.active ) {
+            link.active = true;
+            active_links.push_back(l);
+        }
+    }
+
+    f.active_pos = active_flows.size();
+    active_flows.push_back(fid);
+
+    scheduleRecompute();
+}
+
+void
+FlowNetwork::removeFlow(int fid)
+{
+    flow& f = flows[fid];
+
+    for ( size_t i = 0; i < f.path.size(); i++ ) {
+        int l = f.path[i];
+        std::vector<int>& list = links[l].flows;
+        int pos = f.path_pos[i];
+        int moved = list.back();
+        list[pos] = moved;
+        list.pop_back();
+        if ( moved != fid ) {
+            // Fix up the position of the flow that took our place
+            flow& m = flows[moved];
+            for ( size_t j = 0; j < m.path.size(); j++ ) {
+                if ( m.path[j] == l ) {
+                    m.path_pos[j] = pos;
+                    break;
+                }
+            }
+        }
+    }
+
+    int moved = active_flows.back();
+    active_flows[f.active_pos] = moved;
+    flows[moved].active_pos = f.active_pos;
+    active_flows.pop_back();
+
+    f.ev = nullptr;
+    free_flows.push_back(fid);
+}
+
+void
+FlowNetwork::advance(SimTime_t now)
+{
+    if ( now == last_advance ) return;
+    double elapsed = now - last_advance;
+    for ( int fid : active_flows ) {
+        flows[fid].remaining -= flows[fid].rate * elapsed;
+    }
+    last_advance = now;
+}
+
+void
+FlowNetwork::scheduleRecompute()
+{
+    // All the arrivals at this time are handled together.  Bumping
+    // the epoch cancels the pending completion event.
+    if ( recompute_pending ) return;
+    recompute_pending = true;
+    timer_owner->scheduleTimer(0, ++epoch);
+}
+
+// Max-min fair rates by progressive filling: repeatedly find the link
+// that offers the smallest equal share to its unassigned flows, give
+// that share to those flows and remove it from the rest of their
+// paths.
+void
+FlowNetwork::computeRates()
+{
+    size_t count = 0;
+    for ( int l : active_links ) {
+        flow_link& link = links[l];
+        if ( link.flows.empty() ) {
+            link.active = false;
+            continue;
+        }
+        link.residual = link.capacity;
+        link.unfrozen = link.flows.size();
+        active_links[count++] = l;
+    }
+    active_links.resize(count);
+
+    for ( int fid : active_flows ) flows[fid].frozen = false;
+
+    size_t unassigned = active_flows.size();
+    while ( unassigned > 0 ) {
+        int bottleneck = -1;
+        double share = std::numeric_limits<double>::max();
+        for ( int l : active_links ) {
+            const flow_link& link = links[l];
+            if ( link.unfrozen == 0 ) continue;
+            double s = std::max(link.residual, 0.0) / link.unfrozen;
+            if ( s < share ) {
+                share = s;
+                bottleneck = l;
+            }
+        }
+        if ( bottleneck == -1 ) break;
+
+        for ( int fid : links[bottleneck].flows ) {
+            flow& f = flows[fid];
+            if ( f.frozen ) continue;
+            f.frozen = true;
+            f.rate = share;
+            unassigned--;
+            for ( int l : f.path ) {
+                links[l].residual -= share;
+                links[l].unfrozen--;
+            }
+        }
+    }
+}
+
+void
+FlowNetwork::handleTimer(uint64_t ev_epoch, SimTime_t now)
+{
+    if ( ev_epoch != epoch ) return;
+    recompute_pending = false;
+
+    advance(now);
+
+    // Retire the flows that have been fully injected.  The endpoints
+    // are only told after the new rates are in place, since they may
+    // start new flows from their callbacks.
+    struct completion {
+        RtrEvent* ev;
+        FlowControl* src;
+        FlowControl* dest;
+        SimTime_t latency;
+    };
+    std::vector<completion> done;
+
+    for ( size_t i = 0; i < active_flows.size(); ) {
+        int fid = active_flows[i];
+        flow& f = flows[fid];
+        if ( f.remaining < done_threshold ) {
+            done.push_back({f.ev, f.src, f.dest, f.latency});
+            // Moves the last active flow into slot i
+            removeFlow(fid);
+        }
+        else {
+            i++;
+        }
+    }
+
+    computeRates();
+
+    if ( !active_flows.empty() ) {
+        double next = std::numeric_limits<double>::max();
+        for ( int fid : active_flows ) {
+            const flow& f = flows[fid];
+            if ( f.rate > 0 ) next = std::min(next, f.remaining / f.rate);
+        }
+        // Only possible if every link of the active flows has no
+        // bandwidth left, in which case they would never finish
+        if ( next == std::numeric_limits<double>::max() ) {
+            merlin_abort.fatal(CALL_INFO, -1, "FlowNetwork: none of the %zu active flows has any bandwidth at time %" PRIu64 " ps, check link_bw of the routers and endpoints\n",
+                               active_flows.size(), now);
+        }
+        timer_owner->scheduleTimer((SimTime_t)std::ceil(next), ++epoch);
+    }
+
+    for ( auto& c : done ) {
+        int vn = c.ev->getLogicalVN();
+        uint64_t bits = c.ev->getSizeInBits();
+        c.dest->deliver(c.ev, c.latency);
+        c.src->flowSent(vn, bits);
+    }
+}
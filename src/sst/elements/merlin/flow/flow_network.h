@@ -0,0 +1,184 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
+#define COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
+
+#include <sst/core/event.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+class Topology;
+class RtrEvent;
+class flow_router;
+class FlowControl;
+
+/**
+   Event used by the flow network to schedule its own work on the self
+   link of one of the FlowControl objects.  Only the event carrying the
+   current epoch is acted upon; older ones were superseded by a later
+   rate computation.
+ */
+class FlowTimerEvent : public Event {
+public:
+    uint64_t epoch;
+
+    FlowTimerEvent() : Event(), epoch(0) {}
+    FlowTimerEvent(uint64_t epoch) : Event(), epoch(epoch) {}
+
+    void serialize_order(SST::Core::Serialization::serializer &ser) override {
+        Event::serialize_order(ser);
+        SST_SER(epoch);
+    }
+
+private:
+    ImplementSerializable(SST::Merlin::FlowTimerEvent)
+};
+
+
+/**
+   Fluid model of a merlin network.
+
+   Every SimpleNetwork::Request is a flow from its source to its
+   destination endpoint.  The path of a flow is found by walking the
+   topology objects of the flow_routers, so any merlin topology can be
+   used.  Bandwidth is shared max-min fairly between all flows that are
+   active on a link, and the rates are only recomputed when a flow
+   starts or finishes.  A flow is delivered once all of its bits have
+   been injected, plus the latency of its path.
+
+   There is one FlowNetwork per network_name in the process.  All of
+   the flow_routers and FlowControls of a network register with it
+   during construction and init, so the model requires a serial (one
+   rank, one thread) simulation.  Each of them holds a reference to the
+   network, which is deleted when the last one is destroyed.
+
+   The network is not serialized, so flow_router and FlowControl are
+   not checkpointable.
+ */
+class FlowNetwork {
+
+public:
+    typedef SST::Interfaces::SimpleNetwork::nid_t nid_t;
+
+    // Returns the network called name, creating it on first use.  The
+    // caller holds a reference until it calls release().
+    static FlowNetwork* getNetwork(const std::string& name);
+    static void release(FlowNetwork* net);
+
+    // Called by flow_router
+    void addRouter(int id, flow_router* rtr, Topology* topo, int num_ports, int num_vns);
+    void setPortParams(int rtr, int port, double bw, SimTime_t link_latency, SimTime_t input_latency, SimTime_t output_latency);
+    void addHostPort(nid_t ep_id, int rtr, int port);
+    void connect(int rtr, int port, int peer_rtr, int peer_port);
+    void routeUntimedData(int rtr, int port, Event* ev);
+
+    // Called by FlowControl
+    void addEndpoint(nid_t id, FlowControl* ep, double bw);
+    void startFlow(FlowControl* src, RtrEvent* ev, SimTime_t now);
+    void handleTimer(uint64_t epoch, SimTime_t now);
+
+private:
+    FlowNetwork(const std::string& name) :
+        name(name), refs(0), timer_owner(nullptr), epoch(0), recompute_pending(false), last_advance(0) {}
+    ~FlowNetwork();
+
+    static std::map<std::string,FlowNetwork*> networks;
+    static std::mutex networks_lock;
+
+    std::string name;
+    int refs;
+
+    // Directed link.  capacity is in bits per ps.
+    struct flow_link {
+        double capacity = 0;
+        double residual = 0;
+        int unfrozen = 0;
+        bool active = false;
+        std::vector<int> flows;
+    };
+
+    struct router_info {
+        flow_router* rtr = nullptr;
+        Topology* topo = nullptr;
+        int num_ports = 0;
+        // Index of the output link of port 0.  Input links of host
+        // ports follow the output links.
+        int link_base = 0;
+        std::vector<std::pair<int,int>> peers;
+        std::vector<SimTime_t> link_latency;
+        std::vector<SimTime_t> input_latency;
+        std::vector<SimTime_t> output_latency;
+        // Credit array handed to the topology.  Flow routers never
+        // run out of credits, so adaptive routing decisions see an
+        // idle network.
+        std::vector<int> credits;
+        std::vector<int> queue_lengths;
+    };
+
+    struct endpoint_info {
+        FlowControl* ep = nullptr;
+        int rtr = -1;
+        int port = -1;
+    };
+
+    struct flow {
+        RtrEvent* ev;
+        FlowControl* src;
+        FlowControl* dest;
+        double remaining;       // bits
+        double rate;            // bits per ps
+        SimTime_t latency;      // ps
+        bool frozen;
+        int active_pos;
+        std::vector<int> path;
+        // Index of this flow in the flow list of each link of path
+        std::vector<int> path_pos;
+    };
+
+    std::vector<router_info> routers;
+    std::vector<endpoint_info> endpoints;
+    std::vector<flow_link> links;
+    std::vector<int> active_links;
+
+    std::vector<flow> flows;
+    std::vector<int> free_flows;
+    std::vector<int> active_flows;
+
+    // Self link of this endpoint is used for all of the scheduling
+    FlowControl* timer_owner;
+    uint64_t epoch;
+    bool recompute_pending;
+    SimTime_t last_advance;
+
+    void findPath(int rtr, int port, RtrEvent* ev, std::vector<int>& path, SimTime_t& latency);
+    void advance(SimTime_t now);
+    void computeRates();
+    void removeFlow(int fid);
+    void scheduleRecompute();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOW_NETWORK_H
@@ -0,0 +1,194 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "flow/flow_router.h"
+
+#include <sst/core/params.h>
+
+#include <cmath>
+
+#include "merlin.h"
+#include "flow/flow_network.h"
+#include "hr_router/hr_router.h"
+
+using namespace SST::Merlin;
+using namespace std;
+
+// Converts a time to ps, the time unit used by the flow model
+static SimTime_t toPs(const UnitAlgebra& time)
+{
+    return (SimTime_t)llround(time.getDoubleValue() * 1e12);
+}
+
+flow_router::~flow_router()
+{
+    // SST framework manages SubComponent lifecycle — do not delete topo
+    FlowNetwork::release(network);
+}
+
+flow_router::flow_router(ComponentId_t cid, Params& params) :
+    Component(cid),
+    topo(nullptr),
+    network(nullptr)
+{
+    RankInfo ranks = getNumRanks();
+    if ( ranks.rank > 1 || ranks.thread > 1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router can only be used in serial simulations\n");
+    }
+
+    // Get the options for the router
+    id = params.find<int>("id",-1);
+    if ( id == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires id to be specified\n");
+    }
+
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires num_ports to be specified\n");
+    }
+
+    int num_vns = params.find<int>("num_vns",2);
+
+    // Get the topology
+    topo = loadUserSubComponent<SST::Merlin::Topology>
+        ("topology", ComponentInfo::SHARE_NONE, num_ports, id, num_vns);
+
+    if ( !topo ) {
+        merlin_abort.fatal(CALL_INFO_LONG, 1, "flow_router requires topology to be specified in input file\n");
+    }
+
+    UnitAlgebra flit_size_ua(params.find<std::string>("flit_size","8B"));
+    if ( flit_size_ua.hasUnits("B") ) {
+        flit_size_ua *= UnitAlgebra("8b/B");
+    }
+    flit_size = flit_size_ua.getRoundedValue();
+
+    if ( params.find<std::string>("link_latency") == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "flow_router requires link_latency to be specified\n");
+    }
+
+    network = FlowNetwork::getNetwork(params.find<std::string>("network_name",""));
+    network->addRouter(id, this, topo, num_ports, num_vns);
+
+    links.resize(num_ports);
+    port_bw.resize(num_ports);
+
+    // Logical group parameters show up as extra keys
+    params.enableVerify(false);
+    for ( int i = 0; i < num_ports; i++ ) {
+        links[i] = configureLink("port" + std::to_string(i));
+
+        UnitAlgebra bw(getLogicalGroupParam(params,topo,i,"link_bw"));
+        if ( bw.hasUnits("B/s") ) {
+            bw *= UnitAlgebra("8b/B");
+        }
+        port_bw[i] = bw;
+
+        std::string latency;
+        if ( topo->isHostPort(i) ) {
+            latency = getLogicalGroupParam(params,topo,i,"host_link_latency",params.find<std::string>("link_latency"));
+            network->addHostPort(topo->getEndpointID(i), id, i);
+        }
+        else {
+            latency = getLogicalGroupParam(params,topo,i,"link_latency");
+        }
+
+        network->setPortParams(id, i, bw.getDoubleValue() / 1e12,
+                               toPs(UnitAlgebra(latency)),
+                               toPs(UnitAlgebra(getLogicalGroupParam(params,topo,i,"input_latency","0ns"))),
+                               toPs(UnitAlgebra(getLogicalGroupParam(params,topo,i,"output_latency","0ns"))));
+    }
+    params.enableVerify(true);
+}
+
+
+void
+flow_router::init(unsigned int phase)
+{
+    if ( phase == 0 ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( !links[i] ) continue;
+
+            if ( topo->isHostPort(i) ) {
+                // Tell the endpoint its ID and the link bandwidth
+                RtrInitEvent* init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_BW;
+                init_ev->ua_value = port_bw[i];
+                links[i]->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = topo->getEndpointID(i);
+                links[i]->sendUntimedData(init_ev);
+            }
+            else {
+                // Report router ID and port number to other side of link
+                RtrInitEvent* init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_ID;
+                init_ev->int_value = id;
+                links[i]->sendUntimedData(init_ev);
+
+                init_ev = new RtrInitEvent();
+                init_ev->command = RtrInitEvent::REPORT_PORT;
+                init_ev->int_value = i;
+                links[i]->sendUntimedData(init_ev);
+            }
+        }
+    }
+
+    routeUntimedData();
+}
+
+void
+flow_router::complete(unsigned int phase)
+{
+    routeUntimedData();
+}
+
+void
+flow_router::routeUntimedData()
+{
+    for ( int i = 0; i < num_ports; i++ ) {
+        if ( !links[i] ) continue;
+
+        int remote_rtr_id = -1;
+        Event* ev;
+        while ( (ev = links[i]->recvUntimedData()) != nullptr ) {
+            BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+            switch ( bev->getType() ) {
+            case BaseRtrEvent::INITIALIZATION:
+            {
+                RtrInitEvent* init_ev = static_cast<RtrInitEvent*>(ev);
+                if ( init_ev->command == RtrInitEvent::REPORT_ID ) {
+                    remote_rtr_id = init_ev->int_value;
+                }
+                else if ( init_ev->command == RtrInitEvent::REPORT_PORT ) {
+                    network->connect(id, i, remote_rtr_id, init_ev->int_value);
+                }
+                delete ev;
+                break;
+            }
+            case BaseRtrEvent::PACKET:
+                // Untimed data from an endpoint.  The network delivers
+                // it straight to the router of the destination.
+                network->routeUntimedData(id, i, ev);
+                break;
+            default:
+                delete ev;
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,111 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
+#define COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+class FlowNetwork;
+
+/**
+   Router for the flow level network model.
+
+   A flow_router only describes its part of the network: it loads the
+   same topology subcomponents as hr_router, reports its link
+   parameters and discovers its neighbors during init.  No events are
+   sent over its links once the simulation is running; all traffic is
+   modeled by the FlowNetwork, which uses the topology objects of the
+   routers to find the path of each flow.  Endpoints must use
+   merlin.flowcontrol as their network interface.
+
+   The flow state lives in the FlowNetwork, which is not serialized, so
+   flow_router is not checkpointable.
+ */
+class flow_router : public Component {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        flow_router,
+        "merlin",
+        "flow_router",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Router for the flow level network model.  Use with merlin.flowcontrol.  Does not support checkpointing.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"id",                 "ID of the router."},
+        {"num_ports",          "Number of ports that the router has"},
+        {"num_vns",            "Number of VNs.","2"},
+        {"network_name",       "Name of the flow network.  Must match the network_name of the merlin.flowcontrol objects attached to the network.",""},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"link_latency",       "Latency of the links between routers.  Should match the latency used for the links in the topology."},
+        {"host_link_latency",  "Latency of the links to endpoints.  Defaults to link_latency.",""},
+        {"input_latency",      "Latency of packets entering the router.  Specified in s (can include SI prefix).","0ns"},
+        {"output_latency",     "Latency of packets exiting the router.  Specified in s (can include SI prefix).","0ns"},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix).  Only used by the topology for routing decisions.","8B"}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Ports which connect to endpoints or other routers.", { "merlin.RtrEvent", "merlin.RtrInitEvent" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology object to control routing", "SST::Merlin::Topology" }
+    )
+
+private:
+    int id;
+    int num_ports;
+    int flit_size;
+
+    Topology* topo;
+    FlowNetwork* network;
+
+    std::vector<Link*> links;
+    std::vector<UnitAlgebra> port_bw;
+
+public:
+    flow_router(ComponentId_t cid, Params& params);
+    ~flow_router();
+
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+
+    int getFlitSize() { return flit_size; }
+
+    // Used by FlowNetwork to deliver untimed data to an endpoint
+    void sendUntimedData(int port, Event* ev) { links[port]->sendUntimedData(ev); }
+
+private:
+    void routeUntimedData();
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOW_FLOW_ROUTER_H
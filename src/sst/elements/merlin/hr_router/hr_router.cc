@@ -63,8 +63,8 @@ static void split(string input, string delims, vector<string>& tokens) {
     }
 }
 
-static std::string getLogicalGroupParam(const Params& params, Topology* topo, int port,
-                                        std::string param, std::string default_val = "") {
+std::string SST::Merlin::getLogicalGroupParam(const Params& params, Topology* topo, int port,
+                                              std::string param, std::string default_val) {
     // Use topology object to get the group for the port
     std::string group = topo->getPortLogicalGroup(port);
 
@@ -373,6 +373,7 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     Params empty_params; // Empty params sent to subcomponents
     arb =
         loadAnonymousSubComponent<XbarArbitration>(xbar_arb, "XbarArb", 0, ComponentInfo::INSERT_STATS, empty_params);
+    track_vc_occupancy = arb->trackVCOccupancy();
 
     my_clock_handler = new Clock::Handler<hr_router,&hr_router::clock_handler>(this);
     xbar_tc = registerClock( xbar_clock, my_clock_handler);
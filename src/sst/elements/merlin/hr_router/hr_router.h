@@ -38,6 +38,12 @@ namespace Merlin {
 
 class PortControlBase;
 
+// Returns the value of param for the logical group port belongs to
+// (param:<group>), falling back to param and then default_val.  Also
+// used by router_group.
+std::string getLogicalGroupParam(const Params& params, Topology* topo, int port,
+                                 std::string param, std::string default_val = "");
+
 class hr_router : public Router {
 
 public:
@@ -159,6 +165,10 @@ public:
 
     void reportIncomingEvent(internal_router_event* ev) override;
 
+    void reportVCOccupancy(int port, int vc, bool occupied) override {
+        arb->reportVCOccupancy(port, vc, occupied);
+    }
+
     void serialize_order(SST::Core::Serialization::serializer& ser) override;
     ImplementSerializable(SST::Merlin::hr_router)
 };
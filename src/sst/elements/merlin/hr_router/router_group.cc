@@ -0,0 +1,614 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#include <sst_config.h>
+#include "hr_router/router_group.h"
+
+#include <sst/core/params.h>
+#include <sst/core/output.h>
+#include <sst/core/timeLord.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <algorithm>
+#include <functional>
+#include <string>
+
+#include "merlin.h"
+#include "hr_router/hr_router.h"
+#include "interfaces/portControl.h"
+
+using namespace SST::Merlin;
+using namespace SST::Interfaces;
+using namespace std;
+
+
+router_group::router_group() :
+    Router(),
+    num_routers(0),
+    num_ports(0),
+    num_vns(0),
+    num_vcs(-1),
+    local_seq(0),
+    local_link(nullptr),
+    unclocked_cycle(0),
+    my_clock_handler(nullptr),
+    output(getSimulationOutput())
+{
+}
+
+void router_group::serialize_order(SST::Core::Serialization::serializer& ser) {
+    Router::serialize_order(ser);
+
+    SST_SER(num_routers);
+    SST_SER(num_ports);
+    SST_SER(num_vns);
+    SST_SER(num_vcs);
+    SST_SER(vcs_per_vn);
+
+    if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+        routers.resize(num_routers);
+    }
+    for ( auto& rtr : routers ) {
+        SST_SER(rtr.id);
+        SST_SER(rtr.topo);
+        SST_SER(rtr.arb);
+        SST_SER(rtr.ports);
+        SST_SER(rtr.xbar_in_credits);
+        SST_SER(rtr.output_queue_lengths);
+        SST_SER(rtr.in_port_busy);
+        SST_SER(rtr.out_port_busy);
+        SST_SER(rtr.progress_vcs);
+        SST_SER(rtr.xbar_stalls);
+    }
+
+    size_t num_local = local_events.size();
+    SST_SER(num_local);
+    if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+        local_events.resize(num_local);
+    }
+    for ( auto& le : local_events ) {
+        SST_SER(le.time);
+        SST_SER(le.seq);
+        SST_SER(le.dest);
+        SST_SER(le.ev);
+    }
+    SST_SER(local_seq);
+    SST_SER(local_wakeups);
+    SST_SER(local_link);
+    SST_SER(ps_tc);
+
+    SST_SER(unclocked_cycle);
+    SST_SER(xbar_tc);
+    SST_SER(my_clock_handler);
+
+    if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+        // vc_heads has duplicate data from the PortControls, which
+        // checkpoint the actual data.  As in hr_router, only reconnect
+        // the shared arrays; initVCs() would overwrite the restored
+        // buffers and credits.
+        for ( auto& rtr : routers ) {
+            rtr.vc_heads.assign(num_ports * num_vcs, nullptr);
+            for ( int i = 0; i < num_ports; i++ ) {
+                PortControl* pc = dynamic_cast<PortControl*>(rtr.ports[i]);
+                if ( pc ) {
+                    pc->restoreSharedArrays(&rtr.vc_heads[i * num_vcs],
+                                            &rtr.xbar_in_credits[i * num_vcs],
+                                            &rtr.output_queue_lengths[i * num_vcs]);
+                    pc->repopulateVCHeads();
+                }
+            }
+            rtr.topo->setOutputBufferCreditArray(rtr.xbar_in_credits.data(), num_vcs);
+            rtr.topo->setOutputQueueLengthsArray(rtr.output_queue_lengths.data(), num_vcs);
+        }
+    }
+}
+
+router_group::~router_group()
+{
+    // SST framework manages SubComponent lifecycle — do not delete ports, topo, or arb
+    for ( auto& le : local_events ) delete le.ev;
+}
+
+router_group::router_group(ComponentId_t cid, Params& params) :
+    Router(cid),
+    num_vcs(-1),
+    local_seq(0),
+    unclocked_cycle(0),
+    output(getSimulationOutput())
+{
+    num_routers = params.find<int>("num_routers",-1);
+    if ( num_routers <= 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires num_routers to be specified\n");
+    }
+
+    num_ports = params.find<int>("num_ports",-1);
+    if ( num_ports == -1 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires num_ports to be specified\n");
+    }
+
+    std::vector<int> ids;
+    params.find_array<int>("ids", ids);
+    if ( (int)ids.size() != num_routers ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires ids to have one entry per router (num_routers = %d, ids has %zu entries)\n",
+                           num_routers, ids.size());
+    }
+
+    if ( params.find<std::string>("vn_remap_shm","") != "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group does not support vn_remap_shm, use hr_router instead\n");
+    }
+
+    // Get the number of VNs
+    num_vns = params.find<int>("num_vns",2);
+
+    // Get the topology for each router.  All routers in the group
+    // need to use the same VCs since they share a crossbar clock and
+    // port control setup.
+    routers.resize(num_routers);
+    SubComponentSlotInfo* topo_slots = getSubComponentSlotInfo("topology");
+    for ( int r = 0; r < num_routers; r++ ) {
+        member_router& rtr = routers[r];
+        rtr.id = ids[r];
+        if ( !topo_slots || !topo_slots->isPopulated(r) ) {
+            merlin_abort.fatal(CALL_INFO_LONG, 1, "router_group requires a topology in slot %d for router %d\n", r, rtr.id);
+        }
+        rtr.topo = topo_slots->create<Topology>(r, ComponentInfo::SHARE_NONE, num_ports, rtr.id, num_vns);
+
+        std::vector<int> vcs(num_vns);
+        rtr.topo->getVCsPerVN(vcs);
+        if ( r == 0 ) {
+            vcs_per_vn = vcs;
+        }
+        else if ( vcs != vcs_per_vn ) {
+            merlin_abort.fatal(CALL_INFO, -1, "router_group requires all routers to use the same number of VCs per VN\n");
+        }
+    }
+    num_vcs = 0;
+    for ( int vcs : vcs_per_vn ) num_vcs += vcs;
+
+    // Parse all the timing parameters
+
+    // Flit size
+    std::string flit_size_s = params.find<std::string>("flit_size");
+    if ( flit_size_s == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires flit_size to be specified\n");
+    }
+    UnitAlgebra flit_size(flit_size_s);
+    if ( flit_size.hasUnits("B") ) {
+        flit_size *= UnitAlgebra("8b/B");
+    }
+
+    std::string link_bw_s = params.find<std::string>("link_bw");
+    UnitAlgebra link_bw(link_bw_s);
+    if ( link_bw.hasUnits("B/s") ) {
+        link_bw *= UnitAlgebra("8b/B");
+    }
+
+    std::string xbar_bw_s = params.find<std::string>("xbar_bw");
+    if ( xbar_bw_s == "" ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group requires xbar_bw to be specified\n");
+    }
+    UnitAlgebra xbar_bw_ua(xbar_bw_s);
+    if ( xbar_bw_ua.hasUnits("B/s") ) {
+        xbar_bw_ua *= UnitAlgebra("8b/B");
+    }
+
+    if ( xbar_bw_ua < link_bw  ) {
+        merlin_abort.fatal(CALL_INFO_LONG,1,"ERROR: router_group requires xbar_bw to be greater than or equal to link_bw\n"
+              "  xbar_bw = %s, link_bw = %s\n",
+              xbar_bw_ua.toStringBestSI().c_str(), link_bw.toStringBestSI().c_str());
+    }
+
+    UnitAlgebra xbar_clock = xbar_bw_ua / flit_size;
+
+    // Links between routers of the group: router, port, peer router, peer port
+    std::vector<int> local_links;
+    params.find_array<int>("local_links", local_links);
+    if ( local_links.size() % 4 != 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group: local_links must have four entries per link\n");
+    }
+    std::vector<bool> is_local(num_routers * num_ports, false);
+    for ( size_t i = 0; i < local_links.size(); i += 4 ) {
+        for ( int end = 0; end < 2; end++ ) {
+            int r = local_links[i + 2*end];
+            int p = local_links[i + 2*end + 1];
+            if ( r < 0 || r >= num_routers || p < 0 || p >= num_ports ) {
+                merlin_abort.fatal(CALL_INFO, -1, "router_group: local link %zu refers to router %d, port %d, which is not in the group\n",
+                                   i / 4, r, p);
+            }
+            if ( is_local[r * num_ports + p] ) {
+                merlin_abort.fatal(CALL_INFO, -1, "router_group: router %d, port %d is used by more than one local link\n", r, p);
+            }
+            is_local[r * num_ports + p] = true;
+        }
+    }
+
+    params.enableVerify(false);
+
+    Params pc_params = params.get_scoped_params("portcontrol");
+
+    pc_params.insert("flit_size", flit_size.toStringBestSI());
+    if (pc_params.contains("network_inspectors")) pc_params.insert("network_inspectors", params.find<std::string>("network_inspectors", ""));
+    pc_params.insert("oql_track_port", params.find<std::string>("oql_track_port","false"));
+    pc_params.insert("oql_track_remote", params.find<std::string>("oql_track_remote","false"));
+    pc_params.insert("num_vns", std::to_string(num_vns));
+
+    // Congestion management routes control events through the router
+    // without a port, which cannot be resolved to a member router
+    if ( pc_params.find<bool>("enable_congestion_management", false) ) {
+        merlin_abort.fatal(CALL_INFO, -1, "router_group does not support congestion management, use hr_router instead\n");
+    }
+
+    for ( int r = 0; r < num_routers; r++ ) {
+        member_router& rtr = routers[r];
+        rtr.ports.resize(num_ports);
+        rtr.in_port_busy.assign(num_ports, 0);
+        rtr.out_port_busy.assign(num_ports, 0);
+        rtr.progress_vcs.assign(num_ports, -1);
+        rtr.xbar_stalls.resize(num_ports);
+
+        for ( int p = 0; p < num_ports; p++ ) {
+            int group_port = r * num_ports + p;
+            std::string port_name = "port" + std::to_string(group_port);
+
+            // For each port, some default parameters can be overwritten
+            // by logical group parameters (link_bw, input_buf_size,
+            // output_buf_size, input_latency, output_latency).
+            pc_params.insert("port_name", port_name);
+            pc_params.insert("link_bw", getLogicalGroupParam(params,rtr.topo,p,"link_bw") );
+            pc_params.insert("input_latency", getLogicalGroupParam(params,rtr.topo,p,"input_latency","0ns"));
+            pc_params.insert("output_latency", getLogicalGroupParam(params,rtr.topo,p,"output_latency","0ns"));
+            pc_params.insert("input_buf_size", getLogicalGroupParam(params,rtr.topo,p,"input_buf_size"));
+            pc_params.insert("output_buf_size", getLogicalGroupParam(params,rtr.topo,p,"output_buf_size"));
+            pc_params.insert("dlink_thresh", getLogicalGroupParam(params,rtr.topo,p,"dlink_thresh", "-1"));
+            pc_params.insert("parent_port", std::to_string(group_port));
+            pc_params.insert("local_link", is_local[group_port] ? "true" : "false");
+
+            rtr.ports[p] = loadAnonymousSubComponent<PortInterface>
+                ("merlin.portcontrol","portcontrol", group_port, ComponentInfo::SHARE_PORTS | ComponentInfo::SHARE_STATS | ComponentInfo::INSERT_STATS,
+                 pc_params,this,rtr.id,p,rtr.topo);
+
+            rtr.xbar_stalls[p] = registerStatistic<uint64_t>("xbar_stalls",port_name);
+        }
+    }
+    params.enableVerify(true);
+
+    // Wire the two ends of each local link together.  Local hops are
+    // timed in ps.
+    ps_tc = getTimeConverter("1ps");
+    local_link = configureSelfLink("local_hops", "1ps",
+                                   new Event::Handler<router_group,&router_group::handle_local>(this));
+
+    UnitAlgebra local_latency(params.find<std::string>("local_link_latency","0ns"));
+    SimTime_t link_delay = (local_latency / UnitAlgebra("1ps")).getRoundedValue();
+
+    for ( size_t i = 0; i < local_links.size(); i += 4 ) {
+        PortControl* a = dynamic_cast<PortControl*>(routers[local_links[i]].ports[local_links[i+1]]);
+        PortControl* b = dynamic_cast<PortControl*>(routers[local_links[i+2]].ports[local_links[i+3]]);
+        if ( !a || !b) {
+            merlin_abort.fatal(CALL_INFO, -1, "router_group: local link %zu must connect two router to router ports\n", i / 4);
+        }
+        a->setLocalPeer(b, link_delay);
+        b->setLocalPeer(a, link_delay);
+    }
+
+    // Get the Xbar arbitration, one per router
+    std::string xbar_arb = params.find<std::string>("xbar_arb","merlin.xbar_arb_lru");
+
+    Params empty_params; // Empty params sent to subcomponents
+    for ( int r = 0; r < num_routers; r++ ) {
+        routers[r].arb =
+            loadAnonymousSubComponent<XbarArbitration>(xbar_arb, "XbarArb", r, ComponentInfo::INSERT_STATS, empty_params);
+    }
+    track_vc_occupancy = routers[0].arb->trackVCOccupancy();
+
+    my_clock_handler = new Clock::Handler<router_group,&router_group::clock_handler>(this);
+    xbar_tc = registerClock( xbar_clock, my_clock_handler);
+
+    init_vcs();
+}
+
+
+void
+router_group::init_vcs()
+{
+    for ( auto& rtr : routers ) {
+        rtr.vc_heads.assign(num_ports * num_vcs, nullptr);
+        rtr.xbar_in_credits.assign(num_ports * num_vcs, 0);
+        rtr.output_queue_lengths.assign(num_ports * num_vcs, 0);
+
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->initVCs(num_vns,vcs_per_vn.data(),&rtr.vc_heads[i*num_vcs],
+                                  &rtr.xbar_in_credits[i*num_vcs],&rtr.output_queue_lengths[i*num_vcs]);
+        }
+
+        rtr.topo->setOutputBufferCreditArray(rtr.xbar_in_credits.data(), num_vcs);
+        rtr.topo->setOutputQueueLengthsArray(rtr.output_queue_lengths.data(), num_vcs);
+
+        rtr.arb->setPorts(num_ports,num_vcs);
+    }
+}
+
+
+void
+router_group::sendLocal(PortControl* dest, Event* ev, SimTime_t delay)
+{
+    SimTime_t time = getCurrentSimTime(ps_tc) + delay;
+    local_events.push_back({time, local_seq++, dest, ev});
+    std::push_heap(local_events.begin(), local_events.end(), std::greater<local_event>());
+    scheduleLocalWakeup(time);
+}
+
+// A wakeup delivers everything that is due by then, so one is only
+// needed if none is already pending at or before time
+void
+router_group::scheduleLocalWakeup(SimTime_t time)
+{
+    if ( !local_wakeups.empty() && local_wakeups.front() <= time ) return;
+    local_link->send(time - getCurrentSimTime(ps_tc), NULL);
+    local_wakeups.push_back(time);
+    std::push_heap(local_wakeups.begin(), local_wakeups.end(), std::greater<SimTime_t>());
+}
+
+// Deliver the events between routers that are due now, in the order
+// they were sent
+void
+router_group::handle_local(Event* ev)
+{
+    std::pop_heap(local_wakeups.begin(), local_wakeups.end(), std::greater<SimTime_t>());
+    local_wakeups.pop_back();
+
+    SimTime_t now = getCurrentSimTime(ps_tc);
+    while ( !local_events.empty() && local_events.front().time <= now ) {
+        std::pop_heap(local_events.begin(), local_events.end(), std::greater<local_event>());
+        local_event le = local_events.back();
+        local_events.pop_back();
+        le.dest->recvLocal(le.ev);
+    }
+
+    if ( !local_events.empty() ) scheduleLocalWakeup(local_events.front().time);
+}
+
+
+void
+router_group::notifyEvent()
+{
+    setRequestNotifyOnEvent(false);
+
+    Cycle_t next_cycle = reregisterClock( xbar_tc, my_clock_handler);
+    int64_t elapsed_cycles = next_cycle - unclocked_cycle;
+
+    // Fix up the busy variables
+    for ( auto& rtr : routers ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            int64_t tmp = rtr.in_port_busy[i] - elapsed_cycles;
+            rtr.in_port_busy[i] = tmp < 0 ? 0 : tmp;
+            tmp = rtr.out_port_busy[i] - elapsed_cycles;
+            rtr.out_port_busy[i] = tmp < 0 ? 0 : tmp;
+        }
+        // Report skipped cycles to arbitration unit.
+        rtr.arb->reportSkippedCycles(elapsed_cycles);
+    }
+}
+
+
+bool
+router_group::clock_handler(Cycle_t cycle)
+{
+    // If there are no events in the input queues, then we can remove
+    // ourselves from the clock queue, as long as the arbitration units
+    // say it's okay.
+    if ( get_vcs_with_data() == 0 ) {
+        bool pause = true;
+        for ( auto& rtr : routers ) pause = pause && rtr.arb->isOkayToPauseClock();
+        if ( pause ) {
+            setRequestNotifyOnEvent(true);
+            unclocked_cycle = cycle;
+            return true;
+        }
+        return false;
+    }
+
+    for ( auto& rtr : routers ) {
+        int* in_port_busy = rtr.in_port_busy.data();
+        int* out_port_busy = rtr.out_port_busy.data();
+        int* progress_vcs = rtr.progress_vcs.data();
+
+        // All we need to do is arbitrate the crossbar
+#if VERIFY_DECLOCKING
+        rtr.arb->arbitrate(rtr.ports.data(),in_port_busy,out_port_busy,progress_vcs,true);
+#else
+        rtr.arb->arbitrate(rtr.ports.data(),in_port_busy,out_port_busy,progress_vcs);
+#endif
+
+        // Move the events and decrement the busy values
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( progress_vcs[i] > -1 ) {
+                internal_router_event* ev = rtr.ports[i]->recv(progress_vcs[i]);
+                rtr.ports[ev->getNextPort()]->send(ev,ev->getVC());
+
+                if ( ev->getTraceType() == SimpleNetwork::Request::FULL ) {
+                    output.output("TRACE(%d): %" PRIu64 " ns: Copying event (src = %d, dest = %d) "
+                                  "over crossbar in router %d (%s) from port %d, VC %d to port"
+                                  " %d, VC %d.\n",
+                                  ev->getTraceID(),
+                                  getCurrentSimTimeNano(),
+                                  ev->getSrc(),
+                                  ev->getDest(),
+                                  rtr.id,
+                                  getName().c_str(),
+                                  i,
+                                  progress_vcs[i],
+                                  ev->getNextPort(),
+                                  ev->getVC());
+                }
+            }
+            else if ( progress_vcs[i] == -2 ) {
+                rtr.xbar_stalls[i]->addData(1);
+            }
+
+            if ( in_port_busy[i] != 0 ) in_port_busy[i]--;
+            if ( out_port_busy[i] != 0 ) out_port_busy[i]--;
+        }
+    }
+
+    return false;
+}
+
+
+void
+router_group::routeUntimedData(member_router& rtr, int port)
+{
+    Event *ev = NULL;
+    while ( (ev = rtr.ports[port]->recvUntimedData()) != NULL ) {
+        internal_router_event *ire = dynamic_cast<internal_router_event*>(ev);
+        if ( ire == NULL ) {
+            ire = rtr.topo->process_UntimedData_input(static_cast<RtrEvent*>(ev));
+        }
+        std::vector<int> outPorts;
+        rtr.topo->routeUntimedData(port, ire, outPorts);
+        for ( int out : outPorts ) {
+            // Need to clone both the event and the encapsulated event
+            switch ( rtr.topo->getPortState(out) ) {
+            case Topology::R2N:
+                rtr.ports[out]->sendUntimedData(ire->getEncapsulatedEvent()->clone());
+                break;
+            case Topology::R2R:
+            // Ignore failed links during init
+            case Topology::FAILED: {
+                internal_router_event *new_ire = ire->clone();
+                new_ire->setEncapsulatedEvent(ire->getEncapsulatedEvent()->clone());
+                rtr.ports[out]->sendUntimedData(new_ire);
+                break;
+            }
+            default:
+                break;
+            }
+        }
+        delete ire;
+    }
+}
+
+void
+router_group::init(unsigned int phase)
+{
+    for ( auto& rtr : routers ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->init(phase);
+            routeUntimedData(rtr, i);
+        }
+    }
+}
+
+void
+router_group::complete(unsigned int phase)
+{
+    for ( auto& rtr : routers ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->complete(phase);
+            routeUntimedData(rtr, i);
+        }
+    }
+}
+
+void
+router_group::setup()
+{
+    for ( auto& rtr : routers ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->setup();
+        }
+    }
+}
+
+void
+router_group::finish()
+{
+    for ( auto& rtr : routers ) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->finish();
+        }
+    }
+}
+
+
+void
+router_group::sendCtrlEvent(CtrlRtrEvent* ev, int port)
+{
+    if ( port == -1 ) {
+        fatal(CALL_INFO_LONG,-1,"ERROR: router_group %s can only send control events on a specific port\n",getName().c_str());
+    }
+    // Event just gets forwarded to appropriate PortControl object
+    routerForPort(port).ports[port % num_ports]->sendCtrlEvent(ev);
+}
+
+void
+router_group::recvCtrlEvent(int group_port, CtrlRtrEvent* ev)
+{
+    member_router& rtr = routerForPort(group_port);
+    int port = group_port % num_ports;
+
+    // Check to see what type of event it is
+    switch ( ev->getCtrlType() ) {
+    case CtrlRtrEvent::TOPOLOGY:
+        // Event just gets sent on to topolgy object
+        rtr.topo->recvTopologyEvent(port,static_cast<TopologyEvent*>(ev));
+        break;
+    default:
+    {
+        // Route the ctrl event
+        const auto& dest = ev->getDest();
+        int out = rtr.topo->routeControlPacket(ev);
+        if ( out == -1 ) {
+            // Destined for this router
+            if ( dest.addr_is_router ) {
+                fatal(CALL_INFO_LONG,-1,"ERROR: router %d received unknown ctrl event\n",rtr.id);
+            }
+            else {
+                auto d = rtr.topo->getDeliveryPortForEndpointID(dest.addr);
+                rtr.ports[d.second]->recvCtrlEvent(ev);
+            }
+        }
+        else {
+            rtr.ports[out]->sendCtrlEvent(ev);
+        }
+        break;
+    }
+    }
+}
+
+void
+router_group::reportIncomingEvent(internal_router_event* ev)
+{
+    // If this is destined for one of the routers in the group, let
+    // the appropriate PortControl know
+    for ( auto& rtr : routers ) {
+        auto dest = rtr.topo->getDeliveryPortForEndpointID(ev->getDest());
+        if ( dest.first == rtr.id ) {
+            rtr.ports[dest.second]->reportIncomingEvent(ev);
+            return;
+        }
+    }
+}
+
+void
+router_group::printStatus(Output& out)
+{
+    for ( auto& rtr : routers ) {
+        out.output("Start Router:  id = %d\n", rtr.id);
+        for ( int i = 0; i < num_ports; i++ ) {
+            rtr.ports[i]->printStatus(out, rtr.out_port_busy[i], rtr.in_port_busy[i]);
+        }
+        out.output("End Router: id = %d\n", rtr.id);
+    }
+}
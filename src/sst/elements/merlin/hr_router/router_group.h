@@ -0,0 +1,209 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_ROUTER_GROUP_H
+#define COMPONENTS_HR_ROUTER_ROUTER_GROUP_H
+
+#include <sst/core/clock.h>
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+
+#include <sst/core/statapi/stataccumulator.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+using namespace SST;
+
+namespace SST {
+namespace Merlin {
+
+/**
+   Models a group of hr_routers (for example, one dragonfly group) in a
+   single component.
+
+   Each member router has its own topology object, crossbar arbiter
+   and PortControl blocks, and behaves like an hr_router.  Links
+   between members of the group are not SST Links: packets and credits
+   are handed to the peer PortControl directly, at the same time they
+   would arrive over an SST Link.  The group keeps them in one queue
+   ordered by delivery time and uses a single self link to wake up
+   when the next ones are due, so all hops that arrive at the same
+   time cost one event.  Links that leave the group are ordinary SST
+   Links.
+
+   All members share one crossbar clock, so all routers in a group
+   must use the same xbar_bw and flit_size.
+ */
+class router_group : public Router {
+
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        router_group,
+        "merlin",
+        "router_group",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Group of high radix routers modeled in a single component.  Links between routers in the group do not use SST Links.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"num_routers",        "Number of routers in the group."},
+        {"ids",                "Array with the router ID of each router in the group."},
+        {"num_ports",          "Number of ports that each router has.  Port p of router r is port<r*num_ports+p>."},
+        {"local_links",        "Array describing the links between routers in the group.  Each link uses four entries: router, port, peer router, peer port.  Routers are numbered by their position in the group.", ""},
+        {"local_link_latency", "Latency of the links between routers in the group.", "0ns"},
+        {"xbar_arb",           "Arbitration unit to be used for crossbar.","merlin.xbar_arb_lru"},
+        {"link_bw",            "Bandwidth of the links specified in either b/s or B/s (can include SI prefix)."},
+        {"flit_size",          "Flit size specified in either b or B (can include SI prefix)."},
+        {"xbar_bw",            "Bandwidth of the crossbar specified in either b/s or B/s (can include SI prefix)."},
+        {"input_latency",      "Latency of packets entering switch into input buffers.  Specified in s (can include SI prefix)."},
+        {"output_latency",     "Latency of packets exiting switch from output buffers.  Specified in s (can include SI prefix)."},
+        {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix)."},
+        {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix)."},
+        {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
+        {"oql_track_port",     "Set to true to track output queue length for an entire port.  False tracks per VC.", "false"},
+        {"oql_track_remote",   "Set to true to track output queue length including remote input queue.  False tracks only local queue.", "false"},
+        {"num_vns",            "Number of VNs.","2"}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+        { "send_packet_count",  "Count number of packets sent on link", "packets", 1},
+        { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
+        { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
+        { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
+        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1}
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"port%(num_ports)d",  "Ports which connect to endpoints or to routers outside the group.  Port p of router r is port<r*num_ports+p>.", { "merlin.RtrEvent", "merlin.internal_router_event", "merlin.topologyevent", "merlin.credit_event" } }
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"topology", "Topology object to control routing.  Slot index r is used for router r of the group.", "SST::Merlin::Topology" },
+        {"XbarArb", "Crossbar arbitration", "SST::Merlin::XbarArbitration" },
+        {"portcontrol", "PortControl blocks", "SST::Merlin::PortInterface" }
+    )
+
+private:
+
+    // State kept for each router in the group.  This mirrors the
+    // per-router state of hr_router.
+    struct member_router {
+        int id;
+        Topology* topo;
+        XbarArbitration* arb;
+
+        std::vector<PortInterface*> ports;
+        std::vector<internal_router_event*> vc_heads;
+        std::vector<int> xbar_in_credits;
+        std::vector<int> output_queue_lengths;
+
+        std::vector<int> in_port_busy;
+        std::vector<int> out_port_busy;
+        std::vector<int> progress_vcs;
+
+        std::vector<Statistic<uint64_t>*> xbar_stalls;
+    };
+
+    // Event in flight on a link between two routers of the group
+    struct local_event {
+        SimTime_t time;
+        uint64_t seq;
+        PortControl* dest;
+        Event* ev;
+
+        bool operator>(const local_event& other) const {
+            return time != other.time ? time > other.time : seq > other.seq;
+        }
+    };
+
+    int num_routers;
+    int num_ports;
+    int num_vns;
+    int num_vcs;
+    std::vector<int> vcs_per_vn;
+
+    std::vector<member_router> routers;
+
+    // Min-heap on delivery time (in ps) of events between routers
+    std::vector<local_event> local_events;
+    uint64_t local_seq;
+
+    // Times of the wakeups pending on local_link, as a min-heap.  The
+    // earliest is never later than the earliest of local_events.
+    std::vector<SimTime_t> local_wakeups;
+    Link* local_link;
+    TimeConverter ps_tc;
+
+    Cycle_t unclocked_cycle;
+    TimeConverter xbar_tc;
+    Clock::HandlerBase* my_clock_handler;
+
+    Output& output;
+
+    bool clock_handler(Cycle_t cycle);
+    void handle_local(Event* ev);
+    void scheduleLocalWakeup(SimTime_t time);
+    void routeUntimedData(member_router& rtr, int port);
+    void init_vcs();
+
+    // Maps a port in the group's port space to its router
+    member_router& routerForPort(int port) { return routers[port / num_ports]; }
+
+    SST_ELI_IS_CHECKPOINTABLE()
+
+public:
+    router_group(ComponentId_t cid, Params& params);
+    router_group();
+    ~router_group();
+
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+    void setup() override;
+    void finish() override;
+
+    void notifyEvent() override;
+    // Each member router has its own credit array, which is handed
+    // directly to its topology
+    int const* getOutputBufferCredits() override {return nullptr;}
+
+    void sendCtrlEvent(CtrlRtrEvent* ev, int port = -1) override;
+    void recvCtrlEvent(int port, CtrlRtrEvent* ev) override;
+
+    void reportIncomingEvent(internal_router_event* ev) override;
+
+    void sendLocal(PortControl* dest, Event* ev, SimTime_t delay) override;
+
+    void reportVCOccupancy(int port, int vc, bool occupied) override {
+        routerForPort(port).arb->reportVCOccupancy(port % num_ports, vc, occupied);
+    }
+
+    void printStatus(Output& out) override;
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override;
+    ImplementSerializable(SST::Merlin::router_group)
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_ROUTER_GROUP_H
@@ -0,0 +1,270 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_OCC_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_OCC_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <vector>
+#include <queue>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hr_router/xbar_occupancy.h"
+
+namespace SST {
+namespace Merlin {
+
+
+/**
+   Age based arbitration that only looks at occupied VCs.
+
+   Makes the same decisions as xbar_arb_age, but only reads the VC
+   heads of ports that have an event waiting and, within those ports,
+   only the VCs marked in the occupancy bitmap.
+ */
+class xbar_arb_age_occ : public XbarArbitration {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_age_occ,
+        "merlin",
+        "xbar_arb_age_occ",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Age based arbitration unit for hr_router that only examines occupied VCs.  Same arbitration decisions as xbar_arb_age.",
+        SST::Merlin::XbarArbitration
+    )
+
+private:
+    /**
+       Structure for sorting priority based on age
+     */
+    struct priority_entry_t {
+        uint16_t port = 0;
+        uint16_t vc = 0;
+        uint16_t next_port = 0;
+        uint16_t next_vc = 0;
+        SimTime_t injection_time = 0;
+        int size_in_flits = 0;
+
+        priority_entry_t() = default;
+
+        priority_entry_t(uint16_t port, uint16_t vc) :
+            port(port),
+            vc(vc),
+            next_port(0),
+            next_vc(0),
+            injection_time(0),
+            size_in_flits(0)
+        {}
+
+        void serialize_order(SST::Core::Serialization::serializer& ser)
+        {
+            SST_SER(port);
+            SST_SER(vc);
+            SST_SER(next_port);
+            SST_SER(next_vc);
+            SST_SER(injection_time);
+            SST_SER(size_in_flits);
+        }
+    };
+
+    /** To use with STL priority queues, that order in reverse. */
+    class time_priority {
+    public:
+        /** Compare based off pointers */
+        inline bool operator()(const priority_entry_t* lhs, const priority_entry_t* rhs) const {
+            return lhs->injection_time > rhs->injection_time;
+        }
+
+        /** Compare based off references */
+        inline bool operator()(const priority_entry_t& lhs, const priority_entry_t& rhs) {
+            return lhs.injection_time > rhs.injection_time;
+        }
+    };
+
+    class port_priority {
+    public:
+        /** Compare based off pointers */
+        inline bool operator()(const priority_entry_t* lhs, const priority_entry_t* rhs) const {
+            return lhs->port > rhs->port;
+        }
+
+        /** Compare based off references */
+        inline bool operator()(const priority_entry_t& lhs, const priority_entry_t& rhs) {
+            return lhs.port > rhs.port;
+        }
+    };
+
+    typedef std::priority_queue<priority_entry_t*, std::vector<priority_entry_t*>, xbar_arb_age_occ::time_priority> age_queue_t;
+    age_queue_t age_queue;
+
+    priority_entry_t* entries = nullptr;
+
+    int num_ports = 0;
+    int num_vcs = 0;
+
+    int total_entries = 0;
+
+    xbar_occupancy occupancy;
+
+public:
+
+    xbar_arb_age_occ() = default;
+
+    xbar_arb_age_occ(ComponentId_t cid, Params& params) :
+        XbarArbitration(cid)
+    {
+    }
+
+    ~xbar_arb_age_occ() {
+        delete[] entries;
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        XbarArbitration::serialize_order(ser);
+        SST_SER(num_ports);
+        SST_SER(num_vcs);
+        SST_SER(total_entries);
+
+        SST_SER(SST::Core::Serialization::array(entries, total_entries));
+        SST_SER(occupancy);
+    }
+    ImplementSerializable(SST::Merlin::xbar_arb_age_occ)
+
+    void setPorts(int num_ports_s, int num_vcs_s) override
+    {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        total_entries = num_ports * num_vcs;
+        entries = new priority_entry_t[total_entries];
+
+        int index = 0;
+        for ( int i = 0; i < num_ports; i++ ) {
+            for ( int j = 0; j < num_vcs; j++ ) {
+                entries[index++] = priority_entry_t(i,j);
+            }
+        }
+
+        occupancy.init(num_ports, num_vcs);
+    }
+
+    bool trackVCOccupancy() override { return true; }
+
+    void reportVCOccupancy(int port, int vc, bool occupied) override
+    {
+        if ( occupied ) occupancy.set(port, vc);
+        else occupancy.clear(port, vc);
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   ) override
+    {
+
+        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+
+
+        // Find all ports that have data and who's inputs to the xbar
+        // aren't busy.  Sort them by prioritizing on injection time.
+        // Oldest gets top priority.  Only occupied VCs are visited.
+        for ( int i = occupancy.nextPort(0); i != -1; i = occupancy.nextPort(i + 1) ) {
+            if ( in_port_busy[i] > 0 ) {
+                continue; // No need to consider port if input to xbar is busy
+            }
+
+            internal_router_event** vc_heads = ports[i]->getVCHeads();
+            for ( int j = occupancy.nextVC(i, 0); j != -1; j = occupancy.nextVC(i, j + 1) ) {
+                int index = i * num_vcs + j;
+                entries[index].next_port = vc_heads[j]->getNextPort();
+                entries[index].next_vc = vc_heads[j]->getVC();
+                entries[index].injection_time = vc_heads[j]->getEncapsulatedEvent()->getInjectionTime();
+                entries[index].size_in_flits = vc_heads[j]->getFlitCount();
+
+                age_queue.push(&entries[index]);
+            }
+
+        }
+
+        while ( !age_queue.empty() ) {
+
+            priority_entry_t* entry = age_queue.top();
+            age_queue.pop();
+
+            int port = entry->port;
+            int vc = entry->vc;
+
+            // if the input to the xbar for this port is busy, nothing
+            // to do.  This will only happen at this point if a higher
+            // priority VC from this port was satisfied this cycle.
+            if ( in_port_busy[port] <= 0 ) {
+                // Have an event, see if it can be progressed
+                int next_port = entry->next_port;
+                int next_vc = entry->next_vc;
+
+                // We can progress if the next port's output from xbar
+                // is not busy and there are enough credits.
+                if ( out_port_busy[next_port] <= 0 &&
+                     ports[next_port]->spaceToSend(next_vc, entry->size_in_flits) ) {
+
+                    // Tell the router what to move
+                    progress_vc[port] = vc;
+
+                    // Need to set the busy values
+                    in_port_busy[port] = entry->size_in_flits;
+                    out_port_busy[next_port] = entry->size_in_flits;
+
+                }
+                else {
+                    progress_vc[port] = -2;
+                }
+            }
+        }
+
+        return;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) override
+    {}
+
+    void dumpState(std::ostream& stream) override
+    {
+        stream << "  Occupied VCs:" << std::endl;
+        for ( int i = occupancy.nextPort(0); i != -1; i = occupancy.nextPort(i + 1) ) {
+            for ( int j = occupancy.nextVC(i, 0); j != -1; j = occupancy.nextVC(i, j + 1) ) {
+                stream << "    " << i << ", " << j << std::endl;
+            }
+        }
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_OCC_H
@@ -0,0 +1,218 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_LRU_OCC_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_LRU_OCC_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+/**
+   Least recently used arbitration that only looks at occupied VCs.
+
+   Makes the same decisions as xbar_arb_lru.  xbar_arb_lru keeps every
+   port/VC pair in a priority list; pairs that win go to the bottom
+   (the first winner of a cycle ends up last) and all others keep
+   their relative order.  Here each pair instead carries a stamp that
+   only increases when it wins, so the list order is the stamp order.
+   Only pairs with an event at their VC head are kept in the active
+   list, sorted by stamp, so each cycle touches only non-empty VCs.
+ */
+class xbar_arb_lru_occ : public XbarArbitration {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_lru_occ,
+        "merlin",
+        "xbar_arb_lru_occ",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Least recently used arbitration unit for hr_router that only examines occupied VCs.  Same arbitration decisions as xbar_arb_lru.",
+        SST::Merlin::XbarArbitration
+    )
+
+
+private:
+    int num_ports = 0;
+    int num_vcs = 0;
+
+    int total_entries = 0;
+
+    // Position of each port/VC pair (index port * num_vcs + vc) in the
+    // LRU order; lower stamps have higher priority
+    std::vector<uint64_t> stamp;
+    uint64_t next_stamp = 0;
+
+    // Occupied pairs, sorted by stamp
+    std::vector<int> active;
+    // Scratch lists used to reorder active each cycle
+    std::vector<int> unsat;
+    std::vector<int> sat;
+
+public:
+
+    xbar_arb_lru_occ() : XbarArbitration() {}
+
+    xbar_arb_lru_occ(ComponentId_t cid, Params& param) :
+        XbarArbitration(cid)
+    {
+    }
+
+    ~xbar_arb_lru_occ() {
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        XbarArbitration::serialize_order(ser);
+        SST_SER(num_ports);
+        SST_SER(num_vcs);
+        SST_SER(total_entries);
+        SST_SER(stamp);
+        SST_SER(next_stamp);
+        SST_SER(active);
+
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
+            unsat.reserve(total_entries);
+            sat.reserve(total_entries);
+        }
+    }
+    ImplementSerializable(SST::Merlin::xbar_arb_lru_occ)
+
+    void setPorts(int num_ports_s, int num_vcs_s) override
+    {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        total_entries = num_ports * num_vcs;
+
+        // Same initial order as xbar_arb_lru
+        stamp.resize(total_entries);
+        for ( int i = 0; i < total_entries; i++ ) stamp[i] = i;
+        next_stamp = total_entries;
+
+        active.reserve(total_entries);
+        unsat.reserve(total_entries);
+        sat.reserve(total_entries);
+    }
+
+    bool trackVCOccupancy() override { return true; }
+
+    void reportVCOccupancy(int port, int vc, bool occupied) override
+    {
+        int entry = port * num_vcs + vc;
+        auto cmp = [this](int a, int b) { return stamp[a] < stamp[b]; };
+        if ( occupied ) {
+            active.insert(std::upper_bound(active.begin(), active.end(), entry, cmp), entry);
+        }
+        else {
+            auto it = std::lower_bound(active.begin(), active.end(), entry, cmp);
+            if ( it != active.end() && *it == entry ) active.erase(it);
+        }
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   ) override
+    {
+
+        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+
+        if ( active.empty() ) return;
+
+        unsat.clear();
+        sat.clear();
+
+        for ( int entry : active ) {
+
+            int port = entry / num_vcs;
+            int vc = entry - port * num_vcs;
+
+            // If the input to the xbar for this port is busy, nothing
+            // to do.  Only occupied VCs are in the active list, so
+            // there is always an event.
+            if ( in_port_busy[port] > 0 ) {
+                unsat.push_back(entry);
+                continue;
+            }
+
+            internal_router_event* src_event = ports[port]->getVCHeads()[vc];
+            int next_port = src_event->getNextPort();
+            int next_vc = src_event->getVC();
+
+            // We can progress if the next port's input is not
+            // busy and there are enough credits.
+            if ( out_port_busy[next_port] <= 0 &&
+                 ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+
+                // Tell the router what to move
+                progress_vc[port] = vc;
+
+                // Need to set the busy values
+                in_port_busy[port] = src_event->getFlitCount();
+                out_port_busy[next_port] = src_event->getFlitCount();
+
+                sat.push_back(entry);
+            }
+            else {
+                unsat.push_back(entry);
+                progress_vc[port] = -2;
+            }
+        }
+
+        if ( sat.empty() ) return;
+
+        // Satisfied pairs move to the bottom of the order with the
+        // first one satisfied last.  Everything else keeps its place.
+        active.swap(unsat);
+        for ( auto it = sat.rbegin(); it != sat.rend(); ++it ) {
+            stamp[*it] = next_stamp++;
+            active.push_back(*it);
+        }
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) override
+    {}
+
+    void dumpState(std::ostream& stream) override
+    {
+        stream << "  Occupied VCs in priority order:" << std::endl;
+        for ( int entry : active ) {
+            stream << "    " << entry / num_vcs << ", " << entry % num_vcs << std::endl;
+        }
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_LRU_OCC_H
@@ -0,0 +1,212 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_RR_OCC_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_RR_OCC_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <vector>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hr_router/xbar_occupancy.h"
+
+namespace SST {
+namespace Merlin {
+
+/**
+   Round robin arbitration that only looks at occupied VCs.
+
+   Makes the same decisions as xbar_arb_rr, but uses an occupancy
+   bitmap to jump straight to the next non-empty VC of a port instead
+   of checking every VC head, and skips reading the VC heads of ports
+   that have nothing to send.
+ */
+class xbar_arb_rr_occ : public XbarArbitration {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_rr_occ,
+        "merlin",
+        "xbar_arb_rr_occ",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Round robin arbitration unit for hr_router that only examines occupied VCs.  Same arbitration decisions as xbar_arb_rr.",
+        SST::Merlin::XbarArbitration
+    )
+
+
+private:
+    int num_ports = 0;
+    int num_vcs = 0;
+
+    std::vector<int> rr_vcs;
+    int rr_port = 0;
+
+#if VERIFY_DECLOCKING
+    int rr_port_shadow = 0;
+#endif
+
+    xbar_occupancy occupancy;
+
+public:
+
+    xbar_arb_rr_occ() = default;
+
+    xbar_arb_rr_occ(ComponentId_t cid, Params& params) :
+        XbarArbitration(cid)
+    {
+    }
+
+    ~xbar_arb_rr_occ() {
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        XbarArbitration::serialize_order(ser);
+        SST_SER(num_ports);
+        SST_SER(num_vcs);
+        SST_SER(rr_port);
+#if VERIFY_DECLOCKING
+        SST_SER(rr_port_shadow);
+#endif
+        SST_SER(rr_vcs);
+        SST_SER(occupancy);
+    }
+    ImplementSerializable(SST::Merlin::xbar_arb_rr_occ)
+
+    void setPorts(int num_ports_s, int num_vcs_s) override
+    {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        rr_vcs.assign(num_ports, 0);
+
+        rr_port = 0;
+#if VERIFY_DECLOCKING
+        rr_port_shadow = 0;
+#endif
+        occupancy.init(num_ports, num_vcs);
+    }
+
+    bool trackVCOccupancy() override { return true; }
+
+    void reportVCOccupancy(int port, int vc, bool occupied) override
+    {
+        if ( occupied ) occupancy.set(port, vc);
+        else occupancy.clear(port, vc);
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   ) override
+    {
+        // Run through each of the ports, giving first pick in a round robin fashion
+        for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
+
+            // Overwrite old data
+            progress_vc[port] = -1;
+            // if the output of this port is busy, nothing to do.
+            if ( in_port_busy[port] > 0 ) {
+                continue;
+            }
+
+            if ( occupancy.portOccupied(port) ) {
+                internal_router_event** vc_heads = ports[port]->getVCHeads();
+
+                // Visit the occupied VCs starting at rr_vcs[port],
+                // wrapping around to the ones below it
+                int start = rr_vcs[port];
+                int vc = occupancy.nextVC(port, start);
+                bool wrapped = false;
+                while ( true ) {
+                    if ( vc == -1 || (wrapped && vc >= start) ) {
+                        if ( wrapped || start == 0 ) break;
+                        wrapped = true;
+                        vc = occupancy.nextVC(port, 0);
+                        continue;
+                    }
+
+                    internal_router_event* src_event = vc_heads[vc];
+                    int next_port = src_event->getNextPort();
+                    int next_vc = src_event->getVC();
+
+                    // We can progress if the next port's input is not
+                    // busy and there are enough credits.
+                    if ( out_port_busy[next_port] <= 0 &&
+                         ports[next_port]->spaceToSend(next_vc, src_event->getFlitCount()) ) {
+
+                        // Tell the router what to move
+                        progress_vc[port] = vc;
+
+                        // Need to set the busy values
+                        in_port_busy[port] = src_event->getFlitCount();
+                        out_port_busy[next_port] = src_event->getFlitCount();
+                        break;  // Go to next port;
+                    }
+                    vc = occupancy.nextVC(port, vc + 1);
+                }
+            }
+            // Increment rr_vcs for next time
+            rr_vcs[port] = (rr_vcs[port] + 1) % num_vcs;
+        }
+        rr_port = (rr_port + 1) % num_ports;
+
+#if VERIFY_DECLOCKING
+        if ( clocking ) {
+            rr_port_shadow = rr_port;
+        }
+#endif
+
+        return;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) override
+    {
+#if VERIFY_DECLOCKING
+        rr_port_shadow = (rr_port_shadow + cycles) % num_ports;
+        if ( rr_port_shadow != rr_port ) std::cout << "  PROBLEM:  rr_port = "
+                         << rr_port << ", rr_port_shadow = " << rr_port_shadow <<
+                         ", cycles = " << cycles << std::endl;
+#else
+        rr_port = (rr_port + cycles) % num_ports;
+#endif
+    }
+
+    void dumpState(std::ostream& stream) override
+    {
+        stream << "Current round robin port: " << rr_port << std::endl;
+        stream << "  Current round robin VC by port:" << std::endl;
+        for ( int i = 0; i < num_ports; i++ ) {
+            stream << i << ": " << rr_vcs[i] << std::endl;
+        }
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_RR_OCC_H
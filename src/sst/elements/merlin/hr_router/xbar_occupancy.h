@@ -0,0 +1,115 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_OCCUPANCY_H
+#define COMPONENTS_HR_ROUTER_XBAR_OCCUPANCY_H
+
+#include <sst/core/serialization/serializer.h>
+
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/**
+   Bitmap of which input VCs currently have an event at their head.
+
+   Kept up to date by the occupancy-driven crossbar arbiters from the
+   XbarArbitration::reportVCOccupancy() notifications, so that
+   arbitration only has to look at VCs that hold an event instead of
+   walking every port/VC pair each cycle.  A second level bitmap marks
+   the ports that have at least one occupied VC.
+ */
+class xbar_occupancy {
+
+    int num_ports = 0;
+    int num_vcs = 0;
+    int vc_words = 0;
+
+    std::vector<uint64_t> vc_bits;      // vc_words per port
+    std::vector<uint64_t> port_bits;
+    std::vector<int> port_count;        // Occupied VCs per port
+
+    // Returns lowest set bit >= start in words[0..count), or -1
+    static int nextBit(const uint64_t* words, int count, int start) {
+        int word = start >> 6;
+        if ( word >= count ) return -1;
+        uint64_t w = words[word] & (~(uint64_t)0 << (start & 63));
+        while ( true ) {
+            if ( w ) return (word << 6) + __builtin_ctzll(w);
+            if ( ++word == count ) return -1;
+            w = words[word];
+        }
+    }
+
+public:
+
+    void init(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+        vc_words = (num_vcs + 63) / 64;
+        vc_bits.assign(num_ports * vc_words, 0);
+        port_bits.assign((num_ports + 63) / 64, 0);
+        port_count.assign(num_ports, 0);
+    }
+
+    inline void set(int port, int vc) {
+        uint64_t& w = vc_bits[port * vc_words + (vc >> 6)];
+        uint64_t mask = (uint64_t)1 << (vc & 63);
+        if ( w & mask ) return;
+        w |= mask;
+        if ( port_count[port]++ == 0 ) port_bits[port >> 6] |= (uint64_t)1 << (port & 63);
+    }
+
+    inline void clear(int port, int vc) {
+        uint64_t& w = vc_bits[port * vc_words + (vc >> 6)];
+        uint64_t mask = (uint64_t)1 << (vc & 63);
+        if ( !(w & mask) ) return;
+        w &= ~mask;
+        if ( --port_count[port] == 0 ) port_bits[port >> 6] &= ~((uint64_t)1 << (port & 63));
+    }
+
+    inline bool isSet(int port, int vc) const {
+        return (vc_bits[port * vc_words + (vc >> 6)] >> (vc & 63)) & 1;
+    }
+
+    inline bool portOccupied(int port) const { return port_count[port] != 0; }
+
+    // Next occupied VC of port that is >= vc, -1 if none
+    inline int nextVC(int port, int vc) const {
+        return nextBit(&vc_bits[port * vc_words], vc_words, vc);
+    }
+
+    // Next port >= port with an occupied VC, -1 if none
+    inline int nextPort(int port) const {
+        return nextBit(port_bits.data(), port_bits.size(), port);
+    }
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) {
+        SST_SER(num_ports);
+        SST_SER(num_vcs);
+        SST_SER(vc_words);
+        SST_SER(vc_bits);
+        SST_SER(port_bits);
+        SST_SER(port_count);
+    }
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_OCCUPANCY_H
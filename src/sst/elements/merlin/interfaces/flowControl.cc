@@ -0,0 +1,355 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "flowControl.h"
+
+#include <sst/core/simulation.h>
+
+#include "merlin.h"
+#include "flow/flow_network.h"
+
+using namespace SST;
+using namespace Interfaces;
+
+namespace SST {
+namespace Merlin {
+
+FlowControl::FlowControl(ComponentId_t cid, Params &params, int vns) :
+    SST::Interfaces::SimpleNetwork(cid),
+    network(nullptr),
+    req_vns(vns),
+    id(-1), logical_nid(-1), use_nid_map(false),
+    receiveFunctor(nullptr), sendFunctor(nullptr),
+    network_initialized(false),
+    output(getSimulationOutput())
+{
+    // The link bandwidth is optional.  If it is not set, the router
+    // link bandwidth is used.
+    std::string link_bw_s = params.find<std::string>("link_bw","");
+    if ( link_bw_s != "" ) {
+        link_bw = UnitAlgebra(link_bw_s);
+        if ( !link_bw.hasUnits("B/s") && !link_bw.hasUnits("b/s") ) {
+            merlin_abort.fatal(CALL_INFO,1,"Error: link_bw must be specified in either B/s or b/s (SI prefix also allowed)\n");
+        }
+        if ( link_bw.hasUnits("B/s") ) {
+            link_bw *= UnitAlgebra("8b/B");
+        }
+    }
+
+    outbuf_size = params.find<UnitAlgebra>("output_buf_size","1kB");
+    if ( !outbuf_size.hasUnits("b") && !outbuf_size.hasUnits("B") ) {
+        merlin_abort.fatal(CALL_INFO,-1,"out_buf_size must be specified in either "
+                           "bits or bytes: %s\n",outbuf_size.toStringBestSI().c_str());
+    }
+    if ( outbuf_size.hasUnits("B") ) outbuf_size *= UnitAlgebra("8b/B");
+    outbuf_bits = outbuf_size.getRoundedValue();
+
+    // Need to get the right port_name
+    std::string port_name("rtr_port");
+    if ( isAnonymous() ) {
+        port_name = params.find<std::string>("port_name");
+    }
+
+    // The router link only carries untimed data
+    rtr_link = configureLink(port_name);
+    if (!rtr_link) {
+        merlin_abort.fatal(CALL_INFO,-1,"In %s, port '%s' must be connected\n", getName().c_str(), port_name.c_str());
+    }
+
+    // The flow model keeps time in ps
+    ps_tc = getTimeConverter("1ps");
+    delivery_link = configureSelfLink(port_name + "_delivery", "1ps",
+            new Event::Handler<FlowControl,&FlowControl::handle_delivery>(this));
+    timer_link = configureSelfLink(port_name + "_flow_timer", "1ps",
+            new Event::Handler<FlowControl,&FlowControl::handle_timer>(this));
+
+    network = FlowNetwork::getNetwork(params.find<std::string>("network_name",""));
+
+    input_queues.resize(req_vns);
+    outstanding_bits.assign(req_vns, 0);
+
+    // See if we need to set up a nid map
+    bool found = false;
+    int job_id = params.find<int>("job_id",-1,found);
+    use_nid_map = params.find<bool>("use_nid_remap",false);
+    if ( found ) {
+        if ( use_nid_map ) {
+            std::string nid_map_name = std::string("job_") + std::to_string(job_id) + "_nid_map";
+
+            int job_size = params.find<int>("job_size",-1);
+            if ( job_size == -1 ) {
+                merlin_abort.fatal(CALL_INFO,1,"FlowControl: job_size must be set\n");
+            }
+            logical_nid = params.find<nid_t>("logical_nid",-1);
+            if ( logical_nid == -1 ) {
+                merlin_abort.fatal(CALL_INFO,1,"FlowControl: logical_nid must be set\n");
+            }
+            nid_map.initialize(nid_map_name, job_size * sizeof(nid_t));
+        }
+    }
+    else {
+        std::string nid_map_name = params.find<std::string>("nid_map_name",std::string());
+        if ( !nid_map_name.empty() ) {
+            int job_size = params.find<int>("job_size",-1);
+            if ( job_size == -1 ) {
+                merlin_abort.fatal(CALL_INFO,1,"FlowControl: job_size must be set if nid_map_name is set\n");
+            }
+            logical_nid = params.find<nid_t>("logical_nid",-1);
+            if ( logical_nid == -1 ) {
+                merlin_abort.fatal(CALL_INFO,1,"FlowControl: logical_nid must be set if nid_map_name is set\n");
+            }
+            nid_map.initialize(nid_map_name, job_size * sizeof(nid_t));
+            use_nid_map = true;
+        }
+    }
+
+    // Register statistics
+    packet_latency = registerStatistic<uint64_t>("packet_latency");
+    send_bit_count = registerStatistic<uint64_t>("send_bit_count");
+}
+
+FlowControl::~FlowControl()
+{
+    FlowNetwork::release(network);
+}
+
+void FlowControl::setup()
+{
+    while ( init_events.size() ) {
+        delete init_events.front();
+        init_events.pop_front();
+    }
+}
+
+RtrInitEvent* FlowControl::checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func)
+{
+    bool good = true;
+    RtrInitEvent* init_ev = nullptr;
+    // Check to make sure the event isn't null and that it is an init event
+    if ( nullptr == ev || static_cast<BaseRtrEvent*>(ev)->getType() != BaseRtrEvent::INITIALIZATION ) good = false;
+
+    if ( good ) {
+        init_ev = static_cast<RtrInitEvent*>(ev);
+
+        // Now check to make sure this is the right protocol event
+        if ( init_ev->command != command ) {
+            good = false;
+        }
+    }
+
+    sst_assert(good, line, file, func, 1, "Error during FlowControl protocol initialization.  FlowControl must be connected to a merlin.flow_router.\n");
+    return init_ev;
+}
+
+void FlowControl::init(unsigned int phase)
+{
+    Event* ev;
+    RtrInitEvent* init_ev;
+    switch ( phase ) {
+    case 0:
+        // Router sends its link bandwidth and our ID this phase
+        break;
+    case 1:
+    {
+        // Actual link speed will be the minumum of the two sides
+        ev = rtr_link->recvUntimedData();
+        init_ev = checkInitProtocol(ev, RtrInitEvent::REPORT_BW, CALL_INFO);
+        if ( link_bw.getRoundedValue() == 0 || link_bw > init_ev->ua_value ) link_bw = init_ev->ua_value;
+        delete ev;
+
+        ev = rtr_link->recvUntimedData();
+        init_ev = checkInitProtocol(ev, RtrInitEvent::REPORT_ID, CALL_INFO);
+        id = init_ev->int_value;
+        if ( logical_nid == -1 ) logical_nid = id;
+        // If we have a nid_map, fill in my mapping
+        if ( use_nid_map ) {
+            nid_map.write(logical_nid,id);
+            nid_map.publish();
+        }
+        delete ev;
+
+        network->addEndpoint(id, this, link_bw.getDoubleValue() / 1e12);
+        network_initialized = true;
+    }
+        // Fall through to pick up any untimed data
+    default:
+        while ( ( ev = rtr_link->recvUntimedData() ) != nullptr ) {
+            BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+            if ( bev->getType() == BaseRtrEvent::PACKET ) {
+                init_events.push_back(static_cast<RtrEvent*>(ev));
+            }
+            else {
+                merlin_abort_full.fatal(CALL_INFO, 1, "Reached state where a non-RtrEvent was not handled.");
+            }
+        }
+        break;
+    }
+}
+
+void FlowControl::complete(unsigned int phase)
+{
+    Event* ev;
+    while ( ( ev = rtr_link->recvUntimedData() ) != nullptr ) {
+        BaseRtrEvent* bev = static_cast<BaseRtrEvent*>(ev);
+        if ( bev->getType() == BaseRtrEvent::PACKET ) {
+            init_events.push_back(static_cast<RtrEvent*>(ev));
+        }
+        else {
+            merlin_abort_full.fatal(CALL_INFO, 1, "Reached state where a non-RtrEvent was not handled.");
+        }
+    }
+}
+
+
+void FlowControl::finish(void)
+{
+    // Clean up all the events left in the queues
+    for ( auto& queue : input_queues ) {
+        while ( !queue.empty() ) {
+            delete queue.front();
+            queue.pop();
+        }
+    }
+}
+
+
+// Returns true if there is space in the output buffer and false
+// otherwise.
+bool FlowControl::send(SimpleNetwork::Request* req, int vn) {
+    // Check to see if the VN is in range
+    if ( vn >= req_vns ) return false;
+    if ( !spaceToSend(vn, req->size_in_bits) ) return false;
+
+    req->vn = vn;
+
+    // Check to see if we need to do a nid translation
+    if ( use_nid_map ) req->dest = nid_map[req->dest];
+
+    RtrEvent* ev = new RtrEvent(req,id,vn);
+    ev->setInjectionTime(getCurrentSimTimeNano());
+
+    outstanding_bits[vn] += req->size_in_bits;
+    send_bit_count->addData(req->size_in_bits);
+
+    if ( ev->getTraceType() != SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Send on FlowControl in NIC: %s\n",ev->getTraceID(),
+                      getCurrentSimTimeNano(), getName().c_str());
+    }
+
+    network->startFlow(this, ev, getCurrentTimePs());
+    return true;
+}
+
+
+bool FlowControl::spaceToSend(int vn, int bits) {
+    return outstanding_bits[vn] + bits <= outbuf_bits;
+}
+
+
+// Returns nullptr if no event in input_queues[vn]. Otherwise, returns
+// the next event.
+SST::Interfaces::SimpleNetwork::Request* FlowControl::recv(int vn) {
+    if ( input_queues[vn].empty() ) return nullptr;
+
+    RtrEvent* event = input_queues[vn].front();
+    input_queues[vn].pop();
+
+    if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: recv called on FlowControl in NIC: %s\n",event->getTraceID(),
+                      getCurrentSimTimeNano(), getName().c_str());
+    }
+
+    SST::Interfaces::SimpleNetwork::Request* ret = event->takeRequest();
+    if ( use_nid_map ) ret->dest = logical_nid;
+    delete event;
+
+    return ret;
+}
+
+void FlowControl::sendUntimedData(SST::Interfaces::SimpleNetwork::Request* req)
+{
+    if ( use_nid_map && req->dest != SimpleNetwork::INIT_BROADCAST_ADDR ) {
+        req->dest = nid_map[req->dest];
+    }
+    rtr_link->sendUntimedData(new RtrEvent(req,id,0));
+}
+
+SST::Interfaces::SimpleNetwork::Request* FlowControl::recvUntimedData()
+{
+    if ( init_events.size() ) {
+        RtrEvent *ev = init_events.front();
+        init_events.pop_front();
+        SST::Interfaces::SimpleNetwork::Request* ret = ev->takeRequest();
+        delete ev;
+        return ret;
+    } else {
+        return nullptr;
+    }
+}
+
+
+void FlowControl::scheduleTimer(SimTime_t delay, uint64_t epoch)
+{
+    timer_link->send(delay, new FlowTimerEvent(epoch));
+}
+
+void FlowControl::flowSent(int vn, uint64_t bits)
+{
+    outstanding_bits[vn] -= bits;
+    if ( sendFunctor != nullptr ) {
+        bool keep = (*sendFunctor)(vn);
+        if ( !keep ) sendFunctor = nullptr;
+    }
+}
+
+void FlowControl::deliver(RtrEvent* ev, SimTime_t delay)
+{
+    delivery_link->send(delay, ev);
+}
+
+void FlowControl::handle_timer(Event* ev)
+{
+    FlowTimerEvent* te = static_cast<FlowTimerEvent*>(ev);
+    network->handleTimer(te->epoch, getCurrentTimePs());
+    delete te;
+}
+
+void FlowControl::handle_delivery(Event* ev)
+{
+    RtrEvent* event = static_cast<RtrEvent*>(ev);
+    int vn = event->getLogicalVN();
+
+    input_queues[vn].push(event);
+
+    if ( event->getTraceType() == SimpleNetwork::Request::FULL ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Received an event on FlowControl in NIC: %s"
+                      " on VN %d from src %" PRIu64 "\n",
+                      event->getTraceID(),
+                      getCurrentSimTimeNano(),
+                      getName().c_str(),
+                      event->getRouteVN(),
+                      event->getTrustedSrc());
+    }
+
+    packet_latency->addData(getCurrentSimTimeNano() - event->getInjectionTime());
+    if ( receiveFunctor != nullptr ) {
+        bool keep = (*receiveFunctor)(vn);
+        if ( !keep ) receiveFunctor = nullptr;
+    }
+}
+
+} // namespace Merlin
+} // namespace SST
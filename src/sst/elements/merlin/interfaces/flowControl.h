@@ -0,0 +1,181 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_MERLIN_FLOWCONTROL_H
+#define COMPONENTS_MERLIN_FLOWCONTROL_H
+
+#include <sst/core/subcomponent.h>
+#include <sst/core/unitAlgebra.h>
+
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <sst/core/statapi/statbase.h>
+#include <sst/core/shared/sharedArray.h>
+
+#include "sst/elements/merlin/router.h"
+
+#include <deque>
+#include <queue>
+
+namespace SST {
+
+class Component;
+
+namespace Merlin {
+
+class FlowNetwork;
+
+/**
+   SimpleNetwork interface for the flow level network model.  Must be
+   connected to a merlin.flow_router.
+
+   Each Request sent is modeled as one flow through the network by the
+   FlowNetwork.  A Request occupies the output buffer until its last
+   bit has been injected, and is delivered to the destination after
+   the latency of the path.  Receive buffers are unbounded.
+
+   Like merlin.flow_router, FlowControl is not checkpointable.
+ */
+class FlowControl : public SST::Interfaces::SimpleNetwork {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        FlowControl,
+        "merlin",
+        "flowcontrol",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Network interface for the flow level network model.  Must be connected to a merlin.flow_router.  Does not support checkpointing.",
+        SST::Interfaces::SimpleNetwork
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"port_name",          "Port name to connect to.  Only used when loaded anonymously",""},
+        {"network_name",       "Name of the flow network.  Must match the network_name of the merlin.flow_router objects.",""},
+        {"link_bw",            "Bandwidth of the link specified in either b/s or B/s (can include SI prefix).  The minimum of this and the router link_bw is used."},
+        {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix).","1kB"},
+        {"job_id",             "ID of the job this enpoint is part of.", "" },
+        {"job_size",           "Number of nodes in the job this endpoint is part of.",""},
+        {"logical_nid",        "My logical NID", "" },
+        {"use_nid_remap",      "If true, will remap logical nids in job to physical ids", "false" },
+        {"nid_map_name",       "Base name of shared region where my NID map will be located.  If empty, no NID map will be used.",""},
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "packet_latency",     "Histogram of latencies for received packets", "latency", 1},
+        { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"rtr_port", "Port that connects to router", { "merlin.RtrEvent", "merlin.RtrInitEvent" } },
+    )
+
+
+private:
+
+    // Link to router.  Only used during init and complete.
+    Link* rtr_link;
+    // Self link used to deliver received packets after the latency
+    // of their path
+    Link* delivery_link;
+    // Self link used by the FlowNetwork to schedule its work
+    Link* timer_link;
+
+    TimeConverter ps_tc;
+
+    FlowNetwork* network;
+
+    UnitAlgebra link_bw;
+    UnitAlgebra outbuf_size;
+
+    // Initialization events received from network
+    std::deque<RtrEvent*> init_events;
+
+    int req_vns;
+
+    // Bits of each VN that are still being injected
+    std::vector<uint64_t> outstanding_bits;
+    uint64_t outbuf_bits;
+
+    std::vector<std::queue<RtrEvent*>> input_queues;
+
+    nid_t id;
+    nid_t logical_nid;
+    Shared::SharedArray<nid_t> nid_map;
+    bool use_nid_map;
+
+    HandlerBase* receiveFunctor;
+    HandlerBase* sendFunctor;
+
+    bool network_initialized;
+
+    Statistic<uint64_t>* packet_latency;
+    Statistic<uint64_t>* send_bit_count;
+
+    Output& output;
+
+    RtrInitEvent* checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func);
+
+    void handle_delivery(Event* ev);
+    void handle_timer(Event* ev);
+
+public:
+    FlowControl(ComponentId_t cid, Params &params, int vns);
+
+    ~FlowControl();
+
+    void setup() override;
+    void init(unsigned int phase) override;
+    void complete(unsigned int phase) override;
+    void finish() override;
+
+    bool send(SST::Interfaces::SimpleNetwork::Request* req, int vn) override;
+
+    bool spaceToSend(int vn, int bits) override;
+
+    SST::Interfaces::SimpleNetwork::Request* recv(int vn) override;
+
+    bool requestToReceive( int vn ) override { return ! input_queues[vn].empty(); }
+
+    void sendUntimedData(SST::Interfaces::SimpleNetwork::Request* ev) override;
+    SST::Interfaces::SimpleNetwork::Request* recvUntimedData() override;
+
+    inline void setNotifyOnReceive(HandlerBase* functor) override { receiveFunctor = functor; }
+    inline void setNotifyOnSend(HandlerBase* functor) override { sendFunctor = functor; }
+
+    inline bool isNetworkInitialized() const  override{ return network_initialized; }
+    inline nid_t getEndpointID() const  override
+    {
+        if ( use_nid_map ) {
+            return logical_nid;
+        }
+        else {
+            return id;
+        }
+    }
+    inline const UnitAlgebra& getLinkBW() const override { return link_bw; }
+
+    // Called by the FlowNetwork
+    nid_t getPhysicalID() const { return id; }
+    SimTime_t getCurrentTimePs() { return getCurrentSimTime(ps_tc); }
+    void scheduleTimer(SimTime_t delay, uint64_t epoch);
+    void flowSent(int vn, uint64_t bits);
+    void deliver(RtrEvent* ev, SimTime_t delay);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_FLOWCONTROL_H
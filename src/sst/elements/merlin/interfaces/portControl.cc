@@ -45,7 +45,7 @@ PortControl::sendCtrlEvent(CtrlRtrEvent* ev)
     // If the control event is zero length (meaning they take no
 	// bandwidth), just send immediately
 	if ( ev->getSizeInFlits() == 0 ) {
-	    port_link->send(1,ev);
+	    linkSend(ev);
 	    return;
 	}
 
@@ -122,6 +122,7 @@ PortControl::recv(int vc)
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
 	    parent->dec_vcs_with_data();
+	    if ( parent->trackVCOccupancy() ) parent->reportVCOccupancy(parent_port, vc, false);
 	}
 	else {
         auto event = input_buf[vc].front();
@@ -136,7 +137,7 @@ PortControl::recv(int vc)
 	// For now, we're just going to send the credits back to the
 	// other side.  The required BW to do this will not be taken
 	// into account.
-	port_link->send(1,new credit_event(vc_return,port_ret_credits[vc_return]));
+	linkSend(new credit_event(vc_return,port_ret_credits[vc_return]));
 	port_ret_credits[vc_return] = 0;
 
 #if TRACK
@@ -258,6 +259,11 @@ PortControl::serialize_order(SST::Core::Serialization::serializer& ser) {
     SST_SER(remote_rtr_id);
     SST_SER(remote_port_number);
     SST_SER(connected);
+    SST_SER(parent_port);
+    SST_SER(local_peer);
+    SST_SER(local_delay);
+    SST_SER(local_input_delay);
+    SST_SER(local_output_delay);
 
     if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK ) {
         if ( connected ) {
@@ -409,6 +415,14 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
 
     std::string output_latency_timebase = params.find<std::string>("output_latency","0ns");
 
+    parent_port = params.find<int>("parent_port", -1);
+    if ( parent_port == -1 ) parent_port = port_number;
+
+    // Ports wired to another router inside a router_group have no
+    // SST Link.  Events go through the parent, and port_link is a
+    // self link the peer port sends untimed data on.
+    bool local_link = params.find<bool>("local_link", false);
+
 
     // Configure the links.  output_timing will have a temporary time bases.  It will be
     // changed once the final link BW is set.
@@ -430,8 +444,14 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
         // links during init, so we'll configure things during setup
         // to abort on sends from then on.
         host_port = false;
-        port_link = configureLink(link_port_name, output_latency_timebase,
-                                  new Event::Handler<PortControl,&PortControl::handle_input_r2r>(this));
+        if ( local_link ) {
+            port_link = configureSelfLink(link_port_name + "_local", "1ps",
+                                          new Event::Handler<PortControl,&PortControl::handle_input_r2r>(this));
+        }
+        else {
+            port_link = configureLink(link_port_name, output_latency_timebase,
+                                      new Event::Handler<PortControl,&PortControl::handle_input_r2r>(this));
+        }
         if ( port_link != NULL ) {
             output_timing = configureSelfLink(link_port_name + "_output_timing", "1GHz",
                                               new Event::Handler<PortControl,&PortControl::handle_output>(this));
@@ -482,7 +502,12 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     }
 
     std::string input_latency_timebase = params.find<std::string>("input_latency",found);
-    if ( port_link && found ) {
+    if ( local_link ) {
+        // Local hops are timed in ps, see setLocalPeer()
+        if ( found ) local_input_delay = (UnitAlgebra(input_latency_timebase) / UnitAlgebra("1ps")).getRoundedValue();
+        local_output_delay = (UnitAlgebra(output_latency_timebase) / UnitAlgebra("1ps")).getRoundedValue();
+    }
+    else if ( port_link && found ) {
         port_link->addRecvLatency(1,input_latency_timebase);
     }
 
@@ -748,31 +773,31 @@ PortControl::init(unsigned int phase) {
         init_ev->command = RtrInitEvent::REPORT_BW;
         init_ev->ua_value = link_bw;
 
-        port_link->sendUntimedData(init_ev);
+        linkSendUntimed(init_ev);
 
         // If this is a host port, send the endpoint ID to the LinkControl
         if ( topo->isHostPort(port_number) ) {
             init_ev = new RtrInitEvent();
             init_ev->command = RtrInitEvent::REPORT_FLIT_SIZE;
             init_ev->ua_value = flit_size;
-            port_link->sendUntimedData(init_ev);
+            linkSendUntimed(init_ev);
 
             RtrInitEvent* ev = new RtrInitEvent();
             ev->command = RtrInitEvent::REPORT_ID;
             ev->int_value = topo->getEndpointID(port_number);
-            port_link->sendUntimedData(ev);
+            linkSendUntimed(ev);
         }
         else {
             // Report router ID and port number to other side of link
             init_ev = new RtrInitEvent();
             init_ev->command = RtrInitEvent::REPORT_ID;
             init_ev->int_value = rtr_id;
-            port_link->sendUntimedData(init_ev);
+            linkSendUntimed(init_ev);
 
             init_ev = new RtrInitEvent();
             init_ev->command = RtrInitEvent::REPORT_PORT;
             init_ev->int_value = port_number;
-            port_link->sendUntimedData(init_ev);
+            linkSendUntimed(init_ev);
         }
         break;
     case 1:
@@ -810,7 +835,7 @@ PortControl::init(unsigned int phase) {
             init_ev = new RtrInitEvent();
             init_ev->command = RtrInitEvent::REQUEST_VNS;
             init_ev->int_value = num_vns;
-            port_link->sendUntimedData(init_ev);
+            linkSendUntimed(init_ev);
 
             for ( int i = 0; i < req_vns; ++i ) {
                 init_ev = new RtrInitEvent();
@@ -829,7 +854,7 @@ PortControl::init(unsigned int phase) {
                         }
                     }
                 }
-                port_link->sendUntimedData(init_ev);
+                linkSendUntimed(init_ev);
             }
 
         } else {
@@ -861,7 +886,7 @@ PortControl::init(unsigned int phase) {
                 int curr_vc = 0;
                 // Send credits to host, but only once for each VN
                 for ( int i = 0; i < num_vns; ++i ) {
-                    port_link->sendUntimedData(new credit_event(i,port_ret_credits[curr_vc]));
+                    linkSendUntimed(new credit_event(i,port_ret_credits[curr_vc]));
                     curr_vc += vcs_per_vn[i];
                 }
                 // Set all return credits to zero
@@ -877,7 +902,7 @@ PortControl::init(unsigned int phase) {
             // ready to receive credits, send the credit events.
             if ( remote_rdy_for_credits ) {
                 for ( int i = 0; i < num_vcs; i++ ) {
-                    port_link->sendUntimedData(new credit_event(i,port_ret_credits[i]));
+                    linkSendUntimed(new credit_event(i,port_ret_credits[i]));
                     port_ret_credits[i] = 0;
                 }
                 // Make sure we only send the credits once
@@ -925,10 +950,39 @@ void
 PortControl::sendUntimedData(Event *ev)
 {
     if ( connected ) {
-        port_link->sendUntimedData(ev);
+        linkSendUntimed(ev);
     }
 }
 
+void
+PortControl::setLocalPeer(PortControl* peer, SimTime_t link_delay)
+{
+    local_peer = peer;
+    local_delay = local_output_delay + link_delay + peer->local_input_delay;
+}
+
+void
+PortControl::recvLocal(Event* ev)
+{
+    // Same handlers that setup() installs on port_link
+    if ( topo->getPortState(port_number) == Topology::FAILED ) handle_failed(ev);
+    else handle_input_r2r(ev);
+}
+
+void
+PortControl::linkSend(Event* ev)
+{
+    if ( local_peer ) parent->sendLocal(local_peer, ev, local_delay);
+    else port_link->send(1,ev);
+}
+
+void
+PortControl::linkSendUntimed(Event* ev)
+{
+    if ( local_peer ) local_peer->port_link->sendUntimedData(ev);
+    else port_link->sendUntimedData(ev);
+}
+
 Event*
 PortControl::recvUntimedData()
 {
@@ -1077,6 +1131,7 @@ PortControl::handle_input_n2r(Event* ev)
             topo->route_packet(port_number, rtr_event->getVC(), rtr_event);
             vc_heads[curr_vc] = rtr_event;
             parent->inc_vcs_with_data();
+            if ( parent->trackVCOccupancy() ) parent->reportVCOccupancy(parent_port, curr_vc, true);
 	    }
 
 	    if ( event->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
@@ -1099,7 +1154,7 @@ PortControl::handle_input_n2r(Event* ev)
 	    // Should never get here
 	    break;
 	case BaseRtrEvent::CTRL:
-	    parent->recvCtrlEvent(port_number,static_cast<CtrlRtrEvent*>(ev));
+	    parent->recvCtrlEvent(parent_port,static_cast<CtrlRtrEvent*>(ev));
 	    break;
 	default:
 	    break;
@@ -1160,6 +1215,7 @@ PortControl::handle_input_r2r(Event* ev)
             topo->route_packet(port_number, event->getVC(), event);
             vc_heads[curr_vc] = event;
             parent->inc_vcs_with_data();
+            if ( parent->trackVCOccupancy() ) parent->reportVCOccupancy(parent_port, curr_vc, true);
 	    }
 
 	    if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
@@ -1179,7 +1235,7 @@ PortControl::handle_input_r2r(Event* ev)
 	}
     break;
 	case BaseRtrEvent::CTRL:
-	    parent->recvCtrlEvent(port_number,static_cast<CtrlRtrEvent*>(ev));
+	    parent->recvCtrlEvent(parent_port,static_cast<CtrlRtrEvent*>(ev));
 	    break;
 	default:
 	    break;
@@ -1208,7 +1264,7 @@ PortControl::handle_output(Event* ev) {
 	    output_timing->send(event->getSizeInFlits(),NULL);
 
 	    // Send event
-	    port_link->send(1,event);
+	    linkSend(event);
 	    return;
 	}
     // Use the output_arb to find VC to send
@@ -1275,12 +1331,12 @@ PortControl::handle_output(Event* ev) {
             if ( enable_congestion_management ) {
                 updateCongestionState(send_event);
             }
-            port_link->send(1,send_event->getEncapsulatedEvent());
+            linkSend(send_event->getEncapsulatedEvent());
             send_event->setEncapsulatedEvent(NULL);
             delete send_event;
 	    }
 	    else {
-            port_link->send(1,send_event);
+            linkSend(send_event);
 	    }
 	}
 	// TLG -- need to think about how to count a disabled link, is it stalled?
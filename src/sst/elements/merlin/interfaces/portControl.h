@@ -74,7 +74,9 @@ public:
         {"enable_congestion_management", "Turn on congestion management","false"},
         {"cm_outstanding_threshold", "Threshold for the amount of data outstanding to a host before congestion management can trigger","2*output_buf_size"},
         {"cm_pktsize_threshold", "Minimum size of a packet to be considered part of a stream with regards to congestion management","128B"},
-        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"}
+        {"cm_incast_threshold", "Numbr of hosts sending to an enpoint needed to trigger congestion management","6"},
+        {"parent_port",        "Index of this port in the parent router's port space (-1 means the same as the topology port number).  Set by router_group.","-1"},
+        {"local_link",         "Set to true when the other end of this port is a port of another router in the same router_group.  Events are handed to the peer port through the router_group instead of an SST Link.","false"}
     )
 
     // SST_ELI_DOCUMENT_STATISTICS(
@@ -211,6 +213,20 @@ private:
     Router* parent = nullptr;
     bool connected = false;
 
+    // Port number to use when talking to the parent router.  Differs
+    // from port_number when the parent models more than one router.
+    int parent_port = -1;
+
+    // When the other end of the port is a port of another router in
+    // the same router_group, events are handed to local_peer through
+    // the parent.  local_delay is the total latency of the hop in ps
+    // (output + link + peer input).  port_link is then a self link
+    // that only carries untimed data.
+    PortControl* local_peer = nullptr;
+    SimTime_t local_delay = 0;
+    SimTime_t local_input_delay = 0;
+    SimTime_t local_output_delay = 0;
+
     // Statistics
     Statistic<uint64_t>* send_bit_count;
     Statistic<uint64_t>* send_packet_count;
@@ -380,6 +396,13 @@ public:
     void sendUntimedData(Event *ev) override;
     Event* recvUntimedData() override;
 
+    // Wire this port to a port of another router modeled in the same
+    // component.  link_delay is the latency of the link itself in ps.
+    void setLocalPeer(PortControl* peer, SimTime_t link_delay);
+    bool isLocal() { return local_peer != nullptr; }
+    // Called by the parent to deliver an event sent by local_peer
+    void recvLocal(Event* ev);
+
     void dumpState(std::ostream& stream) override;
     void printStatus(Output& out, int out_port_busy, int in_port_busy) override;
 
@@ -403,6 +426,11 @@ private:
 	uint64_t increaseActive();
 
     void updateCongestionState(internal_router_event* send_event);
+
+    // Send over port_link, or to local_peer for ports wired inside a
+    // router_group
+    void linkSend(Event* ev);
+    void linkSendUntimed(Event* ev);
 };
 
 
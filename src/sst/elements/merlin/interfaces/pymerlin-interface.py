@@ -46,6 +46,33 @@ class LinkControl(NetworkInterface):
             return sub,"rtr_port"
 
 
+class FlowControl(NetworkInterface):
+    def __init__(self):
+        NetworkInterface.__init__(self)
+        self._declareParams("params",["link_bw","output_buf_size","network_name"])
+
+    # returns subcomp, port_name
+    def build(self,comp,slot,slot_num,job_id,job_size,logical_nid,use_nid_remap = False, link=None):
+        if self._check_first_build():
+            set_name = "params_%s"%self._instance_name
+            sst.addGlobalParams(set_name, self._getGroupParams("params"))
+            sst.addGlobalParam(set_name,"job_id",job_id)
+            sst.addGlobalParam(set_name,"job_size",job_size)
+            sst.addGlobalParam(set_name,"use_nid_remap",use_nid_remap)
+
+
+        sub = comp.setSubComponent(slot,"merlin.flowcontrol",slot_num)
+        self._applyStatisticsSettings(sub)
+        sub.addGlobalParamSet("params_%s"%self._instance_name)
+        sub.addParam("logical_nid",logical_nid)
+
+        if link:
+            sub.addLink(link, "rtr_port");
+            return True
+        else:
+            return sub,"rtr_port"
+
+
 class ReorderLinkControl(NetworkInterface):
     def __init__(self):
         NetworkInterface.__init__(self)
@@ -29,6 +29,9 @@
 #include "hr_router/xbar_arb_age.h"
 #include "hr_router/xbar_arb_rand.h"
 #include "hr_router/xbar_arb_lru_infx.h"
+#include "hr_router/xbar_arb_rr_occ.h"
+#include "hr_router/xbar_arb_lru_occ.h"
+#include "hr_router/xbar_arb_age_occ.h"
 
 #include "arbitration/single_arb_rr.h"
 #include "arbitration/single_arb_lru.h"
@@ -858,6 +858,50 @@ class hr_router(RouterTemplate):
         rtr.addParam("id",rtr_id)
         return rtr
 
+    # Instances a merlin.router_group, which models several routers in
+    # one component.  Port p of the i-th router in ids is port
+    # (i*radix+p) of the component and its topology goes in slot index i
+    # of getTopologySlotName().
+    def instanceRouterGroup(self, name, radix, ids):
+        if self._check_first_build():
+            sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+
+        rtr = sst.Component(name, "merlin.router_group")
+        self._applyStatisticsSettings(rtr)
+        rtr.addGlobalParamSet("%s_params"%self._instance_name)
+        rtr.addParam("num_ports",radix)
+        rtr.addParam("num_routers",len(ids))
+        rtr.addParam("ids",ids)
+        return rtr
+
+    def getTopologySlotName(self):
+        return "topology"
+
+class flow_router(RouterTemplate):
+    _default_linkcontrol = "sst.merlin.interface.FlowControl"
+
+    def __init__(self):
+        RouterTemplate.__init__(self)
+
+        self._declareParams("params",["link_bw","link_latency","host_link_latency","input_latency","output_latency",
+                                      "flit_size","num_vns","network_name"])
+
+
+    def getDefaultNetworkInterface(self):
+        module_name, class_name = flow_router._default_linkcontrol.rsplit(".", 1)
+        return getattr(import_module(module_name), class_name)()
+
+    def instanceRouter(self, name, radix, rtr_id):
+        if self._check_first_build():
+            sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+
+        rtr = sst.Component(name, "merlin.flow_router")
+        self._applyStatisticsSettings(rtr)
+        rtr.addGlobalParamSet("%s_params"%self._instance_name)
+        rtr.addParam("num_ports",radix)
+        rtr.addParam("id",rtr_id)
+        return rtr
+
     def getTopologySlotName(self):
         return "topology"
 
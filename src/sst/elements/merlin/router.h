@@ -26,6 +26,7 @@
 #include <sst/core/timeConverter.h>
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/sizeClassPool.h>
 
 #include <queue>
 
@@ -41,6 +42,7 @@ const int UNTIMED_BROADCAST_ADDR = -1;
 class TopologyEvent;
 class CtrlRtrEvent;
 class internal_router_event;
+class PortControl;
 
 class Router : public Component {
 private:
@@ -52,6 +54,10 @@ protected:
 
     int vcs_with_data;
 
+    // Set by routers whose crossbar arbiter wants to be told when a
+    // VC head is filled or drained (see reportVCOccupancy())
+    bool track_vc_occupancy = false;
+
     Router() : Component() {} // For serialization
 
 public:
@@ -72,6 +78,16 @@ public:
     inline void dec_vcs_with_data() { vcs_with_data--; }
     inline int get_vcs_with_data() { return vcs_with_data; }
 
+    inline bool trackVCOccupancy() { return track_vc_occupancy; }
+    // Called by ports when an input VC goes from empty to having a
+    // head event (occupied = true) or back to empty (occupied = false)
+    virtual void reportVCOccupancy(int port, int vc, bool occupied) {}
+
+    // Used by ports that are wired to a port of another router
+    // modeled in the same component (see router_group).  The event is
+    // handed to dest delay ps from now instead of being sent on a Link.
+    virtual void sendLocal(PortControl* dest, Event* ev, SimTime_t delay) {}
+
     virtual int const* getOutputBufferCredits() = 0;
     virtual void sendCtrlEvent(CtrlRtrEvent* ev, int port = -1) = 0;
     virtual void recvCtrlEvent(int port, CtrlRtrEvent* ev) = 0;
@@ -82,6 +98,7 @@ public:
         SST::Component::serialize_order(ser);
         SST_SER(requestNotifyOnEvent);
         SST_SER(vcs_with_data);
+        SST_SER(track_vc_occupancy);
     }
     ImplementVirtualSerializable(SST::Merlin::Router)
 };
@@ -96,6 +113,12 @@ public:
 
     inline RtrEventType getType() const { return type; }
 
+    // Packet, internal, credit and topology events are created and
+    // destroyed at every hop, so events of every subclass (including
+    // clone()s) are recycled through the pool
+    static void* operator new(size_t size) { return SizeClassPool::allocate(size); }
+    static void operator delete(void* ptr, size_t size) { SizeClassPool::release(ptr, size); }
+
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
         SST_SER(type);
@@ -675,6 +698,11 @@ public:
     virtual void setPorts(int num_ports, int num_vcs) = 0;
     virtual bool isOkayToPauseClock() { return true; }
     virtual void reportSkippedCycles(Cycle_t cycles) {};
+    // Arbiters that return true are notified through
+    // reportVCOccupancy() each time an input VC head is filled or
+    // drained, so they do not have to scan every VC head each cycle
+    virtual bool trackVCOccupancy() { return false; }
+    virtual void reportVCOccupancy(int port, int vc, bool occupied) {}
     virtual void dumpState(std::ostream& stream) {};
 
     void serialize_order(SST::Core::Serialization::serializer& ser) override {
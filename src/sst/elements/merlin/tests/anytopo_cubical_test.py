@@ -50,6 +50,10 @@ if __name__ == "__main__":
     router.output_buf_size = "32kB"
     router.num_vns = 2
     router.xbar_arb = "merlin.xbar_arb_rr"
+    # Optionally override the crossbar arbiter (e.g., an occupancy
+    # driven arbiter that should produce identical output)
+    if len(sys.argv) > 1:
+        router.xbar_arb = sys.argv[1]
 
     topo.router = router
     topo.link_latency = "20ns"
@@ -12,6 +12,7 @@
 # distribution.
 
 import sst
+import sys
 from sst.merlin.base import *
 from sst.merlin.endpoint import *
 from sst.merlin.interface import *
@@ -28,6 +29,11 @@ if __name__ == "__main__":
     topo.num_groups = 5
     topo.algorithm = ["minimal","ugal"]
 
+    # Optionally model each group as a single merlin.router_group,
+    # which should produce identical output
+    if len(sys.argv) > 1 and sys.argv[1] == "group_routers":
+        topo.group_routers = True
+
     group_size = topo.hosts_per_router * topo.routers_per_group
 
     # Set up the routers
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+#
+# Copyright 2009-2026 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2026, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.topology import *
+
+if __name__ == "__main__":
+
+    ### Setup the topology
+    topo = topoFatTree()
+    topo.shape = "4,4:4,4:4"
+
+    # Set up the flow level routers
+    router = flow_router()
+    router.link_bw = "4GB/s"
+    router.flit_size = "8B"
+    router.input_latency = "20ns"
+    router.output_latency = "20ns"
+    router.num_vns = 1
+
+    topo.router = router
+    topo.link_latency = "20ns"
+
+    ### set up the endpoint
+    networkif = FlowControl()
+    networkif.link_bw = "4GB/s"
+    networkif.output_buf_size = "1kB"
+
+    ep = TestJob(0,topo.getNumNodes())
+    ep.network_interface = networkif
+
+    system = System()
+    system.setTopology(topo)
+    system.allocateNodes(ep,"linear")
+
+    system.build()
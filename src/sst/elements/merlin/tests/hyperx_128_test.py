@@ -11,6 +11,7 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import sys
 import sst
 from sst.merlin.base import *
 from sst.merlin.endpoint import *
@@ -38,6 +39,10 @@ if __name__ == "__main__":
     router.output_buf_size = "4kB"
     router.num_vns = 2
     router.xbar_arb = "merlin.xbar_arb_lru"
+    # Optionally override the crossbar arbiter (e.g., an occupancy
+    # driven arbiter that should produce identical output)
+    if len(sys.argv) > 1:
+        router.xbar_arb = sys.argv[1]
 
     topo.router = router
     topo.link_latency = "20ns"
@@ -54,6 +54,35 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_hyperx_128(self):
          self.merlin_test_template("hyperx_128_test")
 
+    # The occupancy driven arbiters make the same decisions as the
+    # arbiters they mirror, so they are checked against the same output
+    def test_merlin_hyperx_128_lru_occ(self):
+         self.merlin_test_template("hyperx_128_test", model_option="merlin.xbar_arb_lru_occ")
+
+    # No reference file is generated with xbar_arb_age, so its own run
+    # on the same network is the reference
+    def test_merlin_hyperx_128_age_occ(self):
+         self.merlin_test_template("hyperx_128_test", model_option="merlin.xbar_arb_age_occ", ref_model_option="merlin.xbar_arb_age")
+
+    # Modeling each dragonfly group as one router_group changes how the
+    # routers are built, not the timing, so it is checked against the
+    # same output
+    def test_merlin_dragon_128_group_routers(self):
+        self.merlin_test_template("dragon_128_test", model_option="group_routers")
+
+    # The flow level model has no packet level reference output, so
+    # these only check that every NIC received all of its packets.  All
+    # of a flow network's components have to be in one process.
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Flow level model requires a single rank")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Flow level model requires a single thread")
+    def test_merlin_flow_dragon_72(self):
+        self.merlin_flow_test_template("flow_dragon_72_test", 72)
+
+    @unittest.skipIf(testing_check_get_num_ranks() > 1, "Flow level model requires a single rank")
+    @unittest.skipIf(testing_check_get_num_threads() > 1, "Flow level model requires a single thread")
+    def test_merlin_flow_fattree_64(self):
+        self.merlin_flow_test_template("flow_fattree_64_test", 64)
+
     def test_merlin_dragon_128_platform(self):
         self.merlin_test_template("dragon_128_platform_test", True)
 
@@ -83,6 +112,10 @@ class testcase_merlin_Component(SSTTestCase):
     def test_merlin_anytopo_cubical(self):
         self.merlin_test_template("anytopo_cubical_test")
 
+    @unittest.skipIf('networkx' not in sys.modules, "Anytopo tests require networkx")
+    def test_merlin_anytopo_cubical_rr_occ(self):
+        self.merlin_test_template("anytopo_cubical_test", model_option="merlin.xbar_arb_rr_occ")
+
     @unittest.skipIf('networkx' not in sys.modules, "Anytopo tests require networkx")
     def test_merlin_anytopo_slimfly(self):
         self.merlin_test_template("anytopo_slimfly_test")
@@ -106,7 +139,7 @@ class testcase_merlin_Component(SSTTestCase):
 
 #####
 
-    def merlin_test_template(self, testcase, cwd=False):
+    def merlin_test_template(self, testcase, cwd=False, model_option=None, ref_model_option=None):
         # Get the path to the test files
         test_path = self.get_testsuite_dir()
         outdir = self.get_test_output_run_dir()
@@ -114,17 +147,34 @@ class testcase_merlin_Component(SSTTestCase):
 
         # Set the various file paths
         testDataFileName="test_merlin_{0}".format(testcase)
+        runFileName = testDataFileName
+        otherargs = ""
+        if model_option is not None:
+            runFileName = "{0}_{1}".format(testDataFileName, model_option.split(".")[-1])
+            otherargs = '--model-options="{0}"'.format(model_option)
 
         sdlfile = "{0}/{1}.py".format(test_path, testcase)
         reffile = "{0}/refFiles/{1}.out".format(test_path, testDataFileName)
-        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
-        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
-        mpioutfiles = "{0}/{1}.testfile".format(outdir, testDataFileName)
+        outfile = "{0}/{1}.out".format(outdir, runFileName)
+        errfile = "{0}/{1}.err".format(outdir, runFileName)
+        mpioutfiles = "{0}/{1}.testfile".format(outdir, runFileName)
 
         if cwd:
-            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles, set_cwd=test_path)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles, set_cwd=test_path)
         else:
-            self.run_sst(sdlfile, outfile, errfile, mpi_out_files=mpioutfiles)
+            self.run_sst(sdlfile, outfile, errfile, other_args=otherargs, mpi_out_files=mpioutfiles)
+
+        # Compare against the output of another model option instead of the reference file
+        if ref_model_option is not None:
+            refRunFileName = "{0}_{1}".format(testDataFileName, ref_model_option.split(".")[-1])
+            reffile = "{0}/{1}.out".format(outdir, refRunFileName)
+            referrfile = "{0}/{1}.err".format(outdir, refRunFileName)
+            refmpioutfiles = "{0}/{1}.testfile".format(outdir, refRunFileName)
+            refargs = '--model-options="{0}"'.format(ref_model_option)
+            if cwd:
+                self.run_sst(sdlfile, reffile, referrfile, other_args=refargs, mpi_out_files=refmpioutfiles, set_cwd=test_path)
+            else:
+                self.run_sst(sdlfile, reffile, referrfile, other_args=refargs, mpi_out_files=refmpioutfiles)
 
         # NOTE: THE PASS / FAIL EVALUATIONS ARE PORTED FROM THE SQE BAMBOO
         #       BASED testSuite_XXX.sh THESE SHOULD BE RE-EVALUATED BY THE
@@ -140,3 +190,26 @@ class testcase_merlin_Component(SSTTestCase):
             diffdata = testing_get_diff_data(testcase)
             log_failure(diffdata)
         self.assertTrue(cmp_result, "Sorted Output file {0} does not match sorted Reference File {1}".format(outfile, reffile))
+
+    def merlin_flow_test_template(self, testcase, num_nics):
+        test_path = self.get_testsuite_dir()
+        outdir = self.get_test_output_run_dir()
+
+        testDataFileName="test_merlin_{0}".format(testcase)
+
+        sdlfile = "{0}/{1}.py".format(test_path, testcase)
+        outfile = "{0}/{1}.out".format(outdir, testDataFileName)
+        errfile = "{0}/{1}.err".format(outdir, testDataFileName)
+
+        self.run_sst(sdlfile, outfile, errfile)
+
+        if os_test_file(errfile, "-s"):
+            log_testing_note("merlin test {0} has a Non-Empty Error File {1}".format(testDataFileName, errfile))
+
+        with open(outfile, 'r') as f:
+            output = f.read()
+
+        self.assertIn("Simulation is complete", output, "Output file {0} does not show a completed simulation".format(outfile))
+        self.assertNotIn("didn't receive", output, "Output file {0} shows NICs that did not receive all init messages".format(outfile))
+        received = output.count("received all packets")
+        self.assertEqual(received, num_nics, "Only {0} of {1} NICs received all packets in {2}".format(received, num_nics, outfile))
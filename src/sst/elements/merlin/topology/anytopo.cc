@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <stdlib.h>
 #include <set>
+#include <map>
 #include <limits>
 #include "sst/core/rng/xorshift.h"
 #include "sst/core/output.h"
@@ -75,16 +76,33 @@ topo_any::topo_any(ComponentId_t cid, Params& params, int num_ports, int rtr_id,
     adaptive_threshold = params.find<double>("adaptive_threshold", 2.0);
 
     // Parse endpoint mappings first (needed to determine SharedArray size)
+    std::map<int, int> endpoint_to_port_map;
     params.find_map<int, int>("endpoint_to_port_map", endpoint_to_port_map);
     if (endpoint_to_port_map.empty()) {
         output.fatal(CALL_INFO, -1, "No endpoint-to-port mapping provided\n");
     }
 
+    std::map<int, int> port_to_endpoint_map;
     params.find_map<int, int>("port_to_endpoint_map", port_to_endpoint_map);
     if (port_to_endpoint_map.empty()) {
         output.fatal(CALL_INFO, -1, "No port-to-endpoint mapping provided\n");
     }
 
+    // Compile the mappings into arrays. The endpoints of a router normally
+    // have consecutive ids, so the endpoint array only covers the local id range.
+    local_EP_base = endpoint_to_port_map.begin()->first;
+    local_EP_ports.assign(endpoint_to_port_map.rbegin()->first - local_EP_base + 1, -1);
+    for (const auto& entry : endpoint_to_port_map) {
+        local_EP_ports[entry.first - local_EP_base] = entry.second;
+    }
+    port_to_endpoint.assign(num_ports, -1);
+    for (const auto& entry : port_to_endpoint_map) {
+        if (entry.first < 0 || entry.first >= num_ports) {
+            fatal(CALL_INFO, -1, "ERROR: port %d in port_to_endpoint_map is out of range\n", entry.first);
+        }
+        port_to_endpoint[entry.first] = entry.second;
+    }
+
     // Initialize SharedArrays with same names as SourceRoutingPlugin uses
     std::string basename = "SourceRoutingPlugin.";
 
@@ -112,6 +130,7 @@ void SST::Merlin::topo_any::Parse_routing_info(SST::Params &params)
     std::string connectivity_str = params.find<std::string>("connectivity", "");
     if (!connectivity_str.empty())
     {
+        std::map<int, std::set<int>> connectivity;
         auto entries = parse_param_entries(connectivity_str);
         for (const auto& tokens : entries) {
             if (tokens.size() >= 2) {
@@ -128,6 +147,14 @@ void SST::Merlin::topo_any::Parse_routing_info(SST::Params &params)
                 }
             }
         }
+
+        // Compile into the sorted neighbor arrays
+        neighbor_port_offsets.push_back(0);
+        for (const auto& entry : connectivity) {
+            neighbor_ids.push_back(entry.first);
+            neighbor_ports.insert(neighbor_ports.end(), entry.second.begin(), entry.second.end());
+            neighbor_port_offsets.push_back(neighbor_ports.size());
+        }
     }
     else
     {
@@ -141,6 +168,24 @@ void SST::Merlin::topo_any::Parse_routing_info(SST::Params &params)
     if (!routing_str.empty()) {
         output.verbose(CALL_INFO, 1, 0, "Loading routing entry from string parameter\n");
         routing_entries entries = SourceRoutingPlugin::parseRoutingEntryFromString(routing_str, num_routers, output);
+
+        // Record the first-hop port of every path for the UGAL algorithms
+        simple_offsets.assign(entries.size() + 1, 0);
+        for (size_t dest = 0; dest < entries.size(); ++dest) {
+            for (const auto& weighted_path : entries[dest]) {
+                const std::deque<int>& path = weighted_path.second;
+                auto nb = path.empty() ? neighbor_ids.end() :
+                    std::lower_bound(neighbor_ids.begin(), neighbor_ids.end(), path.front());
+                if (nb == neighbor_ids.end() || *nb != path.front()) {
+                    simple_first_port.push_back(-1);
+                } else {
+                    // Lowest numbered port to the first hop
+                    simple_first_port.push_back(neighbor_ports[neighbor_port_offsets[nb - neighbor_ids.begin()]]);
+                }
+            }
+            simple_offsets[dest + 1] = simple_first_port.size();
+        }
+
         simple_routing_table_shared.write(router_id, entries);
         simple_routing_table_shared.publish();
         output.verbose(CALL_INFO, 1, 0, "Loaded simple routing table entry with %zu destinations\n", entries.size());
@@ -165,22 +210,46 @@ void SST::Merlin::topo_any::Parse_routing_info(SST::Params &params)
         std::string routing_table_str = params.find<std::string>("routing_table", "");
         if (!routing_table_str.empty())
         {
+            std::map<int, std::vector<int>> routing_table;
             auto entries = parse_param_entries(routing_table_str);
             for (const auto& tokens : entries) {
                 if (tokens.size() >= 2) {
                     try {
                         int dest_router = std::stoi(tokens[0]);
+                        if (dest_router < 0 || dest_router >= num_routers) {
+                            output.output("WARNING: Routing table entry for out of range router %d ignored\n", dest_router);
+                            continue;
+                        }
                         std::vector<int> next_hops;
                         for (size_t i = 1; i < tokens.size(); ++i) {
                             next_hops.push_back(std::stoi(tokens[i]));
                         }
-                        Dest_Tag_Routing_Table[dest_router] = next_hops;
+                        routing_table[dest_router] = next_hops;
                     }
                     catch (const std::exception &e) {
                         output.output("WARNING: Failed to parse routing table entry: %s\n", tokens[0].c_str());
                     }
                 }
             }
+
+            // Compile into the per-destination arrays, with next hops
+            // translated to neighbor indices
+            dest_tag_offsets.assign(num_routers + 1, 0);
+            for (int dest = 0; dest < num_routers; ++dest) {
+                auto it = routing_table.find(dest);
+                if (it != routing_table.end()) {
+                    for (int next_hop : it->second) {
+                        auto nb = std::lower_bound(neighbor_ids.begin(), neighbor_ids.end(), next_hop);
+                        if (nb != neighbor_ids.end() && *nb == next_hop) {
+                            dest_tag_next_hops.push_back(nb - neighbor_ids.begin());
+                        } else {
+                            // Reported if a packet is ever routed this way
+                            dest_tag_next_hops.push_back(-1);
+                        }
+                    }
+                }
+                dest_tag_offsets[dest + 1] = dest_tag_next_hops.size();
+            }
         }
         else
         {
@@ -258,7 +327,10 @@ int topo_any::getEndpointID(int port_id) {
         }
         return -1;
     }else{
-        return port_to_endpoint_map.at(port_id);
+        if (port_id >= static_cast<int>(port_to_endpoint.size()) || port_to_endpoint[port_id] == -1) {
+            fatal(CALL_INFO, -1, "ERROR: Port %d is not mapped to an endpoint\n", port_id);
+        }
+        return port_to_endpoint[port_id];
         // return router_id * num_R2N_ports + (port_id - num_R2R_ports);
     }
 }
@@ -278,26 +350,42 @@ int topo_any::get_router_id(int EP_id) const
 
 int topo_any::get_dest_local_port(int dest_EP_id) const
 {
-    return endpoint_to_port_map.at(dest_EP_id);
+    int idx = dest_EP_id - local_EP_base;
+    if (idx < 0 || idx >= static_cast<int>(local_EP_ports.size()) || local_EP_ports[idx] == -1) {
+        fatal(CALL_INFO, -1, "ERROR: Endpoint %d is not attached to this router %d\n", dest_EP_id, router_id);
+    }
+    return local_EP_ports[idx];
 }
 
 //===============================================================
 
+int topo_any::getNeighborIndex(int target_router_id) const {
+    auto it = std::lower_bound(neighbor_ids.begin(), neighbor_ids.end(), target_router_id);
+    if (it == neighbor_ids.end() || *it != target_router_id) {
+        fatal(CALL_INFO, -1, "ERROR: Router %d is not directly connected to this router %d\n", target_router_id, this->router_id);
+    }
+    return it - neighbor_ids.begin();
+}
+
 int topo_any::getPortToRouter(int target_router_id) const {
-    // for now ports are randomly selected
-    std::set<int> ports = getPortsToRouter(target_router_id);
-    int idx = rng->generateNextInt32() % ports.size();
-    auto it = ports.begin();
-    std::advance(it, idx);
-    return *it;
+    return getPortToNeighbor(getNeighborIndex(target_router_id));
 }
 
-std::set<int>& topo_any::getPortsToRouter(int target_router_id) const {
-    auto it = connectivity.find(target_router_id);
-    if (it == connectivity.end()) {
-        fatal(CALL_INFO, -1, "ERROR: Router %d is not directly connected to this router %d\n", target_router_id, this->router_id);
+int topo_any::getFirstHopPort(int dest_router, size_t path_idx) const {
+    int port = simple_first_port[simple_offsets[dest_router] + path_idx];
+    if (port == -1) {
+        fatal(CALL_INFO, -1, "ERROR: First hop of path %zu to router %d is not directly connected to this router %d\n",
+              path_idx, dest_router, router_id);
     }
-    return const_cast<std::set<int>&>(it->second);
+    return port;
+}
+
+int topo_any::getPortToNeighbor(int neighbor_idx) const {
+    // for now ports are randomly selected
+    int start = neighbor_port_offsets[neighbor_idx];
+    int num_ports = neighbor_port_offsets[neighbor_idx + 1] - start;
+    int idx = rng->generateNextInt32() % num_ports;
+    return neighbor_ports[start + idx];
 }
 
 internal_router_event* topo_any::process_input(RtrEvent* ev) {
@@ -501,7 +589,7 @@ void topo_any::route_packet_SR_UGAL(int input_port, int vc, topo_any_event* ev)
             }
 
             size_t path_idx = rng->generateNextUInt32() % routing_table[intermediate_router].size();
-            std::deque<int> first_segment = routing_table[intermediate_router][path_idx].second;
+            const std::deque<int>& first_segment = routing_table[intermediate_router][path_idx].second;
 
             const routing_entries& intermediate_table = simple_routing_table_shared[intermediate_router];
             if(dest_router >= static_cast<int>(intermediate_table.size()) || intermediate_table[dest_router].empty()){
@@ -509,7 +597,7 @@ void topo_any::route_packet_SR_UGAL(int input_port, int vc, topo_any_event* ev)
             }
 
             size_t dest_path_idx = rng->generateNextUInt32() % intermediate_table[dest_router].size();
-            std::deque<int> second_segment = intermediate_table[dest_router][dest_path_idx].second;
+            const std::deque<int>& second_segment = intermediate_table[dest_router][dest_path_idx].second;
 
             // Compose complete valiant path
             std::vector<int> complete_path(first_segment.begin(), first_segment.end());
@@ -518,9 +606,7 @@ void topo_any::route_packet_SR_UGAL(int input_port, int vc, topo_any_event* ev)
             if (possible_paths.count(complete_path)) continue;
 
             // Calculate weight for first hop
-            int next_router = first_segment.front();
-            std::set<int>& ports = getPortsToRouter(next_router);
-            int next_port = *ports.begin();
+            int next_port = getFirstHopPort(intermediate_router, path_idx);
             int queue_length = output_queue_lengths[next_port * tot_num_vcs + vns[vn].start_vc];
 
             // Weight: path_length * queue_length (no bias - pure weight comparison)
@@ -531,15 +617,11 @@ void topo_any::route_packet_SR_UGAL(int input_port, int vc, topo_any_event* ev)
         if(dest_router >= static_cast<int>(routing_table.size()) || routing_table[dest_router].empty()){
             fatal(CALL_INFO, -1, "ERROR: No valid paths found from router %d to router %d\n", router_id, dest_router);
         }
-        for (const auto& weighted_path : routing_table[dest_router]) {
-            const std::deque<int>& path = weighted_path.second;
+        for (size_t p = 0; p < routing_table[dest_router].size(); ++p) {
+            const std::deque<int>& path = routing_table[dest_router][p].second;
             if (path.empty()) continue;
 
-            int next_router = path.front();
-            std::set<int>& ports = getPortsToRouter(next_router);
-            if (ports.empty()) continue;
-
-            int next_port = *ports.begin();
+            int next_port = getFirstHopPort(dest_router, p);
             int queue_length = output_queue_lengths[next_port * tot_num_vcs + vns[vn].start_vc];
 
             // Weight: path_length * queue_length
@@ -614,32 +696,30 @@ void topo_any::route_packet_SR_UGAL_THRESHOLD(int input_port, int vc, topo_any_e
         // Get routing table for this router
         const routing_entries& routing_table = simple_routing_table_shared[router_id];
 
-        // Find best minimal path (lowest queue length)
+        // Find best minimal path (lowest queue length).  Paths are only
+        // copied once the decision is made.
         int best_minimal_queue = std::numeric_limits<int>::max();
-        std::vector<int> best_minimal_path;
+        const std::deque<int>* best_minimal_path = nullptr;
 
         if (dest_router < static_cast<int>(routing_table.size()) && !routing_table[dest_router].empty()) {
-            for (const auto& weighted_path : routing_table[dest_router]) {
-                const std::deque<int>& path = weighted_path.second;
+            for (size_t p = 0; p < routing_table[dest_router].size(); ++p) {
+                const std::deque<int>& path = routing_table[dest_router][p].second;
                 if (path.empty()) continue;
 
-                int next_router = path.front();
-                std::set<int>& ports = getPortsToRouter(next_router);
-                if (ports.empty()) continue;
-
-                int next_port = *ports.begin();
+                int next_port = getFirstHopPort(dest_router, p);
                 int queue_length = output_queue_lengths[next_port * tot_num_vcs + vns[vn].start_vc];
 
                 if (queue_length < best_minimal_queue) {
                     best_minimal_queue = queue_length;
-                    best_minimal_path = std::vector<int>(path.begin(), path.end());
+                    best_minimal_path = &path;
                 }
             }
         }
 
         // Generate and evaluate valiant paths
         int best_valiant_queue = std::numeric_limits<int>::max();
-        std::vector<int> best_valiant_path;
+        const std::deque<int>* best_valiant_first = nullptr;
+        const std::deque<int>* best_valiant_second = nullptr;
 
         int num_valiant = vns[vn].ugal_num_valiant;
         int attempts = 0;
@@ -655,62 +735,56 @@ void topo_any::route_packet_SR_UGAL_THRESHOLD(int input_port, int vc, topo_any_e
                 routing_table[intermediate_router].empty()) continue;
 
             size_t path_idx = rng->generateNextUInt32() % routing_table[intermediate_router].size();
-            std::deque<int> first_segment = routing_table[intermediate_router][path_idx].second;
+            const std::deque<int>& first_segment = routing_table[intermediate_router][path_idx].second;
 
             const routing_entries& intermediate_table = simple_routing_table_shared[intermediate_router];
             if (dest_router >= static_cast<int>(intermediate_table.size()) ||
                 intermediate_table[dest_router].empty()) continue;
 
             size_t dest_path_idx = rng->generateNextUInt32() % intermediate_table[dest_router].size();
-            std::deque<int> second_segment = intermediate_table[dest_router][dest_path_idx].second;
-
-            // Compose complete valiant path
-            std::vector<int> complete_path(first_segment.begin(), first_segment.end());
-            complete_path.insert(complete_path.end(), second_segment.begin(), second_segment.end());
+            const std::deque<int>& second_segment = intermediate_table[dest_router][dest_path_idx].second;
 
             // Calculate queue length for first hop
             if (first_segment.empty()) continue;
-            int next_router = first_segment.front();
-            std::set<int>& ports = getPortsToRouter(next_router);
-            if (ports.empty()) continue;
-
-            int next_port = *ports.begin();
+            int next_port = getFirstHopPort(intermediate_router, path_idx);
             int queue_length = output_queue_lengths[next_port * tot_num_vcs + vns[vn].start_vc];
 
             valiant_paths_found++;
             if (queue_length < best_valiant_queue) {
                 best_valiant_queue = queue_length;
-                best_valiant_path = complete_path;
+                best_valiant_first = &first_segment;
+                best_valiant_second = &second_segment;
             }
         }
 
         // Make routing decision based on threshold comparison
         // In dragonfly: valiant_credits > direct_credits * threshold means use valiant
         // With queue lengths (inverse): direct_queue > valiant_queue * threshold means use valiant
-        std::vector<int> chosen_path;
+        bool use_valiant = false;
 
-        if (best_minimal_path.empty() && best_valiant_path.empty()) {
+        if (best_minimal_path == nullptr && best_valiant_first == nullptr) {
             fatal(CALL_INFO, -1, "ERROR: No valid paths found for UGAL_THRESHOLD routing from router %d to router %d\n",
                   router_id, dest_router);
-        } else if (best_minimal_path.empty()) {
+        } else if (best_minimal_path == nullptr) {
             // Only valiant path available
-            chosen_path = best_valiant_path;
-        } else if (best_valiant_path.empty()) {
+            use_valiant = true;
+        } else if (best_valiant_first == nullptr) {
             // Only minimal path available
-            chosen_path = best_minimal_path;
+            use_valiant = false;
         } else {
             // Both paths available - apply threshold comparison
             // Use valiant if minimal queue is significantly worse (more congested)
-            if (best_minimal_queue > (int)((double)best_valiant_queue * adaptive_threshold)) {
-                chosen_path = best_valiant_path;
-            } else {
-                chosen_path = best_minimal_path;
-            }
+            use_valiant = best_minimal_queue > (int)((double)best_valiant_queue * adaptive_threshold);
         }
 
         // Store the chosen path in SourceRoutingMetadata
         SourceRoutingMetadata sr_meta;
-        sr_meta.path = std::deque<int>(chosen_path.begin(), chosen_path.end());
+        if (use_valiant) {
+            sr_meta.path = *best_valiant_first;
+            sr_meta.path.insert(sr_meta.path.end(), best_valiant_second->begin(), best_valiant_second->end());
+        } else {
+            sr_meta.path = *best_minimal_path;
+        }
         ext_req->setMetadata("SourceRouting", sr_meta);
 
         // Now route using the standard source routing logic
@@ -731,12 +805,17 @@ void topo_any::route_packet_dest_tag(int input_port, int vc, topo_any_event* ev)
         ev->setNextPort(get_dest_local_port(dest_EP_id));
     }else{
         // Route to next hop based on routing table
-        auto it = Dest_Tag_Routing_Table.find(dest_router);
-        if (it != Dest_Tag_Routing_Table.end() && !it->second.empty()) {
+        if (dest_router < static_cast<int>(dest_tag_offsets.size()) - 1 &&
+            dest_tag_offsets[dest_router] != dest_tag_offsets[dest_router + 1]) {
             //TODO: call different routing algorithms, set ev->next_router_id
-            ev->next_router_id = it->second[0]; // Simple selection for temporary testing
+            int neighbor_idx = dest_tag_next_hops[dest_tag_offsets[dest_router]]; // Simple selection for temporary testing
+            if (neighbor_idx == -1) {
+                fatal(CALL_INFO, -1, "ERROR: Next hop for destination router %d is not directly connected to this router %d\n",
+                      dest_router, router_id);
+            }
+            ev->next_router_id = neighbor_ids[neighbor_idx];
 
-            int fwd_port = getPortToRouter(ev->next_router_id);
+            int fwd_port = getPortToNeighbor(neighbor_idx);
             ev->setNextPort(fwd_port);
             ev->num_hops++;
             if (ev->num_hops > tot_num_vcs) {
@@ -25,9 +25,6 @@
 #include <sst/core/rng/rng.h>
 #include <sst/core/output.h>
 #include <sst/core/shared/sharedArray.h>
-#include <unordered_map>
-#include <set>
-#include <map>
 #include <vector>
 
 #include "sst/elements/merlin/router.h"
@@ -141,11 +138,15 @@ public:
     ~topo_any();
 
     // This data structure stores which router is connected by which ports.
-    // The key is destination router id, value is a set of port ids.
-    // The set is for supporting multiple ports connecting to the same destination router.
+    // neighbor_ids holds the ids of the directly connected routers in ascending order,
+    // the ports to neighbor_ids[i] are neighbor_ports[neighbor_port_offsets[i] .. neighbor_port_offsets[i+1]-1],
+    // also in ascending order.
+    // The list is for supporting multiple ports connecting to the same destination router.
     // If multiple ports are connected to another router, the current implementation randomly choose one port.
     // However, in common cases, there is only one port for a destination router (no parallel links between routers)
-    std::unordered_map<int, std::set<int>> connectivity;
+    std::vector<int> neighbor_ids;
+    std::vector<int> neighbor_port_offsets;
+    std::vector<int> neighbor_ports;
 
     enum Routing_mode{
         // Note that this need to be specified for every vn
@@ -158,9 +159,19 @@ public:
         dest_tag_routing
     };
 
-    // This data structure contains the necessary routing information for THIS router
-    // key is destination router id, value is a list of next-hop router ids.
-    std::map<int, std::vector<int>> Dest_Tag_Routing_Table;
+    // This data structure contains the necessary routing information for THIS router.
+    // It is indexed by destination router id: the next hops to router d are
+    // dest_tag_next_hops[dest_tag_offsets[d] .. dest_tag_offsets[d+1]-1].
+    // Next hops are stored as indices into neighbor_ids (-1 if the next hop is not a neighbor).
+    std::vector<int> dest_tag_offsets;
+    std::vector<int> dest_tag_next_hops;
+
+    // First-hop port of every path in the simple routing table of THIS router,
+    // in the same layout as the table: path p to router d has its first-hop port at
+    // simple_first_port[simple_offsets[d] + p] (-1 for an empty path).
+    // Used by the UGAL algorithms to look up the queue lengths of the candidates.
+    std::vector<int> simple_offsets;
+    std::vector<int> simple_first_port;
 
     // Source routing algorithms (for source_routing mode)
     // The path is pre-computed and stored in packet metadata
@@ -269,12 +280,20 @@ private:
     // calculate the local port id (R2N port) based on the destination endpoint id
     int get_dest_local_port(int dest_EP_id) const;
 
+    // index of the target router in neighbor_ids
+    int getNeighborIndex(int target_router_id) const;
     // for now ports are randomly selected
     int getPortToRouter(int target_router_id) const;
-    std::set<int>& getPortsToRouter(int target_router_id) const;
-
-    std::map<int, int> endpoint_to_port_map; // maps from the endpoint ID to the port ID.
-    std::map<int, int> port_to_endpoint_map; // maps from the port ID to the endpoint ID.
+    int getPortToNeighbor(int neighbor_idx) const;
+    // first-hop port of a path in the simple routing table of this router
+    int getFirstHopPort(int dest_router, size_t path_idx) const;
+
+    // Endpoints attached to this router.
+    // local_EP_ports[id - local_EP_base] is the port of endpoint id (-1 if it is not attached to this router)
+    int local_EP_base;
+    std::vector<int> local_EP_ports;
+    // port_to_endpoint[port] is the endpoint on the port (-1 for R2R ports)
+    std::vector<int> port_to_endpoint;
 
     // void route_nonadaptive(int port, int vc, internal_router_event* ev, int dest_router);
     // void route_nonadaptive_weighted(int port, int vc, internal_router_event* ev, int dest_router);
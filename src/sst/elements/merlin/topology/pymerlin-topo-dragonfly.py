@@ -23,13 +23,16 @@ class topoDragonFly(Topology):
 
     def __init__(self):
         Topology.__init__(self)
-        self._declareClassVariables(["link_latency","host_link_latency","global_link_map"])
+        self._declareClassVariables(["link_latency","host_link_latency","global_link_map","group_routers"])
         self._declareParams("main",["hosts_per_router","routers_per_group","intergroup_links","intragroup_links",
                                     "num_groups","algorithm","adaptive_threshold","global_routes",
                                     "config_failed_links","failed_links"])
         self.global_routes = "absolute"
         self._subscribeToPlatformParamSet("topology")
         self.intragroup_links = 1
+        # If True, each group is built as one merlin.router_group
+        # component and the intragroup links are handled inside it
+        self.group_routers = False
 
     def getName(self):
         return "Dragonfly"
@@ -154,16 +157,40 @@ class topoDragonFly(Topology):
         #########################
 
 
+        # Port on router r used for intragroup link s to router p
+        def getIntragroupPort(r, p, s):
+            if p > r:
+                p = p - 1
+            return self.hosts_per_router + p * self.intragroup_links + s
+
         router_num = 0
         nic_num = 0
         # GROUPS
         for g in range(self.num_groups):
+            if self.group_routers:
+                ids = [router_num + r for r in range(self.routers_per_group)]
+                grp = self.router.instanceRouterGroup("rtr_G%d"%g, num_ports, ids)
+                local_links = []
+                for r in range(self.routers_per_group):
+                    for p in range(r + 1, self.routers_per_group):
+                        for s in range(self.intragroup_links):
+                            local_links.extend([r, getIntragroupPort(r,p,s), p, getIntragroupPort(p,r,s)])
+                grp.addParam("local_links",local_links)
+                grp.addParam("local_link_latency",self.link_latency)
+
             # GROUP ROUTERS
             for r in range(self.routers_per_group):
-                rtr = self._instanceRouter(num_ports,router_num)
+                if self.group_routers:
+                    rtr = grp
+                    slot_num = r
+                    port_base = r * num_ports
+                else:
+                    rtr = self._instanceRouter(num_ports,router_num)
+                    slot_num = 0
+                    port_base = 0
 
                 # Insert the topology object
-                sub = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.dragonfly",0)
+                sub = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.dragonfly",slot_num)
                 self._applyStatisticsSettings(sub)
                 sub.addGlobalParamSet("params_%s"%self._instance_name)
                 sub.addParam("intergroup_per_router",intergroup_per_router)
@@ -177,7 +204,7 @@ class topoDragonFly(Topology):
                 for p in range(self.hosts_per_router):
                     link = sst.Link("link_g%dr%dh%d"%(g, r, p), self.host_link_latency)
 
-                    Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%port, nic_num, {}, link)
+                    Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%(port_base + port), nic_num, {}, link)
                     #link.setNoCut()
                     #rtr.addLink(link,"port%d"%port,self.host_link_latency)
                     nic_num = nic_num + 1
@@ -188,13 +215,14 @@ class topoDragonFly(Topology):
                         src = min(p,r)
                         dst = max(p,r)
                         for s in range(self.intragroup_links):
-                            rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
+                            if not self.group_routers:
+                                rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
                             port = port + 1
 
                 for p in range(igpr):
                     link = getGlobalLink(g,r,p)
                     if link is not None:
-                        rtr.addLink(link,"port%d"%port, self.link_latency)
+                        rtr.addLink(link,"port%d"%(port_base + port), self.link_latency)
                     port = port +1
 
                 router_num = router_num + 1
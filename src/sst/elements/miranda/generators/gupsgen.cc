@@ -18,6 +18,9 @@
 #include <sst/core/params.h>
 #include <sst/core/rng/marsaglia.h>
 #include <sst/elements/miranda/generators/gupsgen.h>
+#include <sst/elements/miranda/mirandaPattern.h>
+
+#include <algorithm>
 
 using namespace SST::Miranda;
 
@@ -54,25 +57,41 @@ GUPSGenerator::~GUPSGenerator() {
 }
 
 void GUPSGenerator::generate(MirandaRequestQueue<GeneratorRequest*>* q) {
+    generateBatch(q, 1);
+}
+
+void GUPSGenerator::generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) {
+    uint64_t rand_addrs[MIRANDA_PATTERN_BLOCK];
+    uint64_t addrs[MIRANDA_PATTERN_BLOCK];
+
+    uint64_t remaining = std::min((uint64_t) count, issueCount);
+
+    while(remaining > 0) {
+        const uint32_t block = std::min(remaining, (uint64_t) MIRANDA_PATTERN_BLOCK);
+
+        for(uint32_t j = 0; j < block; ++j) {
+            rand_addrs[j] = rng->generateNextUInt64();
+        }
 
-    const uint64_t rand_addr = rng->generateNextUInt64();
-    // Ensure we have a reqLength aligned request
+        // Ensure we have a reqLength aligned request
+        patternRandom(addrs, rand_addrs, block, memStart, memLength, reqLength);
 
-    uint64_t addr = (rand_addr % ( memLength / reqLength ) );
-    addr *= reqLength;
-    addr += memStart;
+        for(uint32_t j = 0; j < block; ++j) {
+            out->verbose(CALL_INFO, 4, 0, "Generating next request number: %" PRIu64 " at address %" PRIu64 "\n", issueCount, addrs[j]);
 
-    out->verbose(CALL_INFO, 4, 0, "Generating next request number: %" PRIu64 " at address %" PRIu64 "\n", issueCount, addr);
+            MemoryOpRequest* readAddr = new MemoryOpRequest(addrs[j], reqLength, READ);
+            MemoryOpRequest* writeAddr = new MemoryOpRequest(addrs[j], reqLength, WRITE);
 
-    MemoryOpRequest* readAddr = new MemoryOpRequest(addr, reqLength, READ);
-    MemoryOpRequest* writeAddr = new MemoryOpRequest(addr, reqLength, WRITE);
+            writeAddr->addDependency(readAddr->getRequestID());
 
-    writeAddr->addDependency(readAddr->getRequestID());
+            q->push_back(readAddr);
+            q->push_back(writeAddr);
 
-    q->push_back(readAddr);
-    q->push_back(writeAddr);
+            issueCount--;
+        }
 
-    issueCount--;
+        remaining -= block;
+    }
 }
 
 bool GUPSGenerator::isFinished() {
@@ -56,6 +56,7 @@ public:
     ~GUPSGenerator();
     void build(Params &params);
     void generate(MirandaRequestQueue<GeneratorRequest*>* q) override;
+    void generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) override;
     bool isFinished() override;
     void completed() override;
 
@@ -18,6 +18,9 @@
 #include <sst/core/params.h>
 #include <sst/core/rng/marsaglia.h>
 #include <sst/elements/miranda/generators/randomgen.h>
+#include <sst/elements/miranda/mirandaPattern.h>
+
+#include <algorithm>
 
 using namespace SST::Miranda;
 
@@ -52,24 +55,47 @@ RandomGenerator::~RandomGenerator() {
 }
 
 void RandomGenerator::generate(MirandaRequestQueue<GeneratorRequest*>* q) {
-	out->verbose(CALL_INFO, 4, 0, "Generating next request number: %" PRIu64 "\n", issueCount);
+	generateBatch(q, 1);
+}
 
-	const uint64_t rand_addr = rng->generateNextUInt64();
-	// Ensure we have a reqLength aligned request
-	const uint64_t addr_under_limit = (rand_addr % maxAddr);
-	const uint64_t addr = (addr_under_limit < reqLength) ? addr_under_limit :
-		(rand_addr % maxAddr) - (rand_addr % reqLength);
+void RandomGenerator::generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) {
+	uint64_t rand_addrs[MIRANDA_PATTERN_BLOCK];
+	double op_decide[MIRANDA_PATTERN_BLOCK];
+	uint64_t addrs[MIRANDA_PATTERN_BLOCK];
 
-	const double op_decide = rng->nextUniform();
+	uint64_t remaining = std::min((uint64_t) count, issueCount);
 
-	// Populate request
-	q->push_back(new MemoryOpRequest(addr, reqLength, (op_decide < 0.5) ? READ : WRITE));
+	while(remaining > 0) {
+		const uint32_t block = std::min(remaining, (uint64_t) MIRANDA_PATTERN_BLOCK);
 
-	if (issueOpFences) {
-	    q->push_back(new FenceOpRequest());
-	}
+		// Draw in the same order as one request at a time
+		for(uint32_t j = 0; j < block; ++j) {
+			rand_addrs[j] = rng->generateNextUInt64();
+			op_decide[j] = rng->nextUniform();
+		}
+
+		// Ensure we have a reqLength aligned request
+		for(uint32_t j = 0; j < block; ++j) {
+			const uint64_t addr_under_limit = (rand_addrs[j] % maxAddr);
+			addrs[j] = (addr_under_limit < reqLength) ? addr_under_limit :
+				addr_under_limit - (rand_addrs[j] % reqLength);
+		}
+
+		for(uint32_t j = 0; j < block; ++j) {
+			out->verbose(CALL_INFO, 4, 0, "Generating next request number: %" PRIu64 "\n", issueCount);
 
-	issueCount--;
+			// Populate request
+			q->push_back(new MemoryOpRequest(addrs[j], reqLength, (op_decide[j] < 0.5) ? READ : WRITE));
+
+			if (issueOpFences) {
+			    q->push_back(new FenceOpRequest());
+			}
+
+			issueCount--;
+		}
+
+		remaining -= block;
+	}
 }
 
 bool RandomGenerator::isFinished() {
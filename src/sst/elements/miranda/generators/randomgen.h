@@ -53,6 +53,7 @@ public:
 	~RandomGenerator();
 	void build(Params& params);
 	void generate(MirandaRequestQueue<GeneratorRequest*>* q) override;
+	void generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) override;
 	bool isFinished() override;
 	void completed() override;
 
@@ -18,8 +18,10 @@
 #define _H_SST_MIRANDA_SPMV_BENCH_GEN
 
 #include <sst/elements/miranda/mirandaGenerator.h>
+#include <sst/elements/miranda/mirandaPattern.h>
 #include <sst/core/output.h>
 
+#include <algorithm>
 #include <queue>
 
 using namespace SST::RNG;
@@ -102,6 +104,11 @@ public:
 	}
 
 	void generate(MirandaRequestQueue<GeneratorRequest*>* q) override {
+		uint64_t cols[MIRANDA_PATTERN_BLOCK];
+		uint64_t matElementAddrs[MIRANDA_PATTERN_BLOCK];
+		uint64_t colAddrs[MIRANDA_PATTERN_BLOCK];
+		uint64_t lhsElemAddrs[MIRANDA_PATTERN_BLOCK];
+
 		for(uint64_t row = localRowStart; row < localRowEnd; row++) {
 			out->verbose(CALL_INFO, 2, 0, "Generating access for row %" PRIu64 "\n", row);
 
@@ -121,34 +128,40 @@ public:
 			q->push_back(readResultCurrentValue);
 
 			// Putting non-zeros on the diagonal
-			for(uint64_t j = 0; j < matrixNNZPerRow; j++) {
-				uint64_t col = j + row;
-				if (col >= matrixNx) {
-					break;
+			const uint64_t rowNNZ = (row >= matrixNx) ? 0 : std::min(matrixNNZPerRow, matrixNx - row);
+
+			for(uint64_t blockStart = 0; blockStart < rowNNZ; blockStart += MIRANDA_PATTERN_BLOCK) {
+				const uint32_t block = std::min(rowNNZ - blockStart, (uint64_t) MIRANDA_PATTERN_BLOCK);
+
+				for(uint32_t k = 0; k < block; k++) {
+					cols[k] = blockStart + k + row;
 				}
 
-				out->verbose(CALL_INFO, 4, 0, "Generating access for row %" PRIu64 ", column: %" PRIu64 "\n",
-						row, col);
+				patternStrided(matElementAddrs, block, matrixElementsStartAddr, row * matrixNNZPerRow + blockStart, elementWidth);
+				patternStrided(colAddrs, block, matrixColumnIndicesStartAddr, row * matrixNNZPerRow + blockStart, ordinalWidth);
+				patternGather(lhsElemAddrs, cols, block, lhsVecStartAddr, elementWidth);
 
-				MemoryOpRequest* readMatElement = new MemoryOpRequest(matrixElementsStartAddr +
-						(row * matrixNNZPerRow + j) * elementWidth, elementWidth, READ);
-				MemoryOpRequest* readCol = new MemoryOpRequest(matrixColumnIndicesStartAddr +
-						(row * matrixNNZPerRow + j) * ordinalWidth, ordinalWidth, READ);
-				MemoryOpRequest* readLHSElem = new MemoryOpRequest(lhsVecStartAddr +
-						col * elementWidth, elementWidth, READ);
+				for(uint32_t k = 0; k < block; k++) {
+					out->verbose(CALL_INFO, 4, 0, "Generating access for row %" PRIu64 ", column: %" PRIu64 "\n",
+							row, cols[k]);
 
-				readCol->addDependency(readStart->getRequestID());
-				readCol->addDependency(readEnd->getRequestID());
-				readMatElement->addDependency(readStart->getRequestID());
-				readMatElement->addDependency(readEnd->getRequestID());
-				readLHSElem->addDependency(readCol->getRequestID());
+					MemoryOpRequest* readMatElement = new MemoryOpRequest(matElementAddrs[k], elementWidth, READ);
+					MemoryOpRequest* readCol = new MemoryOpRequest(colAddrs[k], ordinalWidth, READ);
+					MemoryOpRequest* readLHSElem = new MemoryOpRequest(lhsElemAddrs[k], elementWidth, READ);
 
-				writeResult->addDependency(readLHSElem->getRequestID());
-				writeResult->addDependency(readMatElement->getRequestID());
+					readCol->addDependency(readStart->getRequestID());
+					readCol->addDependency(readEnd->getRequestID());
+					readMatElement->addDependency(readStart->getRequestID());
+					readMatElement->addDependency(readEnd->getRequestID());
+					readLHSElem->addDependency(readCol->getRequestID());
 
-				q->push_back(readCol);
-				q->push_back(readMatElement);
-				q->push_back(readLHSElem);
+					writeResult->addDependency(readLHSElem->getRequestID());
+					writeResult->addDependency(readMatElement->getRequestID());
+
+					q->push_back(readCol);
+					q->push_back(readMatElement);
+					q->push_back(readLHSElem);
+				}
 			}
 
 			q->push_back(writeResult);
@@ -17,6 +17,9 @@
 #include <sst_config.h>
 #include <sst/core/params.h>
 #include <sst/elements/miranda/generators/streambench.h>
+#include <sst/elements/miranda/mirandaPattern.h>
+
+#include <algorithm>
 
 using namespace SST::Miranda;
 
@@ -61,31 +64,47 @@ STREAMBenchGenerator::~STREAMBenchGenerator() {
 }
 
 void STREAMBenchGenerator::generate(MirandaRequestQueue<GeneratorRequest*>* q) {
-	for(uint64_t j = 0; j < n_per_call; ++j) {
-		out->verbose(CALL_INFO, 4, 0, "Array index: %" PRIu64 "\n", i);
+	generateBatch(q, 1);
+}
 
-		// If we reached our limit then step out of the generation
-		if(i == n) {
-			break;
-		}
+void STREAMBenchGenerator::generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) {
+	uint64_t addrs_a[MIRANDA_PATTERN_BLOCK];
+	uint64_t addrs_b[MIRANDA_PATTERN_BLOCK];
+	uint64_t addrs_c[MIRANDA_PATTERN_BLOCK];
+
+	// Each call to generate covers n_per_call array indices, stop when we reach our limit
+	uint64_t remaining = std::min(count * n_per_call, n - i);
+
+	while(remaining > 0) {
+		const uint32_t block = std::min(remaining, (uint64_t) MIRANDA_PATTERN_BLOCK);
 
-                MemoryOpRequest* read_b  = new MemoryOpRequest(start_b + (i * reqLength), reqLength, READ);
-                MemoryOpRequest* read_c  = new MemoryOpRequest(start_c + (i * reqLength), reqLength, READ);
-                MemoryOpRequest* write_a = new MemoryOpRequest(start_a + (i * reqLength), reqLength, WRITE);
+		patternStrided(addrs_a, block, start_a, i, reqLength);
+		patternStrided(addrs_b, block, start_b, i, reqLength);
+		patternStrided(addrs_c, block, start_c, i, reqLength);
 
-		write_a->addDependency(read_b->getRequestID());
-		write_a->addDependency(read_c->getRequestID());
+		for(uint32_t j = 0; j < block; ++j) {
+			out->verbose(CALL_INFO, 4, 0, "Array index: %" PRIu64 "\n", i);
 
-		out->verbose(CALL_INFO, 8, 0, "Issuing READ request for address %" PRIu64 "\n", (start_b + (i * reqLength)));
-		q->push_back(read_b);
+			MemoryOpRequest* read_b  = new MemoryOpRequest(addrs_b[j], reqLength, READ);
+			MemoryOpRequest* read_c  = new MemoryOpRequest(addrs_c[j], reqLength, READ);
+			MemoryOpRequest* write_a = new MemoryOpRequest(addrs_a[j], reqLength, WRITE);
 
-		out->verbose(CALL_INFO, 8, 0, "Issuing READ request for address %" PRIu64 "\n", (start_c + (i * reqLength)));
-		q->push_back(read_c);
+			write_a->addDependency(read_b->getRequestID());
+			write_a->addDependency(read_c->getRequestID());
 
-		out->verbose(CALL_INFO, 8, 0, "Issuing WRITE request for address %" PRIu64 "\n", (start_a + (i * reqLength)));
-		q->push_back(write_a);
+			out->verbose(CALL_INFO, 8, 0, "Issuing READ request for address %" PRIu64 "\n", addrs_b[j]);
+			q->push_back(read_b);
+
+			out->verbose(CALL_INFO, 8, 0, "Issuing READ request for address %" PRIu64 "\n", addrs_c[j]);
+			q->push_back(read_c);
+
+			out->verbose(CALL_INFO, 8, 0, "Issuing WRITE request for address %" PRIu64 "\n", addrs_a[j]);
+			q->push_back(write_a);
+
+			i++;
+		}
 
-		i++;
+		remaining -= block;
 	}
 }
 
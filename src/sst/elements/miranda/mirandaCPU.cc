@@ -223,7 +223,7 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 	out->verbose(CALL_INFO, 2, 0, "Recv event for processing from interface\n");
 
 	Interfaces::StandardMem::Request::id_t reqID = ev->getID();
-	std::map<Interfaces::StandardMem::Request::id_t, CPURequest*>::iterator reqFind = requestsInFlight.find(reqID);
+	auto reqFind = requestsInFlight.find(reqID);
 
 	if(reqFind == requestsInFlight.end()) {
 		out->fatal(CALL_INFO, -1, "Unable to find request %" PRIu64 " in request map.\n", reqID);
@@ -248,9 +248,18 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 			out->verbose(CALL_INFO, 4, 0, "-> Entry has all parts satisfied, removing ID=%" PRIu64 ", total processing time: %" PRIu64 "ns\n",
 					cpuReq->getOriginalReqID(), (getCurrentSimTimeNano() - cpuReq->getIssueTime()));
 
-			// Notify every pending request that there may be a satisfied dependency
-			for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-				pendingRequests.at(i)->satisfyDependency(cpuReq->getOriginalReqID());
+			// Notify the pending requests which depend on us that their dependency is satisfied
+			auto dependents = dependentRequests.find(cpuReq->getOriginalReqID());
+			if(dependents != dependentRequests.end()) {
+				for(auto dependent : dependents->second) {
+					dependent->satisfyDependency(cpuReq->getOriginalReqID());
+
+					const ReqOperation op = dependent->getOperation();
+					if(dependent->canIssue() && op != REQ_FENCE) {
+						readyRequests[op][dependent->getQueueSeq()] = dependent;
+					}
+				}
+				dependentRequests.erase(dependents);
 			}
 
 			delete cpuReq;
@@ -260,6 +269,81 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 	}
 }
 
+void RequestGenCPU::addDependents(const uint32_t firstNew) {
+	for(uint32_t i = firstNew; i < pendingRequests.size(); ++i) {
+		GeneratorRequest* req = pendingRequests.at(i);
+		const std::vector<uint64_t>& deps = req->getDependencies();
+		const ReqOperation op = req->getOperation();
+
+		req->setQueueSeq(nextQueueSeq++);
+		queuedRequests[op][req->getQueueSeq()] = req;
+		if(req->canIssue() && op != REQ_FENCE) {
+			readyRequests[op][req->getQueueSeq()] = req;
+		}
+
+		for(auto dep = deps.begin(); dep != deps.end(); dep++) {
+			// A completion satisfies one dependency of each pending request, so list each request once
+			if(std::find(deps.begin(), dep, *dep) == dep) {
+				dependentRequests[*dep].push_back(req);
+			}
+		}
+	}
+}
+
+void RequestGenCPU::removeDependent(GeneratorRequest* req) {
+	for(auto dep : req->getDependencies()) {
+		auto dependents = dependentRequests.find(dep);
+		if(dependents != dependentRequests.end()) {
+			auto& reqs = dependents->second;
+			reqs.erase(std::remove(reqs.begin(), reqs.end(), req), reqs.end());
+			if(reqs.empty()) {
+				dependentRequests.erase(dependents);
+			}
+		}
+	}
+}
+
+/*
+ * First request from queue sequence number from on that the issue loop has to
+ * act on: a fence, a ready request of an operation with free slots or the first
+ * load or store, ready or not, once its operation has no free slots. Anything
+ * in between would be passed over by a walk of the queue.
+ */
+GeneratorRequest* RequestGenCPU::nextIssueCandidate(const uint64_t from) {
+	GeneratorRequest* next = nullptr;
+	auto firstFrom = [&](std::map<uint64_t, GeneratorRequest*>& reqs) {
+		auto first = reqs.lower_bound(from);
+		if(first != reqs.end() && (nullptr == next || first->first < next->getQueueSeq())) {
+			next = first->second;
+		}
+	};
+
+	firstFrom(queuedRequests[REQ_FENCE]);
+	for(const ReqOperation op : {READ, WRITE}) {
+		firstFrom(requestsPending[op] < maxRequestsPending[op] ? readyRequests[op] : queuedRequests[op]);
+	}
+	if(requestsPending[CUSTOM] < maxRequestsPending[CUSTOM]) {
+		firstFrom(readyRequests[CUSTOM]);
+	}
+
+	return next;
+}
+
+// Index in pendingRequests of the request with queue sequence number seq
+uint32_t RequestGenCPU::queueIndexOf(const uint64_t seq) {
+	uint32_t lo = 0;
+	uint32_t hi = pendingRequests.size();
+	while(lo < hi) {
+		const uint32_t mid = lo + (hi - lo) / 2;
+		if(pendingRequests.at(mid)->getQueueSeq() < seq) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
 void RequestGenCPU::StdMemHandler::handle(Interfaces::StandardMem::ReadResp* rsp) {
     cpu->requestsPending[READ]--;
 }
@@ -452,44 +536,53 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 
     bool issued = false;
     uint32_t reqsIssuedThisCycle = 0;
-    std::vector<uint32_t> delReqs;
+    std::vector<GeneratorRequest*> delReqs;
 
     // We need to generate at least as many requests as can be looked up in the OoO window
     // otherwise the issue will have starvation.
-    for(int i = pendingRequests.size(); i < maxOpLookup; ++i) {
-        if( reqGen->isFinished()) {
-            break;
-    	} else {
-            reqGen->generate(&pendingRequests);
-    	}
+    const uint32_t firstNew = pendingRequests.size();
+    if(firstNew < maxOpLookup) {
+        reqGen->generateBatch(&pendingRequests, maxOpLookup - firstNew);
     }
+    addDependents(firstNew);
 
-    for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
+    // Only a certain number of lookups are allowed, the window ends maxOpLookup
+    // requests behind the head of the queue. Requests are taken from the ready
+    // lists in queue order and the walk stops where a walk of the queue would.
+    const uint32_t numPending = pendingRequests.size();
+    const bool windowLimited = numPending > maxOpLookup;
+    const uint64_t windowEnd = windowLimited ? pendingRequests.at(maxOpLookup)->getQueueSeq() : nextQueueSeq;
+    uint64_t from = 0;
+
+    while(from < nextQueueSeq && numPending > 0) {
         if(reqsIssuedThisCycle == reqMaxPerCycle) {
             statMaxIssuePerCycle->addData(1);
             break;
     	}
 
-		// Only a certain number of lookups are allowed, if we exceed this then we
-        // must exit the issue loop
-    	if(i == maxOpLookup) {
-            out->verbose(CALL_INFO, 2, 0, "Hit maximum reorder limit this cycle, no further operations will issue.\n");
-            statCyclesHitReorderLimit->addData(1);
+		GeneratorRequest* nxtRq = nextIssueCandidate(from);
+
+    	if(nullptr == nxtRq || nxtRq->getQueueSeq() >= windowEnd) {
+            if(windowLimited) {
+                out->verbose(CALL_INFO, 2, 0, "Hit maximum reorder limit this cycle, no further operations will issue.\n");
+                statCyclesHitReorderLimit->addData(1);
+            }
             break;
     	}
 
-		GeneratorRequest* nxtRq = pendingRequests.at(i);
+		const uint64_t seq = nxtRq->getQueueSeq();
 		ReqOperation op = nxtRq->getOperation();
 
 		if(op == REQ_FENCE) {
 			if(0 == requestsInFlight.size()) {
 				out->verbose(CALL_INFO, 4, 0, "Fence operation completed, no pending requests, will be retired.\n");
 
-				// Keep record we will delete fence at i
-				delReqs.push_back(i);
+				// Keep record we will delete the fence
+				delReqs.push_back(nxtRq);
+				queuedRequests[op].erase(seq);
 
 				// Delete the fence
-				delete nxtRq;
+				removeDependent(nxtRq);
 			} else {
 				out->verbose(CALL_INFO, 4, 0, "Fence operation in flight (>0 pending requests), stall.\n");
 			}
@@ -499,46 +592,31 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 			// Fence operations do now allow anything else to complete in this cycle
 			break;
 		} else if (op == CUSTOM) {
-			if (requestsPending[CUSTOM] < maxRequestsPending[CUSTOM]) {
-				out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
-
-				if(nxtRq->canIssue()) {
-					issued = true;
-					reqsIssuedThisCycle++;
-					out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
-					nxtRq->getRequestID(), reqsIssuedThisCycle);
-
-					// Keep record we will delete at index i
-					delReqs.push_back(i);
+			issued = true;
+			reqsIssuedThisCycle++;
+			out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
+			nxtRq->getRequestID(), reqsIssuedThisCycle);
 
-					issueCustomRequest(static_cast<CustomOpRequest*>(nxtRq));
+			// Keep record we will delete the request
+			delReqs.push_back(nxtRq);
+			queuedRequests[op].erase(seq);
+			readyRequests[op].erase(seq);
 
-					delete nxtRq;
-				}
-			}
+			issueCustomRequest(static_cast<CustomOpRequest*>(nxtRq));
 		} else if (op == READ || op == WRITE) {
 			if( requestsPending[op] < maxRequestsPending[op] ) {
-				auto memOpReq = static_cast<MemoryOpRequest*>(nxtRq);
-				out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
-
+				issued = true;
+				reqsIssuedThisCycle++;
 
-				if(nxtRq->canIssue()) {
-					issued = true;
-					reqsIssuedThisCycle++;
+				out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
+				nxtRq->getRequestID(), reqsIssuedThisCycle);
 
-					out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " encountered, cleared to be issued, %" PRIu32 " issued this cycle.\n",
-					nxtRq->getRequestID(), reqsIssuedThisCycle);
+				// Keep record we will delete the request
+				delReqs.push_back(nxtRq);
+				queuedRequests[op].erase(seq);
+				readyRequests[op].erase(seq);
 
-					// Keep record we will delete at index i
-					delReqs.push_back(i);
-
-					issueRequest(memOpReq);
-
-					delete nxtRq;
-				} else {
-					out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " in queue, has dependencies which are not satisfied, wait.\n",
-					nxtRq->getRequestID());
-				}
+				issueRequest(static_cast<MemoryOpRequest*>(nxtRq));
 			} else {
 				out->verbose(CALL_INFO, 4, 0, "All load/store/custom slots occupied, no more issues will be attempted.\n");
 				break;
@@ -546,9 +624,22 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 		} else {
 			out->fatal(CALL_INFO, -1, "Error, invalid operation \n");
 		}
+
+		// The walk ends with the last request in the queue
+		if(nxtRq == pendingRequests.at(numPending - 1)) {
+			break;
+		}
+		from = seq + 1;
 	}
 
-    pendingRequests.erase(delReqs);
+    std::vector<uint32_t> delIndices;
+    for(auto req : delReqs) {
+        delIndices.push_back(queueIndexOf(req->getQueueSeq()));
+    }
+    pendingRequests.erase(delIndices);
+    for(auto req : delReqs) {
+        delete req;
+    }
 
     if(issued) {
 		statCyclesWithIssue->addData(1);
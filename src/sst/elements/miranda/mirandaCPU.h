@@ -20,6 +20,10 @@
 #include <sst/core/interfaces/stdMem.h>
 #include <sst/core/statapi/stataccumulator.h>
 
+#include <map>
+#include <unordered_map>
+#include <vector>
+
 #include "mirandaGenerator.h"
 #include "mirandaEvent.h"
 #include "mirandaMemMgr.h"
@@ -154,6 +158,10 @@ public:
         SST_SER(pendingRequests);
         SST_SER(memMgr);
 
+        if (ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            addDependents(0);
+        }
+
         SST_SER(maxRequestsPending);
         SST_SER(requestsPending);
         SST_SER(reqMaxPerCycle);
@@ -190,19 +198,30 @@ private:
     void issueRequest(MemoryOpRequest* req);
     void issueCustomRequest(CustomOpRequest* req);
     void handleSrcEvent( SST::Event* );
+    void addDependents(const uint32_t firstNew);
+    void removeDependent(GeneratorRequest* req);
+    GeneratorRequest* nextIssueCandidate(const uint64_t from);
+    uint32_t queueIndexOf(const uint64_t seq);
 
     Output* out = nullptr;
 
     TimeConverter timeConverter;
     Clock::HandlerBase* clockHandler = nullptr;
     RequestGenerator* reqGen = nullptr;
-    std::map<StandardMem::Request::id_t, CPURequest*> requestsInFlight;
+    std::unordered_map<StandardMem::Request::id_t, CPURequest*> requestsInFlight;
     StandardMem* cache_link = nullptr;
     Link* srcLink = nullptr;
     MirandaReqEvent* srcReqEvent = nullptr;
     StdMemHandler* stdMemHandlers = nullptr;
 
     MirandaRequestQueue<GeneratorRequest*> pendingRequests;
+    // Pending requests waiting on each request ID, rebuilt from pendingRequests on restart
+    std::unordered_map<uint64_t, std::vector<GeneratorRequest*>> dependentRequests;
+    // Pending requests of each operation and the ones among them that can issue,
+    // by queue sequence number. Rebuilt with dependentRequests on restart
+    std::map<uint64_t, GeneratorRequest*> queuedRequests[OPCOUNT];
+    std::map<uint64_t, GeneratorRequest*> readyRequests[OPCOUNT];
+    uint64_t nextQueueSeq = 0;
     MirandaMemoryManager* memMgr = nullptr;
 
     uint32_t maxRequestsPending[OPCOUNT];
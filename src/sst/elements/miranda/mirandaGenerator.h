@@ -23,7 +23,12 @@
 #include <sst/core/output.h>
 #include <sst/core/interfaces/stdMem.h>
 
+#include "sst/elements/sizeClassPool.h"
+
+#include <algorithm>
+#include <cstdlib>
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Miranda {
@@ -70,6 +75,10 @@ public:
         return dependsOn.empty();
     }
 
+    const std::vector<uint64_t>& getDependencies() const {
+        return dependsOn;
+    }
+
     uint64_t getIssueTime() const {
         return issueTime;
     }
@@ -78,6 +87,14 @@ public:
         issueTime = now;
     }
 
+    uint64_t getQueueSeq() const {
+        return queueSeq;
+    }
+
+    void setQueueSeq(const uint64_t seq) {
+        queueSeq = seq;
+    }
+
     virtual void serialize_order(SST::Core::Serialization::serializer& ser) override {
         SST_SER(reqID);
         SST_SER(issueTime);
@@ -91,10 +108,16 @@ protected:
     uint64_t reqID;
     uint64_t issueTime;
     std::vector<uint64_t> dependsOn;
+    // Order in the CPU's pending queue, assigned again on restart
+    uint64_t queueSeq = 0;
 private:
     static std::atomic<uint64_t> nextGeneratorRequestID;
 };
 
+// Queue of generated requests waiting to issue. The queue is a ring buffer,
+// so requests issued from the front of the queue are removed by moving the
+// head forward and removing requests from the issue window only moves the
+// requests ahead of them.
 template<typename QueueType>
 class MirandaRequestQueue {
 public:
@@ -102,6 +125,7 @@ public:
         theQ = (QueueType*) malloc(sizeof(QueueType) * 16);
         maxCapacity = 16;
         curSize = 0;
+        head = 0;
     }
     ~MirandaRequestQueue() {
         free(theQ);
@@ -113,14 +137,15 @@ public:
 
     void resize(const uint32_t newSize) {
         QueueType * newQ = (QueueType *) malloc(sizeof(QueueType) * newSize);
+        curSize = std::min(curSize, newSize);
         for(uint32_t i = 0; i < curSize; ++i) {
-            newQ[i] = theQ[i];
+            newQ[i] = at(i);
         }
 
         free(theQ);
         theQ = newQ;
         maxCapacity = newSize;
-        curSize = std::min(curSize, newSize);
+        head = 0;
     }
 
     uint32_t size() const {
@@ -132,61 +157,78 @@ public:
     }
 
     QueueType at(const uint32_t index) {
-        return theQ[index];
+        return theQ[slot(index)];
     }
 
-    void erase(const std::vector<uint32_t> eraseList) {
+    // Removes the requests at the indices in eraseList, which must be in
+    // increasing order. Cost is linear in the largest index erased.
+    void erase(const std::vector<uint32_t>& eraseList) {
         if(0 == eraseList.size()) {
             return;
         }
 
-        QueueType* newQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
-
-        uint32_t nextSkipIndex = 0;
-        uint32_t nextSkip = eraseList.at(nextSkipIndex);
-        uint32_t nextNewQIndex = 0;
+        // Move the requests that stay towards the back, over the erased ones
+        uint32_t nextSkipIndex = eraseList.size() - 1;
+        uint32_t nextNewQIndex = eraseList.back();
 
-        for(uint32_t i = 0; i < curSize; ++i) {
-            if(nextSkip == i) {
-                nextSkipIndex++;
-
-                if(nextSkipIndex >= eraseList.size()) {
-                    nextSkip = curSize;
-                } else {
-                    nextSkip = eraseList.at(nextSkipIndex);
-                }
+        for(uint32_t i = eraseList.back() + 1; i-- > 0; ) {
+            if(nextSkipIndex < eraseList.size() && eraseList.at(nextSkipIndex) == i) {
+                nextSkipIndex--;
             } else {
-                newQ[nextNewQIndex] = theQ[i];
-                nextNewQIndex++;
+                theQ[slot(nextNewQIndex)] = theQ[slot(i)];
+                nextNewQIndex--;
             }
         }
 
-        free(theQ);
-
-        theQ = newQ;
-        curSize = nextNewQIndex;
+        head = slot(eraseList.size());
+        curSize -= eraseList.size();
     }
 
     void push_back(QueueType t) {
         if(curSize == maxCapacity) {
-            resize(maxCapacity + 16);
+            resize(std::max(maxCapacity * 2, (uint32_t) 16));
         }
 
-        theQ[curSize] = t;
+        theQ[slot(curSize)] = t;
         curSize++;
     }
 
     void serialize_order(SST::Core::Serialization::serializer& ser) {
+        // Requests are kept from the start of the buffer in checkpoints
+        if(ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            free(theQ);
+            theQ = nullptr;
+        } else if(head != 0) {
+            resize(maxCapacity);
+        }
+
         //int theQ_size = sizeof(QueueType) * curSize;
         SST_SER(SST::Core::Serialization::array(theQ, curSize));
         SST_SER(maxCapacity);
         SST_SER(curSize);
+
+        if(ser.mode() == SST::Core::Serialization::serializer::UNPACK) {
+            QueueType* unpackedQ = theQ;
+            maxCapacity = std::max(maxCapacity, std::max(curSize, (uint32_t) 16));
+            theQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
+            for(uint32_t i = 0; i < curSize; ++i) {
+                theQ[i] = unpackedQ[i];
+            }
+            delete[] unpackedQ;
+            head = 0;
+        }
     }
 
 private:
+    uint32_t slot(const uint32_t index) const {
+        uint32_t s = head + index;
+        return s >= maxCapacity ? s - maxCapacity : s;
+    }
+
     QueueType* theQ = nullptr;
     uint32_t maxCapacity;
     uint32_t curSize;
+    uint32_t head = 0;
 };
 
 class MemoryOpRequest : public GeneratorRequest {
@@ -202,6 +244,9 @@ public:
     MemoryOpRequest() = default;
     ~MemoryOpRequest() {}
 
+    static void* operator new(std::size_t size) { return SizeClassPool::allocate(size); }
+    static void operator delete(void* ptr, std::size_t size) { SizeClassPool::release(ptr, size); }
+
     ReqOperation getOperation() const override { return op; }
     bool isRead() const { return op == READ; }
     bool isWrite() const { return op == WRITE; }
@@ -267,6 +312,17 @@ public:
     RequestGenerator() = default;
     ~RequestGenerator() {}
     virtual void generate(MirandaRequestQueue<GeneratorRequest*>* q) { }
+    // Generates the requests of up to count calls to generate(), stopping
+    // once the generator is finished. Generators override this to work out
+    // a whole block of requests at a time.
+    virtual void generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) {
+        for(uint32_t i = 0; i < count; ++i) {
+            if(isFinished()) {
+                break;
+            }
+            generate(q);
+        }
+    }
     virtual bool isFinished() { return true; }
     virtual void completed() { }
 
@@ -0,0 +1,77 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MIRANDA_PATTERN
+#define _H_SST_MIRANDA_PATTERN
+
+#include <stdint.h>
+
+namespace SST {
+namespace Miranda {
+
+// Address pattern kernels shared by the generators.
+//
+// Generators work out the addresses of a block of requests with these
+// before they create the requests. The loops have no dependencies between
+// iterations so the compiler can vectorize them, anything which has to be
+// sequential (e.g. drawing random numbers) is done by the caller into an
+// input array first.
+
+// Number of addresses generators work out at a time
+const uint32_t MIRANDA_PATTERN_BLOCK = 64;
+
+// addrs[i] = base + (index + i) * stride
+static inline void patternStrided(uint64_t* addrs, const uint32_t count,
+        const uint64_t base, const uint64_t index, const uint64_t stride) {
+    for(uint32_t i = 0; i < count; ++i) {
+        addrs[i] = base + ((index + i) * stride);
+    }
+}
+
+// Random addresses aligned to align within [base, base + range), from
+// random numbers drawn by the caller
+static inline void patternRandom(uint64_t* addrs, const uint64_t* rand, const uint32_t count,
+        const uint64_t base, const uint64_t range, const uint64_t align) {
+    const uint64_t slots = range / align;
+    for(uint32_t i = 0; i < count; ++i) {
+        addrs[i] = ((rand[i] % slots) * align) + base;
+    }
+}
+
+// addrs[i] = base + index[i] * width
+static inline void patternGather(uint64_t* addrs, const uint64_t* index, const uint32_t count,
+        const uint64_t base, const uint64_t width) {
+    for(uint32_t i = 0; i < count; ++i) {
+        addrs[i] = base + (index[i] * width);
+    }
+}
+
+// Addresses of the neighbours of the element at center, offsets are in
+// elements. IndexType sets the arithmetic the element indices are computed
+// in, so generators which index with 32-bit integers get the same wrap
+// around as before.
+template<typename IndexType>
+static inline void patternStencil(uint64_t* addrs, const IndexType* offsets, const uint32_t count,
+        const IndexType center, const IndexType width) {
+    for(uint32_t i = 0; i < count; ++i) {
+        addrs[i] = (IndexType) (width * (IndexType) (center + offsets[i]));
+    }
+}
+
+}
+}
+
+#endif
@@ -0,0 +1,249 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_SAMBA_PAGE_TABLE
+#define _H_SST_SAMBA_PAGE_TABLE
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+
+namespace SST {
+namespace SambaComponent {
+
+class PageTable;
+
+// The page table of the application running on an Ariel instance, shared
+// by all units of the Samba component that models its MMU.
+//
+// The tables are laid out like an x86-64 page table: a tree of 512 entry
+// tables, one level per 9 bits of the virtual page number, PGD tables at
+// the top and PTE tables at the bottom. A level is addressed the way the
+// page table walker always has, with the virtual address divided by the
+// coverage of one entry at that level (VA/4KB for the PTE level, VA/2MB
+// for PMD, VA/1GB for PUD and VA/512GB for PGD). Each entry holds the
+// physical address of the next table (or of the page for PTEs) and flags
+// for leaf mappings (4KB pages in PTEs, 2MB in PMDs, 1GB in PUDs) and for
+// page faults in flight.
+//
+// PGD tables are found through a hash on the bits above the PGD index, so
+// addresses beyond 48 bits still work. The last table used at each level
+// is remembered, so walks that stay within a table skip the tree.
+
+// Entries of one level of the page table
+class PageTableEntries {
+public:
+    bool contains(uint64_t key) const;
+    // Entry for key, creating an empty one if there is none (like std::map)
+    uint64_t& operator[](uint64_t key);
+    void erase(uint64_t key);
+
+private:
+    friend class PageTable;
+    PageTableEntries() : table(nullptr), level(0) {}
+
+    PageTable* table;
+    int level;
+};
+
+// One flag on the entries of one level of the page table
+class PageTableFlags {
+public:
+    bool contains(uint64_t key) const;
+    void insert(uint64_t key);
+    void erase(uint64_t key);
+
+private:
+    friend class PageTable;
+    PageTableFlags() : table(nullptr), level(0), flag(0) {}
+
+    PageTable* table;
+    int level;
+    uint8_t flag;
+};
+
+class PageTable {
+public:
+    enum { PTE_LEVEL = 0, PMD_LEVEL = 1, PUD_LEVEL = 2, PGD_LEVEL = 3, NUM_LEVELS = 4 };
+
+    PageTable() {
+        initEntries(PGD, PGD_LEVEL);
+        initEntries(PUD, PUD_LEVEL);
+        initEntries(PMD, PMD_LEVEL);
+        initEntries(PTE, PTE_LEVEL);
+
+        initFlags(MAPPED_PAGE_SIZE4KB, PTE_LEVEL, MAPPED);
+        initFlags(MAPPED_PAGE_SIZE2MB, PMD_LEVEL, MAPPED);
+        initFlags(MAPPED_PAGE_SIZE1GB, PUD_LEVEL, MAPPED);
+
+        initFlags(PENDING_PAGE_FAULTS, PTE_LEVEL, PAGE_FAULT);
+        initFlags(PENDING_PAGE_FAULTS_PGD, PGD_LEVEL, TABLE_FAULT);
+        initFlags(PENDING_PAGE_FAULTS_PUD, PUD_LEVEL, TABLE_FAULT);
+        initFlags(PENDING_PAGE_FAULTS_PMD, PMD_LEVEL, TABLE_FAULT);
+        initFlags(PENDING_PAGE_FAULTS_PTE, PTE_LEVEL, TABLE_FAULT);
+
+        for ( int i = 0; i < NUM_LEVELS; i++ ) {
+            last_table[i] = nullptr;
+            last_prefix[i] = 0;
+        }
+    }
+
+    PageTable(const PageTable&) = delete;
+    PageTable& operator=(const PageTable&) = delete;
+
+    ~PageTable() {
+        for ( auto& root : roots )
+            freeTable(root.second, PGD_LEVEL);
+    }
+
+    // Physical pointers held in PGD, PUD and PMD entries, PTE entries give
+    // the physical address of the page
+    PageTableEntries PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+    PageTableEntries PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+    PageTableEntries PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+    PageTableEntries PTE; // key is 9 bits 12-20, i.e., VA/(4096)
+
+    // Leaf mappings, used to quickly check if a page is mapped or not
+    PageTableFlags MAPPED_PAGE_SIZE4KB;
+    PageTableFlags MAPPED_PAGE_SIZE2MB;
+    PageTableFlags MAPPED_PAGE_SIZE1GB;
+
+    // Page faults in flight
+    PageTableFlags PENDING_PAGE_FAULTS;
+    PageTableFlags PENDING_PAGE_FAULTS_PGD;
+    PageTableFlags PENDING_PAGE_FAULTS_PUD;
+    PageTableFlags PENDING_PAGE_FAULTS_PMD;
+    PageTableFlags PENDING_PAGE_FAULTS_PTE;
+
+private:
+    friend class PageTableEntries;
+    friend class PageTableFlags;
+
+    static const int INDEX_BITS = 9;
+    static const unsigned ENTRIES = 1 << INDEX_BITS;
+
+    enum : uint8_t { PRESENT = 1, MAPPED = 2, PAGE_FAULT = 4, TABLE_FAULT = 8 };
+
+    struct Table {
+        Table() : next(nullptr) {
+            memset(entry, 0, sizeof(entry));
+            memset(flags, 0, sizeof(flags));
+        }
+
+        uint64_t entry[ENTRIES];
+        uint8_t flags[ENTRIES];
+        Table** next; // tables one level down, not allocated for PTE tables
+    };
+
+    void initEntries(PageTableEntries& entries, int level) {
+        entries.table = this;
+        entries.level = level;
+    }
+
+    void initFlags(PageTableFlags& flags, int level, uint8_t flag) {
+        flags.table = this;
+        flags.level = level;
+        flags.flag = flag;
+    }
+
+    // The table holding the entry for key at a level, nullptr if it does
+    // not exist and create is false
+    Table* getTable(int level, uint64_t key, bool create) {
+        const uint64_t prefix = key >> INDEX_BITS;
+        if ( last_table[level] != nullptr && last_prefix[level] == prefix )
+            return last_table[level];
+
+        // PGD key of the address, then down one 9 bit index at a time
+        const uint64_t pgd_key = key >> (INDEX_BITS * (PGD_LEVEL - level));
+        Table* table;
+        auto root = roots.find(pgd_key >> INDEX_BITS);
+        if ( root != roots.end() ) {
+            table = root->second;
+        } else if ( create ) {
+            table = new Table();
+            roots[pgd_key >> INDEX_BITS] = table;
+        } else {
+            return nullptr;
+        }
+
+        for ( int l = PGD_LEVEL; l > level; l-- ) {
+            const unsigned index = (key >> (INDEX_BITS * (l - level))) & (ENTRIES - 1);
+            if ( table->next == nullptr ) {
+                if ( !create )
+                    return nullptr;
+                table->next = new Table*[ENTRIES]();
+            }
+            if ( table->next[index] == nullptr ) {
+                if ( !create )
+                    return nullptr;
+                table->next[index] = new Table();
+            }
+            table = table->next[index];
+        }
+
+        last_table[level] = table;
+        last_prefix[level] = prefix;
+        return table;
+    }
+
+    bool test(int level, uint64_t key, uint8_t flag) {
+        Table* table = getTable(level, key, false);
+        return table != nullptr && (table->flags[key & (ENTRIES - 1)] & flag);
+    }
+
+    void set(int level, uint64_t key, uint8_t flag) {
+        getTable(level, key, true)->flags[key & (ENTRIES - 1)] |= flag;
+    }
+
+    void clear(int level, uint64_t key, uint8_t flag) {
+        Table* table = getTable(level, key, false);
+        if ( table != nullptr ) {
+            table->flags[key & (ENTRIES - 1)] &= ~flag;
+            if ( flag == PRESENT )
+                table->entry[key & (ENTRIES - 1)] = 0;
+        }
+    }
+
+    uint64_t& entry(int level, uint64_t key) {
+        Table* table = getTable(level, key, true);
+        table->flags[key & (ENTRIES - 1)] |= PRESENT;
+        return table->entry[key & (ENTRIES - 1)];
+    }
+
+    void freeTable(Table* table, int level) {
+        if ( table->next != nullptr ) {
+            for ( unsigned i = 0; i < ENTRIES; i++ ) {
+                if ( table->next[i] != nullptr )
+                    freeTable(table->next[i], level - 1);
+            }
+            delete[] table->next;
+        }
+        delete table;
+    }
+
+    std::unordered_map<uint64_t, Table*> roots;
+
+    Table* last_table[NUM_LEVELS];
+    uint64_t last_prefix[NUM_LEVELS];
+};
+
+inline bool PageTableEntries::contains(uint64_t key) const { return table->test(level, key, PageTable::PRESENT); }
+inline uint64_t& PageTableEntries::operator[](uint64_t key) { return table->entry(level, key); }
+inline void PageTableEntries::erase(uint64_t key) { table->clear(level, key, PageTable::PRESENT); }
+
+inline bool PageTableFlags::contains(uint64_t key) const { return table->test(level, key, flag); }
+inline void PageTableFlags::insert(uint64_t key) { table->set(level, key, flag); }
+inline void PageTableFlags::erase(uint64_t key) { table->clear(level, key, flag); }
+
+} // namespace SambaComponent
+} // namespace SST
+
+#endif
@@ -22,9 +22,6 @@ using namespace SST::SambaComponent;
 using namespace SST::MemHierarchy;
 using namespace SST;
 
-// This is and ID used to merely identify page walking requests
-long long int mmu_id=0;
-
 int max(int a, int b)
 {
     if ( a > b )
@@ -185,13 +182,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
             //if((*CR3) == -1)
             if(!(*cr3_init))
                 fault_level = 4;
-            else if((*PGD).find(temp_ptr->getAddress()/page_size[3]) == (*PGD).end())
+            else if(!PGD->contains(temp_ptr->getAddress()/page_size[3]))
                 fault_level = 3;
-            else if((*PUD).find(temp_ptr->getAddress()/page_size[2]) == (*PUD).end())
+            else if(!PUD->contains(temp_ptr->getAddress()/page_size[2]))
                 fault_level = 2;
-            else if((*PMD).find(temp_ptr->getAddress()/page_size[1]) == (*PMD).end())
+            else if(!PMD->contains(temp_ptr->getAddress()/page_size[1]))
                 fault_level = 1;
-            else if((*PTE).find(temp_ptr->getAddress()/page_size[0]) == (*PTE).end())
+            else if(!PTE->contains(temp_ptr->getAddress()/page_size[0]))
                 fault_level = 0;
             else
                 output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
@@ -200,10 +197,10 @@ void PageTableWalker::handleEvent( SST::Event* e )
         {
             uint64_t offset = (uint64_t)512*512*512*512;
             if(!(*cr3_init)) fault_level = 4;
-            else if((*PGD).find((temp_ptr->getAddress()/page_size[3])%512) == (*PGD).end()) fault_level = 3;
-            else if((*PUD).find((temp_ptr->getAddress()/page_size[2])%(512*512)) == (*PUD).end()) fault_level = 2;
-            else if((*PMD).find((temp_ptr->getAddress()/page_size[1])%(512*512*512)) == (*PMD).end()) fault_level = 1;
-            else if((*PTE).find((temp_ptr->getAddress()/page_size[0])%offset) == (*PTE).end()) fault_level = 0;
+            else if(!PGD->contains((temp_ptr->getAddress()/page_size[3])%512)) fault_level = 3;
+            else if(!PUD->contains((temp_ptr->getAddress()/page_size[2])%(512*512))) fault_level = 2;
+            else if(!PMD->contains((temp_ptr->getAddress()/page_size[1])%(512*512*512))) fault_level = 1;
+            else if(!PTE->contains((temp_ptr->getAddress()/page_size[0])%offset)) fault_level = 0;
             else output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
         }
 
@@ -238,10 +235,10 @@ void PageTableWalker::handleEvent( SST::Event* e )
                 (*PGD)[stall_addr/page_size[3]] = temp_ptr->getPaddress();
             else
             {
-                if((*PGD).find((stall_addr/page_size[3])%512) != (*PGD).end())
+                if(PGD->contains((stall_addr/page_size[3])%512))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PGD!!\n");
                 (*PGD)[(stall_addr/page_size[3])%512] = temp_ptr->getPaddress();
-                (*PENDING_PAGE_FAULTS_PGD).erase((stall_addr/page_size[3])%(512));
+                PENDING_PAGE_FAULTS_PGD->erase((stall_addr/page_size[3])%(512));
             }
             fault_level--;
             pageFaultHandler->allocatePage(coreId,fault_level,stall_addr/page_size[fault_level],4096);
@@ -253,13 +250,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
                 (*PUD)[stall_addr/page_size[2]] = temp_ptr->getPaddress();
             else
             {
-                if((*PUD).find((stall_addr/page_size[2])%(512*512)) != (*PUD).end())
+                if(PUD->contains((stall_addr/page_size[2])%(512*512)))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PUD!!\n");
                 (*PUD)[(stall_addr/page_size[2])%(512*512)] = temp_ptr->getPaddress();
-                (*PENDING_PAGE_FAULTS_PUD).erase((stall_addr/page_size[2])%(512*512));
+                PENDING_PAGE_FAULTS_PUD->erase((stall_addr/page_size[2])%(512*512));
             }
             //if(temp_ptr->getSize() == page_size[2]) {
-            //	(*MAPPED_PAGE_SIZE1GB)[temp_ptr->getAddress()/page_size[2]] = 0;
+            //	MAPPED_PAGE_SIZE1GB->insert(temp_ptr->getAddress()/page_size[2]);
             //	fault_level = 0;
             //	stall = false;
             //	*hold = 0;
@@ -279,13 +276,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
             else
             {
                 uint64_t offset = 512*512*512;
-                if((*PMD).find((stall_addr/page_size[1])%offset) != (*PMD).end())
+                if(PMD->contains((stall_addr/page_size[1])%offset))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PMD!!\n");
                 (*PMD)[(stall_addr/page_size[1])%offset] = temp_ptr->getPaddress();
-                (*PENDING_PAGE_FAULTS_PMD).erase((stall_addr/page_size[1])%offset);
+                PENDING_PAGE_FAULTS_PMD->erase((stall_addr/page_size[1])%offset);
             }
             //if(temp_ptr->getSize() == page_size[1]) {
-            //	(*MAPPED_PAGE_SIZE2MB)[temp_ptr->getAddress()/page_size[1]] = 0;
+            //	MAPPED_PAGE_SIZE2MB->insert(temp_ptr->getAddress()/page_size[1]);
             //	fault_level = 0;
             //	stall = false;
             //	*hold = 0;
@@ -304,7 +301,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
             else
             {
                 uint64_t offset = (uint64_t)512*512*512*512;
-                if((*PTE).find((stall_addr/page_size[0])%offset) != (*PTE).end())
+                if(PTE->contains((stall_addr/page_size[0])%offset))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PTE!!\n");
                 (*PTE)[(stall_addr/page_size[0])%offset] = temp_ptr->getPaddress();
             }
@@ -318,14 +315,14 @@ void PageTableWalker::handleEvent( SST::Event* e )
     {
         if(!ptw_confined)
         {
-            (*MAPPED_PAGE_SIZE4KB)[stall_addr/page_size[0]] = 0;
-            (*PENDING_PAGE_FAULTS).erase(stall_addr/page_size[0]);
+            MAPPED_PAGE_SIZE4KB->insert(stall_addr/page_size[0]);
+            PENDING_PAGE_FAULTS->erase(stall_addr/page_size[0]);
         }
         else
         {
             uint64_t offset = (uint64_t)512*512*512*512;
-            (*MAPPED_PAGE_SIZE4KB)[(stall_addr/page_size[0])%offset] = 0;
-            (*PENDING_PAGE_FAULTS_PTE).erase((stall_addr/page_size[0])%offset);
+            MAPPED_PAGE_SIZE4KB->insert((stall_addr/page_size[0])%offset);
+            PENDING_PAGE_FAULTS_PTE->erase((stall_addr/page_size[0])%offset);
         }
     }
     delete temp_ptr;
@@ -359,28 +356,33 @@ void PageTableWalker::recvResp(SST::Event * event)
     MemEvent * ev = static_cast<MemEvent*>(event);
 
 
-    long long int pw_id;
+    id_type req_id;
     if(!self_connected)
-        pw_id = MEM_REQ[ev->getResponseToID()];
+        req_id = ev->getResponseToID();
     else
-        pw_id = MEM_REQ[ev->getID()];
+        req_id = ev->getID();
 
-    //WID_Add[] is virtual address, WSR_PT_LEVEL[] is level of page table
-    insert_way(WID_Add[pw_id], find_victim_way(WID_Add[pw_id], WSR_PT_LEVEL[pw_id]), WSR_PT_LEVEL[pw_id]);
+    auto req = MEM_REQ.find(req_id);
+    if(req == MEM_REQ.end())
+        output->fatal(CALL_INFO, -1, "PTW received a response to unknown request (%" PRIu64 ", %d)\n", req_id.first, req_id.second);
+    long long int pw_id = req->second;
+    WalkState & walk = walks[pw_id];
 
-    Address_t addr = WID_Add[pw_id];
+    //walk.addr is virtual address, walk.pt_level is level of page table
+    insert_way(walk.addr, find_victim_way(walk.addr, walk.pt_level), walk.pt_level);
 
-    WSR_READY[pw_id]=true;
+    Address_t addr = walk.addr;
 
     // Avoiding memory leak by deleting the newly generated dummy requests
-    MEM_REQ.erase(ev->getID());
+    MEM_REQ.erase(req);
     delete ev;
 
-    if(WSR_PT_LEVEL[pw_id]==0)
+    if(walk.pt_level==0)
     {
-        ready_by[WID_EV[pw_id]] =  currTime + latency + 2*upper_link_latency;
+        ready_by.insert(walk.ev, currTime + latency + 2*upper_link_latency, os_page_size); // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
-        ready_by_size[WID_EV[pw_id]] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+        // The walk is done, its slot can be reused
+        free_walks.push_back(pw_id);
     }
     else
     {
@@ -394,28 +396,28 @@ void PageTableWalker::recvResp(SST::Event * event)
             if(!ptw_confined)
             {
                 Address_t page_table_start = 0;
-                if(WSR_PT_LEVEL[pw_id]==4)
+                if(walk.pt_level==4)
                     page_table_start = (*PGD)[addr/page_size[3]];
-                else if(WSR_PT_LEVEL[pw_id]==3)
+                else if(walk.pt_level==3)
                     page_table_start = (*PUD) [addr/page_size[2]];
-                else if(WSR_PT_LEVEL[pw_id]==2)
+                else if(walk.pt_level==2)
                     page_table_start = (*PMD) [addr/page_size[1]];
-                else if (WSR_PT_LEVEL[pw_id] == 1)
+                else if (walk.pt_level == 1)
                     page_table_start = (*PTE) [addr/page_size[0]];
 
-                dummy_add = page_table_start + (addr/page_size[WSR_PT_LEVEL[pw_id]-1])%512;
+                dummy_add = page_table_start + (addr/page_size[walk.pt_level-1])%512;
             }
             else
             {
-                if(WSR_PT_LEVEL[pw_id]==4) {
+                if(walk.pt_level==4) {
                     dummy_add = (*CR3) + ((addr/page_size[3])%512)*8;
                 }
-                else if(WSR_PT_LEVEL[pw_id]==3) {
+                else if(walk.pt_level==3) {
                     dummy_add = (*PGD)[(addr/page_size[3])%512] + ((addr/page_size[2])%512)*8;
                 }
-                else if(WSR_PT_LEVEL[pw_id]==2) {
+                else if(walk.pt_level==2) {
                     dummy_add = (*PUD)[(addr/page_size[2])%(512*512)] + ((addr/page_size[1])%512)*8;}
-                else if(WSR_PT_LEVEL[pw_id]==1) {
+                else if(walk.pt_level==1) {
                     uint64_t offset = (uint64_t)512*512*512;
                     dummy_add = (*PMD)[(addr/page_size[1])%offset] + ((addr/page_size[0])%512)*8;
                 }
@@ -427,7 +429,7 @@ void PageTableWalker::recvResp(SST::Event * event)
         MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
         e->setVirtualAddress(addr);
 
-        WSR_PT_LEVEL[pw_id]--;
+        walk.pt_level--;
         MEM_REQ[e->getID()]=pw_id;
         to_mem->send(e);
 
@@ -447,7 +449,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
         if(!ptw_confined)
         {
             //std::cout<< getName().c_str() << " Core: " << coreId << " stalled with stall address: " << stall_addr << std::endl;
-            if((*PENDING_PAGE_FAULTS).find(stall_addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
+            if(!PENDING_PAGE_FAULTS->contains(stall_addr/page_size[0])) {
                 stall = false;
                 *hold = 0;
             }
@@ -459,10 +461,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             switch(stall_at_levels) {
             case 4:
             {
-                if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end() &&
-                    (*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-                    (*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!PENDING_PAGE_FAULTS_PGD->contains((stall_addr/page_size[3])%(512)) &&
+                    !PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512)) &&
+                    !PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -471,9 +473,9 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 3:
             {
-                if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-                    (*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512)) &&
+                    !PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -481,8 +483,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 2:
             {
-                if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -490,10 +492,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 1:
             {
-                if(stall_at_PGD) {if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) release = 1;}
-                else if(stall_at_PUD) {if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) release = 1;}
-                else if(stall_at_PMD) {if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) release = 1;}
-                else if(stall_at_PTE) {if((*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) release = 1;}
+                if(stall_at_PGD) {if(!PENDING_PAGE_FAULTS_PGD->contains((stall_addr/page_size[3])%(512))) release = 1;}
+                else if(stall_at_PUD) {if(!PENDING_PAGE_FAULTS_PUD->contains((stall_addr/page_size[2])%(512*512))) release = 1;}
+                else if(stall_at_PMD) {if(!PENDING_PAGE_FAULTS_PMD->contains((stall_addr/page_size[1])%(512*512*512))) release = 1;}
+                else if(stall_at_PTE) {if(!PENDING_PAGE_FAULTS_PTE->contains((stall_addr/page_size[0])%(offset))) release = 1;}
                 else output->fatal(CALL_INFO, -1, "MMU: PTW DANGER!!.. stall at level not recognized..\n");
             }
                 break;
@@ -535,14 +537,14 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             bool fault = true;
             if(!ptw_confined)
             {
-                if((*MAPPED_PAGE_SIZE4KB).find(addr/page_size[0])!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find(addr/page_size[1])!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find(addr/page_size[2])!=(*MAPPED_PAGE_SIZE1GB).end())
+                if(MAPPED_PAGE_SIZE4KB->contains(addr/page_size[0]) || MAPPED_PAGE_SIZE2MB->contains(addr/page_size[1]) || MAPPED_PAGE_SIZE1GB->contains(addr/page_size[2]))
                     fault = false;
 
                 if(fault)
                 {
                     stall_addr = addr;
-                    if((*PENDING_PAGE_FAULTS).find(addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
-                        (*PENDING_PAGE_FAULTS)[addr/page_size[0]] = 0;
+                    if(!PENDING_PAGE_FAULTS->contains(addr/page_size[0])) {
+                        PENDING_PAGE_FAULTS->insert(addr/page_size[0]);
                         SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                         //std::cout<< getName().c_str() << " Core id: " << coreId << " Fault at address "<<addr<<std::endl;
                         tse->setResp(addr,0,4096);
@@ -552,31 +554,31 @@ bool PageTableWalker::tick(SST::Cycle_t x)
 
                     stall = true;
                     *hold = 1;
-    //				(*MAPPED_PAGE_SIZE4KB)[addr/page_size[0]] = 0; // FIXME: Hack to avoid propogating faulting VA through all events, only for initial testing
+    //				MAPPED_PAGE_SIZE4KB->insert(addr/page_size[0]); // FIXME: Hack to avoid propogating faulting VA through all events, only for initial testing
                     return false;
                 }
             }
             else
             {
                 uint64_t offset = (uint64_t)512*512*512*512;
-                if((*MAPPED_PAGE_SIZE4KB).find((addr/page_size[0])%offset)!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find((addr/page_size[1])%(512*512*512))!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find((addr/page_size[2])%(512*512))!=(*MAPPED_PAGE_SIZE1GB).end())
+                if(MAPPED_PAGE_SIZE4KB->contains((addr/page_size[0])%offset) || MAPPED_PAGE_SIZE2MB->contains((addr/page_size[1])%(512*512*512)) || MAPPED_PAGE_SIZE1GB->contains((addr/page_size[2])%(512*512)))
                     fault = false;
 
                 if(fault)
                 {
                     stall_addr = addr;
                     if(to_mem!=NULL) {
-                    if((*PGD).find((addr/page_size[3])%512) == (*PGD).end()) {
+                    if(!PGD->contains((addr/page_size[3])%512)) {
                         stall_at_levels = 1;
                         stall_at_PGD = 1;
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PGD).find((addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) {
-                            (*PENDING_PAGE_FAULTS_PGD)[(addr/page_size[3])%512] = 0;
-                            (*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
-                            (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
-                            (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
+                        if(!PENDING_PAGE_FAULTS_PGD->contains((addr/page_size[3])%(512))) {
+                            PENDING_PAGE_FAULTS_PGD->insert((addr/page_size[3])%512);
+                            PENDING_PAGE_FAULTS_PUD->insert((addr/page_size[2])%(512*512));
+                            PENDING_PAGE_FAULTS_PMD->insert((addr/page_size[1])%(512*512*512));
+                            PENDING_PAGE_FAULTS_PTE->insert((addr/page_size[0])%(offset));
                             stall_at_levels += 3;
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
@@ -586,16 +588,16 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PUD).find((addr/page_size[2])%(512*512)) == (*PUD).end()) {
+                    else if(!PUD->contains((addr/page_size[2])%(512*512))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 1;
                         stall_at_PMD = 0;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PUD).find((addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) {
-                            (*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
-                            (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
-                            (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
+                        if(!PENDING_PAGE_FAULTS_PUD->contains((addr/page_size[2])%(512*512))) {
+                            PENDING_PAGE_FAULTS_PUD->insert((addr/page_size[2])%(512*512));
+                            PENDING_PAGE_FAULTS_PMD->insert((addr/page_size[1])%(512*512*512));
+                            PENDING_PAGE_FAULTS_PTE->insert((addr/page_size[0])%(offset));
                             stall_at_levels += 2;
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
@@ -605,15 +607,15 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PMD).find((addr/page_size[1])%(512*512*512)) == (*PMD).end()) {
+                    else if(!PMD->contains((addr/page_size[1])%(512*512*512))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 0;
                         stall_at_PMD = 1;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PMD).find((addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) {
-                            (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
-                            (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
+                        if(!PENDING_PAGE_FAULTS_PMD->contains((addr/page_size[1])%(512*512*512))) {
+                            PENDING_PAGE_FAULTS_PMD->insert((addr/page_size[1])%(512*512*512));
+                            PENDING_PAGE_FAULTS_PTE->insert((addr/page_size[0])%(offset));
                             stall_at_levels += 1;
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
@@ -623,14 +625,14 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PTE).find((addr/page_size[0])%(offset)) == (*PTE).end()) {
+                    else if(!PTE->contains((addr/page_size[0])%(offset))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 1;
-                        if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
-                            (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
+                        if(!PENDING_PAGE_FAULTS_PTE->contains((addr/page_size[0])%(offset))) {
+                            PENDING_PAGE_FAULTS_PTE->insert((addr/page_size[0])%(offset));
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
                             s_EventChan->send(tse);
@@ -649,8 +651,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 1;
-                        if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
-                            (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
+                        if(!PENDING_PAGE_FAULTS_PTE->contains((addr/page_size[0])%(offset))) {
+                            PENDING_PAGE_FAULTS_PTE->insert((addr/page_size[0])%(offset));
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
                             s_EventChan->send(tse);
@@ -685,13 +687,11 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             update_lru(addr, hit_id);
             hits++;
             statPageTableWalkerHits->addData(1);
+            // Tracking the hit request size
             if(parallel_mode)
-                ready_by[ev] = x;
+                ready_by.insert(ev, x, os_page_size); //page_size[hit_id]/1024;
             else
-                ready_by[ev] = x + latency;
-
-            // Tracking the hit request size
-            ready_by_size[ev] = os_page_size; //page_size[hit_id]/1024;
+                ready_by.insert(ev, x + latency, os_page_size); //page_size[hit_id]/1024;
 
             st_1 = not_serviced.erase(st_1);
         }
@@ -715,7 +715,17 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 if(to_mem!=nullptr)
                 {
 
-                    WID_EV[++mmu_id] = (*st_1);
+                    long long int mmu_id;
+                    if(free_walks.empty())
+                    {
+                        mmu_id = walks.size();
+                        walks.push_back(WalkState());
+                    }
+                    else
+                    {
+                        mmu_id = free_walks.back();
+                        free_walks.pop_back();
+                    }
 
                     Address_t dummy_add = rand()%10000000;
 
@@ -747,12 +757,11 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                     Address_t dummy_base_add = dummy_add & ~(line_size - 1);
                     MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
 
-                    // Record this walk request into WSR_ and WID_ structs
-                    WSR_PT_LEVEL[mmu_id] = k-1;
-                    //		WID_EV[mmu_id] = e;
-                    WID_Add[mmu_id] = addr;
+                    // Record this walk request into its walk slot
+                    walks[mmu_id].pt_level = k-1;
+                    walks[mmu_id].addr = addr;
+                    walks[mmu_id].ev = (*st_1);
                     e->setVirtualAddress(addr);
-                    WSR_READY[mmu_id] = false;
 
                     // Add it to the tracking structure
                     MEM_REQ[e->getID()]=mmu_id;
@@ -771,9 +780,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                     // JVOROBY: We don't actually have a memory link, so instead just wait for an appropriate latency
 
 
-                    ready_by[ev] = x + latency + 2*upper_link_latency + page_walk_latency;  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
-
-                    ready_by_size[ev] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+                    // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
+                    ready_by.insert(ev, x + latency + 2*upper_link_latency + page_walk_latency, os_page_size); // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
                     st_1 = not_serviced.erase(st_1);
                 }
@@ -788,88 +796,67 @@ bool PageTableWalker::tick(SST::Cycle_t x)
     }
 
 
-    std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare>::iterator st, en;
-    st = ready_by.begin();
-    en = ready_by.end();
+    ready.clear();
+    ready_by.popReady(x, ready);
 
-    while(st!=en)
+    for(auto &r : ready) // for each event that is ready
     {
 
-        bool deleted=false;
-        if(st->second <= x) // if this event is ready
-        {
-
-            Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
+        Address_t addr = ((MemEvent*) r.ev)->getVirtualAddress();
 
-            // Double checking that we actually still don't have it inserted
-            //std::cout<<"The address is"<<addr<<std::endl;
-            if(!check_hit(addr, 0))
-            {
-                insert_way(addr, find_victim_way(addr, 0), 0);
-                update_lru(addr, 0);
-            }
-            else
-                update_lru(addr, 0);
+        // Double checking that we actually still don't have it inserted
+        //std::cout<<"The address is"<<addr<<std::endl;
+        if(!check_hit(addr, 0))
+        {
+            insert_way(addr, find_victim_way(addr, 0), 0);
+            update_lru(addr, 0);
+        }
+        else
+            update_lru(addr, 0);
 
 
-            service_back->push_back(st->first);
+        service_back->push_back(r.ev);
 
 
-            if(emulate_faults)
+        if(emulate_faults)
+        {
+            if(!ptw_confined)
             {
-                if(!ptw_confined)
+                if(!PTE->contains(addr/4096))
                 {
-                    if((*PTE).find(addr/4096)==(*PTE).end())
-                    {
-                        std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
-                        std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
-                    }
+                    std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
+                    std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
                 }
-                else
+            }
+            else
+            {
+                uint64_t offset = (uint64_t)512*512*512*512;
+                if(!PTE->contains((addr/4096)%offset))
                 {
-                    uint64_t offset = (uint64_t)512*512*512*512;
-                    if((*PTE).find((addr/4096)%offset)==(*PTE).end())
-                    {
-                        std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
-                        std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
-                    }
+                    std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
+                    std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
                 }
             }
+        }
 
-            (*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-            ready_by_size.erase(st->first);
-
-
-
-
-            deleted = true;
+        (*service_back_size)[r.ev]=r.size;
 
 
-            // Deleting it from pending requests
-            std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
-            st2 = pending_misses.begin();
-            en2 = pending_misses.end();
+        // Deleting it from pending requests
+        std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
+        st2 = pending_misses.begin();
+        en2 = pending_misses.end();
 
 
-            while(st2!=en2)
+        while(st2!=en2)
+        {
+            if(*st2 == r.ev)
             {
-                if(*st2 == st->first)
-                {
-                    pending_misses.erase(st2);
-                    break;
-                }
-                st2++;
+                pending_misses.erase(st2);
+                break;
             }
-
-            ready_by.erase(st);
-
+            st2++;
         }
-        if(deleted)
-            st=ready_by.begin();
-        else
-            st++;
 
     }
 
@@ -890,8 +877,8 @@ void PageTableWalker::initaitePageMigration(Address_t vaddress, Address_t paddre
     /*
     if((*PENDING_SHOOTDOWN_EVENTS).find(vaddress/page_size[0]) == (*PENDING_SHOOTDOWN_EVENTS).end()) {
         (*PENDING_SHOOTDOWN_EVENTS)[vaddress/page_size[0]] = 0;
-        (*PENDING_PAGE_FAULTS)[vaddress/page_size[0]] = 0;		//add to pending page faults list
-        (*MAPPED_PAGE_SIZE4KB).erase(vaddress/page_size[0]); 	//unmap the page
+        PENDING_PAGE_FAULTS->insert(vaddress/page_size[0]);		//add to pending page faults list
+        MAPPED_PAGE_SIZE4KB->erase(vaddress/page_size[0]); 	//unmap the page
         SambaEvent * tse = new SambaEvent(EventType::SHOOTDOWN);
         tse->setResp(vaddress/page_size[0],paddress,4096);
         s_EventChan->send(10, tse);
@@ -26,6 +26,7 @@
 #include <vector>
 
 #include "utils.h"
+#include "page_table.h"
 #include "page_fault_handler.h"
 
 // This file defines the page table walker
@@ -106,21 +107,21 @@ class PageTableWalker : public ComponentExtension
 
     // Holds the PGD, PUD, PMT, PTE physical pointers
     // PTE should give you the exact physical address of the page
-    std::map<Address_t, Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
-    std::map<Address_t, Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
-    std::map<Address_t, Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
-    std::map<Address_t, Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
+    PageTableEntries * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+    PageTableEntries * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+    PageTableEntries * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+    PageTableEntries * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
 
     // The structures below are used to quickly check if the page is mapped or not
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+    PageTableFlags * MAPPED_PAGE_SIZE4KB;
+    PageTableFlags * MAPPED_PAGE_SIZE2MB;
+    PageTableFlags * MAPPED_PAGE_SIZE1GB;
 
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
+    PageTableFlags * PENDING_PAGE_FAULTS;
+    PageTableFlags * PENDING_PAGE_FAULTS_PGD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PUD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PMD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PTE;
 
     // This link is used to send internal events within the page table walker
     SST::Link * s_EventChan;
@@ -141,8 +142,8 @@ class PageTableWalker : public ComponentExtension
     std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * service_back_size; // This is used to pass the size of the  requests back to the previous level
 
     // === Holds requests that have gotten the data they need, but we need to wait the duration of the latency before returning
-    std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare> ready_by;
-    std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // keeps track of requests' sizes inside this structure
+    ReadyQueue ready_by; // also keeps track of requests' sizes inside this structure
+    std::vector<ReadyQueue::Entry> ready; // requests that are ready this cycle
     std::vector<MemHierarchy::MemEventBase *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
 
     SST::Cycle_t currTime;
@@ -156,9 +157,9 @@ class PageTableWalker : public ComponentExtension
     PageTableWalker(ComponentId_t id, int page_size, int assoc, PageTableWalker * next_level, int size);
     PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker * Next_level,int level, SST::Params& params);
 
-    void setPageTablePointers( Address_t * cr3, std::map<Address_t, Address_t> * pgd,  std::map<Address_t, Address_t> * pud,  std::map<Address_t, Address_t> * pmd, std::map<Address_t, Address_t> * pte,
-            std::map<Address_t,int> * gb,  std::map<Address_t,int> * mb,  std::map<Address_t,int> * kb, std::map<Address_t,int> * pr, int *cr3I, std::map<Address_t,int> *pf_pgd,  std::map<Address_t,int> *pf_pud,
-            std::map<Address_t,int> *pf_pmd, std::map<Address_t,int> * pf_pte)
+    void setPageTablePointers( Address_t * cr3, PageTableEntries * pgd,  PageTableEntries * pud,  PageTableEntries * pmd, PageTableEntries * pte,
+            PageTableFlags * gb,  PageTableFlags * mb,  PageTableFlags * kb, PageTableFlags * pr, int *cr3I, PageTableFlags * pf_pgd,  PageTableFlags * pf_pud,
+            PageTableFlags * pf_pmd, PageTableFlags * pf_pte)
     {
         CR3 = cr3;
         PGD = pgd;
@@ -236,18 +237,19 @@ class PageTableWalker : public ComponentExtension
     // which
     //
 
-    //Autoincrementing ID, used to index events held in the `WSR_` and `WID_` maps
-    long long int mmu_id=0;
+    // For a given page walk:
+    struct WalkState {
+        int pt_level; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
+        Address_t addr; // virtual address being translated
+        MemHierarchy::MemEventBase* ev; // the request that missed
+    };
 
-    // For a given page-walk memory request:
-    std::map<long long int, int> WSR_PT_LEVEL; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
-    std::map<long long int, bool> WSR_READY;
-
-    std::map<long long int, Address_t> WID_Add;
-    std::map<long long int, MemHierarchy::MemEventBase*> WID_EV;
+    // Walks in flight, indexed by `mmu_id`; slots of finished walks are reused
+    std::vector<WalkState> walks;
+    std::vector<long long int> free_walks;
 
     // Each Walk request generates a MemEvent that is sent out;
-    // This maps `memevent->getID()` to the corresponding `mmu_id`  used in the WSR_ and WID_ objects
+    // This maps `memevent->getID()` to the corresponding `mmu_id`  used in `walks`
     std::map<id_type, long long int> MEM_REQ;
 
     //=== Etc
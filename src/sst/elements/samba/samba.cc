@@ -115,7 +115,7 @@ Samba::Samba(SST::ComponentId_t id, SST::Params& params): Component(id) {
 			event_link = configureSelfLink(link_buffer, "1ns", new Event::Handler<PageTableWalker,&PageTableWalker::handleEvent>(TLB[i]->getPTW()));
 
 			TLB[i]->getPTW()->setEventChannel(event_link);
-			TLB[i]->setPageTablePointers(&CR3, &PGD, &PUD, &PMD, &PTE, &MAPPED_PAGE_SIZE1GB, &MAPPED_PAGE_SIZE2MB, &MAPPED_PAGE_SIZE4KB, &PENDING_PAGE_FAULTS, &cr3I, &PENDING_PAGE_FAULTS_PGD, &PENDING_PAGE_FAULTS_PUD, &PENDING_PAGE_FAULTS_PMD, &PENDING_PAGE_FAULTS_PTE);//, &PENDING_SHOOTDOWN_EVENTS, &PTR, &PTR_map);
+			TLB[i]->setPageTablePointers(&CR3, &pageTable.PGD, &pageTable.PUD, &pageTable.PMD, &pageTable.PTE, &pageTable.MAPPED_PAGE_SIZE1GB, &pageTable.MAPPED_PAGE_SIZE2MB, &pageTable.MAPPED_PAGE_SIZE4KB, &pageTable.PENDING_PAGE_FAULTS, &cr3I, &pageTable.PENDING_PAGE_FAULTS_PGD, &pageTable.PENDING_PAGE_FAULTS_PUD, &pageTable.PENDING_PAGE_FAULTS_PMD, &pageTable.PENDING_PAGE_FAULTS_PTE);//, &PENDING_SHOOTDOWN_EVENTS, &PTR, &PTR_map);
 
 		}
 
@@ -102,22 +102,22 @@ class TLBhierarchy : public ComponentExtension
     Address_t *CR3;
 
     // Holds the PGD, PUD, PMT, PTE physical pointers
-    std::map<Address_t, Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
-    std::map<Address_t, Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
-    std::map<Address_t, Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
-    std::map<Address_t, Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
+    PageTableEntries * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+    PageTableEntries * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+    PageTableEntries * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+    PageTableEntries * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
                                             // PTE should give you the exact physical address of the page
 
     // The structures below are used to quickly check if the page is mapped or not
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
-
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
+    PageTableFlags * MAPPED_PAGE_SIZE4KB;
+    PageTableFlags * MAPPED_PAGE_SIZE2MB;
+    PageTableFlags * MAPPED_PAGE_SIZE1GB;
+
+    PageTableFlags * PENDING_PAGE_FAULTS;
+    PageTableFlags * PENDING_PAGE_FAULTS_PGD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PUD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PMD;
+    PageTableFlags * PENDING_PAGE_FAULTS_PTE;
     std::map<Address_t,int> *PENDING_SHOOTDOWN_EVENTS;
 
 
@@ -133,19 +133,19 @@ class TLBhierarchy : public ComponentExtension
 
 
     void setPageTablePointers(  Address_t * cr3,
-                                std::map<Address_t, Address_t> * pgd,
-                                std::map<Address_t, Address_t> * pud,
-                                std::map<Address_t, Address_t> * pmd,
-                                std::map<Address_t, Address_t> * pte,
-                                std::map<Address_t,int> * gb,
-                                std::map<Address_t,int> * mb,
-                                std::map<Address_t,int> * kb,
-                                std::map<Address_t,int> * pr,
+                                PageTableEntries * pgd,
+                                PageTableEntries * pud,
+                                PageTableEntries * pmd,
+                                PageTableEntries * pte,
+                                PageTableFlags * gb,
+                                PageTableFlags * mb,
+                                PageTableFlags * kb,
+                                PageTableFlags * pr,
                                 int *cr3I,
-                                std::map<Address_t,int> *pf_pgd,
-                                std::map<Address_t,int> *pf_pud,
-                                std::map<Address_t,int> *pf_pmd,
-                                std::map<Address_t,int> * pf_pte)
+                                PageTableFlags * pf_pgd,
+                                PageTableFlags * pf_pud,
+                                PageTableFlags * pf_pmd,
+                                PageTableFlags * pf_pte)
     {
                     CR3 = cr3;
                     PGD = pgd;
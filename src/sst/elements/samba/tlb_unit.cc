@@ -218,28 +218,18 @@ bool TLB::tick(SST::Cycle_t x)
 
 		// Note that here we are substituting for latency of checking the tag before proceeding
         // to the next level, we also add the upper link latency for the round trip
-		ready_by[ev]= x + latency + 2*upper_link_latency;
-
 		// We also track the size of tthe ready request
-		ready_by_size[ev]= pushed_back_size[ev];
+		ready_by.insert(ev, x + latency + 2*upper_link_latency, pushed_back_size[ev]);
 
 
 		// Check if there are other misses that were going to the same translation and waiting for the response of this miss
-		if((level==1) && (SAME_MISS.find(addr/4096)!=SAME_MISS.end()))
+		auto same_miss = PENDING_MISS.find(addr/4096);
+		if((level==1) && (same_miss != PENDING_MISS.end()))
 		{
-		   auto same_st = SAME_MISS[addr/4096].begin();
-		   auto same_en = SAME_MISS[addr/4096].end();
-		   while(same_st!=same_en)
-		    {
-
-	    		ready_by[same_st->first] = x + latency + 2*upper_link_latency;
-	    		ready_by_size[same_st->first] = pushed_back_size[ev];
-			same_st++;
-		    }
-		  SAME_MISS.erase(addr/4096);
-		 // PENDING_MISS.erase(addr/4096);
+			for(auto same_ev : same_miss->second)
+				ready_by.insert(same_ev, x + latency + 2*upper_link_latency, pushed_back_size[ev]);
+			PENDING_MISS.erase(same_miss);
 		}
-		PENDING_MISS.erase(addr/4096);
 
 		pushed_back_size.erase(ev);
 		pushed_back.pop_back();
@@ -289,13 +279,11 @@ bool TLB::tick(SST::Cycle_t x)
 			update_lru(addr, hit_id);
 			hits++;
 			statTLBHits->addData(1);
+			// Tracking the hit request size
 			if(parallel_mode)
-				ready_by[ev] = x;
+				ready_by.insert(ev, x, page_size[hit_id]/1024);
 			else
-				ready_by[ev] = x + latency;
-
-			// Tracking the hit request size
-			ready_by_size[ev] = page_size[hit_id]/1024;
+				ready_by.insert(ev, x + latency, page_size[hit_id]/1024);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -308,16 +296,17 @@ bool TLB::tick(SST::Cycle_t x)
 
 				// Check if the miss is not currently being handled
 				bool currently_handled=false;
-				if((level==1) && (PENDING_MISS.find(addr/4096) != PENDING_MISS.end()))
+				auto same_miss = PENDING_MISS.find(addr/4096);
+				if((level==1) && (same_miss != PENDING_MISS.end()))
 				{
 
-					SAME_MISS[addr/4096][ev]=1; // Just adding it to the 2D map, so we later hand it back once the master miss is complete
+					same_miss->second.push_back(ev); // Coalescing it into the master miss, so we later hand it back once the master miss is complete
 					currently_handled = true;
 				}
 				else if(level==1)
 				{
 
-					PENDING_MISS[addr/4096]=1;
+					PENDING_MISS[addr/4096].clear(); // This is the master miss, nothing is coalesced into it yet
 
 				}
 
@@ -356,70 +345,52 @@ bool TLB::tick(SST::Cycle_t x)
 	}
 
 
-	auto st = ready_by.begin();
-	auto en = ready_by.end();
+	ready.clear();
+	ready_by.popReady(x, ready);
 
-	// We iterate over the list of being serviced request to see if any has finished by this cycle
-	while(st!=en)
+	// We iterate over the list of requests that have finished by this cycle
+	for(auto &r : ready)
 	{
 
-		bool deleted=false;
-		if(st->second <= x)
-		{
-
-			//	std::cout<<"The request was read at "<<st->second<<" The time now is "<<x<<std::endl;
+		//	std::cout<<"The request was read at "<<r.ready<<" The time now is "<<x<<std::endl;
 
-			Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
+		Address_t addr = ((MemEvent*) r.ev)->getVirtualAddress();
 
 
-			if(SIZE_LOOKUP.find(ready_by_size[st->first])!= SIZE_LOOKUP.end())
+		if(SIZE_LOOKUP.find(r.size)!= SIZE_LOOKUP.end())
+		{
+			// Double checking that we actually still don't have it inserted
+			if(!check_hit(addr, SIZE_LOOKUP[r.size]))
 			{
-				// Double checking that we actually still don't have it inserted
-				if(!check_hit(addr, SIZE_LOOKUP[ready_by_size[st->first]]))
-				{
-					insert_way(addr, find_victim_way(addr, SIZE_LOOKUP[ready_by_size[st->first]]), SIZE_LOOKUP[ready_by_size[st->first]]);
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
-				}
-				else
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
+				insert_way(addr, find_victim_way(addr, SIZE_LOOKUP[r.size]), SIZE_LOOKUP[r.size]);
+				update_lru(addr, SIZE_LOOKUP[r.size]);
 			}
+			else
+				update_lru(addr, SIZE_LOOKUP[r.size]);
+		}
 
 
 
-			service_back->push_back(st->first);
-
-			(*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-
-			ready_by_size.erase(st->first);
+		service_back->push_back(r.ev);
 
-			deleted = true;
+		(*service_back_size)[r.ev]=r.size;
 
 
-			// Deleting it from pending requests
-			std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
-			st2 = pending_misses.begin();
-			en2 = pending_misses.end();
+		// Deleting it from pending requests
+		std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
+		st2 = pending_misses.begin();
+		en2 = pending_misses.end();
 
 
-			while(st2!=en2)
+		while(st2!=en2)
+		{
+			if(*st2 == r.ev)
 			{
-				if(*st2 == st->first)
-				{
-					pending_misses.erase(st2);
-					break;
-				}
-				st2++;
+				pending_misses.erase(st2);
+				break;
 			}
-
-			ready_by.erase(st);
-
+			st2++;
 		}
-		if(deleted)
-			st=ready_by.begin();
-		else
-			st++;
 
 	}
 
@@ -19,6 +19,7 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include "page_table_walker.h"
 #include <map>
+#include <unordered_map>
 #include <vector>
 #include "utils.h"
 
@@ -74,8 +75,9 @@ class TLB : public ComponentExtension
     // === ???
 	std::map<long long int, int> SIZE_LOOKUP; // This structure checks if a size is supported inside the structure, and its index structure
 
-	std::map< Address_t, std::map< MemHierarchy::MemEventBase *, int, MemEventPtrCompare>> SAME_MISS; // This tracks the misses for the same location and deduplicates them
-	std::map<Address_t, int> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
+	// This tracks the pages of the current master misses, along with the other misses to the same page that are coalesced
+	// into the master miss and handed back once it is complete
+	std::unordered_map<Address_t, std::vector<MemHierarchy::MemEventBase *>> PENDING_MISS;
 
 
     //=======================================================================
@@ -95,8 +97,8 @@ class TLB : public ComponentExtension
 	std::vector<MemHierarchy::MemEventBase *> pending_misses;
 
     // === Holds requests that have gotten the data they need, but we need to wait the duration of the latency before returning
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare> ready_by;
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // keeps track of requests' sizes inside this structure
+	ReadyQueue ready_by; // also keeps track of requests' sizes inside this structure
+	std::vector<ReadyQueue::Entry> ready; // requests that are ready this cycle
 
 
     // === Buffers for sending requests up/down TLB hierarchy:
@@ -16,6 +16,10 @@
 #include <sst/core/event.h>
 #include <sst/elements/memHierarchy/memEventBase.h>
 
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
 namespace SST {
 namespace SambaComponent {
 
@@ -29,6 +33,67 @@ namespace SambaComponent {
             }
         }
     };
+
+    // Requests waiting out their latency before they are handed back to the
+    // previous level, along with the page size of their translation.
+    //
+    // Entries live in a dense vector with a hash index on the event, so
+    // marking a request ready is O(1) and a tick looks at each waiting
+    // request once. Requests that are ready are handed out in event ID
+    // order, the order a std::map with MemEventPtrCompare would give.
+    class ReadyQueue {
+    public:
+        struct Entry {
+            MemHierarchy::MemEventBase* ev;
+            SST::Cycle_t ready;
+            long long int size;
+        };
+
+        // Sets when ev is ready and the size of its translation, replacing
+        // any earlier setting for ev
+        void insert(MemHierarchy::MemEventBase* ev, SST::Cycle_t ready, long long int size) {
+            auto slot = index.find(ev);
+            if (slot != index.end()) {
+                entries[slot->second].ready = ready;
+                entries[slot->second].size = size;
+                return;
+            }
+            index[ev] = entries.size();
+            entries.push_back({ev, ready, size});
+        }
+
+        // Removes the requests that are ready by cycle x and appends them to
+        // ready in event ID order
+        void popReady(SST::Cycle_t x, std::vector<Entry>& ready) {
+            size_t first = ready.size();
+            size_t i = 0;
+            while (i < entries.size()) {
+                if (entries[i].ready > x) {
+                    i++;
+                    continue;
+                }
+                ready.push_back(entries[i]);
+                index.erase(entries[i].ev);
+                if (i != entries.size() - 1) {
+                    entries[i] = entries.back();
+                    index[entries[i].ev] = i;
+                }
+                entries.pop_back();
+            }
+            std::sort(ready.begin() + first, ready.end(), [](const Entry& a, const Entry& b) {
+                    if (a.ev->getID().second != b.ev->getID().second)
+                        return a.ev->getID().second < b.ev->getID().second;
+                    return a.ev->getID().first < b.ev->getID().first;
+                    });
+        }
+
+        bool empty() const { return entries.empty(); }
+        size_t size() const { return entries.size(); }
+
+    private:
+        std::vector<Entry> entries;
+        std::unordered_map<MemHierarchy::MemEventBase*, size_t> index;
+    };
 }
 }
 
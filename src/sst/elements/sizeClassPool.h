@@ -0,0 +1,111 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ELEMENTS_SIZE_CLASS_POOL
+#define _H_SST_ELEMENTS_SIZE_CLASS_POOL
+
+#include <sst_element_config.h>
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace SST {
+
+// Thread local free lists for objects that elements create and destroy at
+// a high rate (ember events, vanadis instructions, miranda requests, merlin
+// router events).  A class routes its allocations here with
+//
+//     static void* operator new(size_t size) { return SizeClassPool::allocate(size); }
+//     static void operator delete(void* ptr, size_t size) { SizeClassPool::release(ptr, size); }
+//
+// Blocks are kept in 16 byte size classes up to 512 bytes, larger
+// requests use the global allocator.  A block freed on another thread
+// joins that thread's lists.
+//
+// Configuring with --disable-element-pools makes allocate and release go
+// straight to the global allocator, e.g. for memory checkers.
+class SizeClassPool {
+public:
+#ifdef ENABLE_ELEMENT_POOLS
+    static void* allocate(size_t size) {
+        const size_t sc = sizeClass(size);
+        if ( sc >= num_classes ) return ::operator new(size);
+
+        FreeLists* fl = lists();
+        if ( fl != nullptr && !fl->lists[sc].empty() ) {
+            void* ptr = fl->lists[sc].back();
+            fl->lists[sc].pop_back();
+            return ptr;
+        }
+        return ::operator new((sc + 1) * granularity);
+    }
+
+    static void release(void* ptr, size_t size) {
+        if ( ptr == nullptr ) return;
+        const size_t sc = sizeClass(size);
+        if ( sc < num_classes ) {
+            FreeLists* fl = lists();
+            if ( fl != nullptr && fl->lists[sc].size() < max_free_per_class ) {
+                fl->lists[sc].push_back(ptr);
+                return;
+            }
+        }
+        ::operator delete(ptr);
+    }
+#else
+    static void* allocate(size_t size) { return ::operator new(size); }
+    static void release(void* ptr, size_t) { ::operator delete(ptr); }
+#endif
+
+private:
+#ifdef ENABLE_ELEMENT_POOLS
+    static constexpr size_t granularity = 16;
+    static constexpr size_t num_classes = 32;
+    // Only keeps a burst of frees from holding on to memory forever
+    static constexpr size_t max_free_per_class = 64 * 1024;
+
+    struct FreeLists {
+        std::vector<void*> lists[num_classes];
+
+        ~FreeLists() {
+            for ( auto& list : lists ) {
+                for ( void* ptr : list ) ::operator delete(ptr);
+                list.clear();
+            }
+            destroyed() = true;
+        }
+    };
+
+    static size_t sizeClass(size_t size) { return size == 0 ? 0 : (size - 1) / granularity; }
+
+    // Objects can still be deleted while the thread is torn down after
+    // the lists are gone, these go back to the global allocator
+    static bool& destroyed() {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    static FreeLists* lists() {
+        if ( destroyed() ) return nullptr;
+        static thread_local FreeLists fl;
+        return &fl;
+    }
+#endif
+};
+
+} // namespace SST
+
+#endif
@@ -18,6 +18,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <bitset>
 
@@ -28,7 +29,7 @@ template <typename T>
 class VanadisCircularQueue
 {
 public:
-    VanadisCircularQueue(const int size) : max_capacity(size) {
+    VanadisCircularQueue(const int size) : max_capacity(size), count(0), head_sequence(0) {
         data = new T[size];
         clear();
 
@@ -71,6 +72,7 @@ public:
         T pop_me = data[head];
         head = incrementIndex(head);
         count--;
+        head_sequence++;
 
         return pop_me;
     }
@@ -78,7 +80,12 @@ public:
     size_t size() const { return count; }
     size_t capacity() const { return max_capacity; }
 
+    // Sequence number of the entry at the front, every item pushed gets the
+    // next number and entries which are cleared are counted as popped
+    uint64_t headSequence() const { return head_sequence; }
+
     void clear() {
+        head_sequence += count;
         head = 0;
         tail = 0;
         count = 0;
@@ -97,6 +104,7 @@ private:
     int head;
     int tail;
     int count;
+    uint64_t head_sequence;
 
     T* data;
 
@@ -16,10 +16,11 @@
 #ifndef _H_VANADIS_CACHE
 #define _H_VANADIS_CACHE
 
+#include <cstddef>
 #include <cstdint>
-#include <list>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace SST {
 namespace Vanadis {
@@ -30,116 +31,162 @@ enum class VanadisCacheRecordDeletion {
     VANADIS_PERFORM_DELETE_ARRAY
 };
 
+// LRU cache with O(1) find/store/touch. Entries live in a slab of nodes
+// which is allocated once at construction and linked into a doubly linked
+// recency list by index, the map only holds the index of the node for a key.
 template <typename I, typename T, SST::Vanadis::VanadisCacheRecordDeletion D> class VanadisCache {
 public:
-    VanadisCache(const size_t cache_entries) : max_entries(cache_entries) { reset(); }
+    VanadisCache(const size_t cache_entries) : max_entries(cache_entries) {
+        // a zero sized cache still has to hold the entry which was just stored
+        nodes.resize(max_entries > 0 ? max_entries : 1);
+        reset();
+    }
 
     ~VanadisCache() {
         clear();
     }
 
     void clear() {
-        for (auto val_itr = data_values.begin(); val_itr != data_values.end(); val_itr++ ) {
-            switch(D) {
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE:
-                {
-                    delete val_itr->second;
-                } break;
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY:
-                {
-                    delete[] val_itr->second;
-                } break;
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_NO_DELETION:
-                {} break;
-            }
+        for (auto val_itr = node_index.begin(); val_itr != node_index.end(); val_itr++ ) {
+            delete_value(nodes[val_itr->second].value);
         }
 
-        ordering_q.clear();
-        data_values.clear();
+        node_index.clear();
+
+        head = NO_NODE;
+        tail = NO_NODE;
+        free_head = NO_NODE;
+
+        for (uint32_t i = 0; i < nodes.size(); ++i) {
+            nodes[i].next = free_head;
+            free_head = i;
+        }
     }
 
     void reset() {
         clear();
-        data_values.reserve(max_entries);
+        node_index.reserve(nodes.size());
     }
 
-    bool contains(const I& value) const { return (data_values.find(value) != data_values.end()); }
+    bool contains(const I& value) const { return (node_index.find(value) != node_index.end()); }
 
     T find(const I& key) {
-        send_key_to_front(key);
-        return data_values.find(key)->second;
+        const uint32_t index = node_index.find(key)->second;
+        send_node_to_front(index);
+        return nodes[index].value;
     }
 
     void store(const I& key, T value) {
-        if (LIKELY(contains(key))) {
-            send_key_to_front(key);
-	        data_values[key] = value;
+        auto find_key = node_index.find(key);
+
+        if (LIKELY(find_key != node_index.end())) {
+            send_node_to_front(find_key->second);
+            nodes[find_key->second].value = value;
         } else {
-            kill_lru_key();
-            data_values.insert(std::pair<I, T>(key, value));
-            ordering_q.push_front(key);
+            const uint32_t index = allocate_node();
+            nodes[index].key = key;
+            nodes[index].value = value;
+            push_front(index);
+            node_index.emplace(key, index);
         }
     }
 
     void touch(const I& key) {
-        if (LIKELY(contains(key))) {
-            send_key_to_front(key);
+        auto find_key = node_index.find(key);
+
+        if (LIKELY(find_key != node_index.end())) {
+            send_node_to_front(find_key->second);
         }
     }
 
-    size_t size() const { return data_values.size(); }
+    size_t size() const { return node_index.size(); }
     size_t capacity() const { return max_entries; }
 
 private:
-    void kill_lru_key() {
-        // if we aren't full yet, then keep entries otherwise we will
-        // throw away
-        if (UNLIKELY(ordering_q.size() < max_entries)) {
-            return;
-        }
+    static constexpr uint32_t NO_NODE = UINT32_MAX;
 
-        const I remove_key = ordering_q.back();
-        ordering_q.pop_back();
-
-        auto find_key = data_values.find(remove_key);
+    struct Node {
+        I key;
+        T value;
+        uint32_t prev;
+        uint32_t next;
+    };
 
+    void delete_value(T value) {
         switch(D) {
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE:
             {
-                delete find_key->second;
+                delete value;
             } break;
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY:
             {
-                delete[] find_key->second;
+                delete[] value;
             } break;
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_NO_DELETION:
             {} break;
         }
+    }
+
+    // take a node from the free list, if we are full then the least
+    // recently used entry is thrown away and its node reused
+    uint32_t allocate_node() {
+        if (LIKELY(free_head != NO_NODE)) {
+            const uint32_t index = free_head;
+            free_head = nodes[index].next;
+            return index;
+        }
+
+        const uint32_t index = tail;
+        unlink(index);
+
+        node_index.erase(nodes[index].key);
+        delete_value(nodes[index].value);
 
-        data_values.erase(find_key);
+        return index;
     }
 
-    void send_key_to_front(const I& key) {
-        bool found_key = false;
-
-        for (auto order_itr = ordering_q.begin(); order_itr != ordering_q.end();) {
-            if (UNLIKELY(key == (*order_itr))) {
-                ordering_q.erase(order_itr);
-                found_key = true;
-                break;
-            } else {
-                order_itr++;
-            }
+    void unlink(const uint32_t index) {
+        Node& node = nodes[index];
+
+        if (node.prev != NO_NODE) {
+            nodes[node.prev].next = node.next;
+        } else {
+            head = node.next;
+        }
+
+        if (node.next != NO_NODE) {
+            nodes[node.next].prev = node.prev;
+        } else {
+            tail = node.prev;
+        }
+    }
+
+    void push_front(const uint32_t index) {
+        nodes[index].prev = NO_NODE;
+        nodes[index].next = head;
+
+        if (head != NO_NODE) {
+            nodes[head].prev = index;
+        } else {
+            tail = index;
         }
 
-        if (LIKELY(found_key)) {
-            ordering_q.push_front(key);
+        head = index;
+    }
+
+    void send_node_to_front(const uint32_t index) {
+        if (LIKELY(index != head)) {
+            unlink(index);
+            push_front(index);
         }
     }
 
     const size_t max_entries;
-    std::list<I> ordering_q;
-    std::unordered_map<I, T> data_values;
+    std::vector<Node> nodes;
+    std::unordered_map<I, uint32_t> node_index;
+    uint32_t head;
+    uint32_t tail;
+    uint32_t free_head;
 };
 
 } // namespace Vanadis
@@ -0,0 +1,316 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_ISSUE_QUEUE
+#define _H_VANADIS_ISSUE_QUEUE
+
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "datastruct/cqueue.h"
+#include "inst/vinst.h"
+
+namespace SST {
+namespace Vanadis {
+
+// Wakeup/select view of a thread's ROB for the issue stage.
+//
+// The issue scan in VanadisCore refuses an instruction when an older ROB
+// entry writes one of its registers, when an older entry which had not
+// issued at the start of the cycle reads one of its outputs, or (for
+// memory operations) when an older load/store/fence has not issued. Each
+// of those blockers is an older instruction, so instead of re-checking
+// every waiting instruction every cycle, an instruction is parked on a
+// wakeup list of one of its blockers and only looked at again when that
+// blocker retires (writers) or issues (readers at the end of the cycle,
+// memory operations immediately). Instructions without a blocker are kept
+// in a ready set in ROB order, these are the only ones the issue stage
+// has to check against the register file and functional units.
+//
+// The ready set is exactly the set of instructions that would pass the
+// dependency part of the ROB scan, so which instructions issue (and in
+// which order) does not change.
+//
+// ROB entries are identified by their sequence number in the ROB (see
+// VanadisCircularQueue::headSequence()), the queue picks up new entries
+// and notices retired or squashed ones when sync() is called at the start
+// of the issue stage.
+class VanadisIssueQueue {
+public:
+    VanadisIssueQueue(const uint16_t int_reg_count, const uint16_t fp_reg_count) :
+        int_writers_(int_reg_count), int_readers_(int_reg_count),
+        fp_writers_(fp_reg_count), fp_readers_(fp_reg_count), base_seq_(0) {}
+
+    // Bring the queue up to date with the ROB, must be called at the start
+    // of the issue stage before any of the other calls
+    void sync(VanadisCircularQueue<VanadisInstruction*>* rob) {
+        const uint64_t head = rob->headSequence();
+
+        if ( head >= base_seq_ + entries_.size() ) {
+            // everything has retired or the ROB has been squashed
+            clear();
+            base_seq_ = head;
+        } else {
+            // retired entries, anything waiting for them to leave the ROB
+            // can be looked at again
+            while ( base_seq_ < head ) {
+                entries_.pop_front();
+                base_seq_++;
+                wake(retire_waiters_, base_seq_ - 1);
+            }
+        }
+
+        ready_.erase(ready_.begin(), ready_.lower_bound(head));
+
+        // entries the decoder has added since the last sync
+        for ( size_t i = entries_.size(); i < rob->size(); ++i ) {
+            VanadisInstruction* ins = rob->peekAt(i);
+            const uint64_t seq = base_seq_ + i;
+
+            entries_.push_back(Entry(ins));
+
+            for ( uint16_t k = 0; k < ins->countISAIntRegOut(); ++k ) {
+                listFor(int_writers_, ins->getISAIntRegOut(k)).push_back(seq);
+            }
+            for ( uint16_t k = 0; k < ins->countISAFPRegOut(); ++k ) {
+                listFor(fp_writers_, ins->getISAFPRegOut(k)).push_back(seq);
+            }
+            for ( uint16_t k = 0; k < ins->countISAIntRegIn(); ++k ) {
+                listFor(int_readers_, ins->getISAIntRegIn(k)).push_back(seq);
+            }
+            for ( uint16_t k = 0; k < ins->countISAFPRegIn(); ++k ) {
+                listFor(fp_readers_, ins->getISAFPRegIn(k)).push_back(seq);
+            }
+            if ( isOrderedMemory(ins) ) {
+                memory_ops_.push_back(seq);
+            }
+
+            evaluate(seq);
+        }
+    }
+
+    // Finds the oldest ready instruction with sequence number >= seq,
+    // returns false if there isn't one
+    bool nextReady(uint64_t& seq) const {
+        auto next = ready_.lower_bound(seq);
+
+        if ( next == ready_.end() ) {
+            return false;
+        }
+
+        seq = *next;
+        return true;
+    }
+
+    VanadisInstruction* getInstruction(const uint64_t seq) { return entries_[seq - base_seq_].ins; }
+
+    // The instruction has been issued
+    void markIssued(const uint64_t seq) {
+        entries_[seq - base_seq_].issued = true;
+        ready_.erase(seq);
+        issued_this_cycle_.push_back(seq);
+
+        // younger memory operations only wait for this to issue
+        wake(issue_waiters_, seq);
+    }
+
+    // Must be called at the end of the issue stage, instructions issued
+    // this cycle stop blocking writes to the registers they read
+    void endCycle() {
+        for ( const uint64_t seq : issued_this_cycle_ ) {
+            if ( seq >= base_seq_ ) {
+                entries_[seq - base_seq_].reads_released = true;
+                wake(release_waiters_, seq);
+            }
+        }
+
+        issued_this_cycle_.clear();
+    }
+
+    size_t countReady() const { return ready_.size(); }
+
+private:
+    static constexpr uint64_t NO_BLOCKER = UINT64_MAX;
+
+    struct Entry {
+        Entry(VanadisInstruction* i) : ins(i), issued(false), reads_released(false) {}
+
+        VanadisInstruction* ins;
+        bool issued;
+        bool reads_released;
+    };
+
+    typedef std::unordered_map<uint64_t, std::vector<uint64_t>> WaiterMap;
+
+    static bool isOrderedMemory(VanadisInstruction* ins) {
+        const auto ins_type = ins->getInstFuncType();
+        return ins_type == INST_LOAD || ins_type == INST_STORE || ins_type == INST_FENCE;
+    }
+
+    // operations which are held back by an older unissued load/store/fence
+    static bool waitsForMemory(VanadisInstruction* ins) {
+        const auto ins_type = ins->getInstFuncType();
+        return isOrderedMemory(ins) || ins_type == INST_ROCC0 || ins_type == INST_ROCC1 ||
+               ins_type == INST_ROCC2 || ins_type == INST_ROCC3;
+    }
+
+    static std::deque<uint64_t>& listFor(std::vector<std::deque<uint64_t>>& lists, const uint16_t reg) {
+        if ( reg >= lists.size() ) {
+            lists.resize(reg + 1);
+        }
+        return lists[reg];
+    }
+
+    // oldest writer of reg still in the ROB
+    uint64_t oldestWriter(std::vector<std::deque<uint64_t>>& writers, const uint16_t reg) {
+        std::deque<uint64_t>& list = listFor(writers, reg);
+
+        while ( ! list.empty() && list.front() < base_seq_ ) {
+            list.pop_front();
+        }
+
+        return list.empty() ? NO_BLOCKER : list.front();
+    }
+
+    // oldest reader of reg which had not issued at the start of the cycle
+    uint64_t oldestReader(std::vector<std::deque<uint64_t>>& readers, const uint16_t reg) {
+        std::deque<uint64_t>& list = listFor(readers, reg);
+
+        while ( ! list.empty() && (list.front() < base_seq_ || entries_[list.front() - base_seq_].reads_released) ) {
+            list.pop_front();
+        }
+
+        return list.empty() ? NO_BLOCKER : list.front();
+    }
+
+    uint64_t oldestMemoryOp() {
+        while ( ! memory_ops_.empty() &&
+                (memory_ops_.front() < base_seq_ || entries_[memory_ops_.front() - base_seq_].issued) ) {
+            memory_ops_.pop_front();
+        }
+
+        return memory_ops_.empty() ? NO_BLOCKER : memory_ops_.front();
+    }
+
+    // Either parks the instruction on the wakeup list of an older
+    // instruction which blocks it, or puts it in the ready set
+    void evaluate(const uint64_t seq) {
+        VanadisInstruction* ins = entries_[seq - base_seq_].ins;
+        uint64_t blocker;
+
+        for ( uint16_t k = 0; k < ins->countISAIntRegIn(); ++k ) {
+            if ( (blocker = oldestWriter(int_writers_, ins->getISAIntRegIn(k))) < seq ) {
+                retire_waiters_[blocker].push_back(seq);
+                return;
+            }
+        }
+
+        for ( uint16_t k = 0; k < ins->countISAFPRegIn(); ++k ) {
+            if ( (blocker = oldestWriter(fp_writers_, ins->getISAFPRegIn(k))) < seq ) {
+                retire_waiters_[blocker].push_back(seq);
+                return;
+            }
+        }
+
+        for ( uint16_t k = 0; k < ins->countISAIntRegOut(); ++k ) {
+            if ( (blocker = oldestWriter(int_writers_, ins->getISAIntRegOut(k))) < seq ) {
+                retire_waiters_[blocker].push_back(seq);
+                return;
+            }
+            if ( (blocker = oldestReader(int_readers_, ins->getISAIntRegOut(k))) < seq ) {
+                release_waiters_[blocker].push_back(seq);
+                return;
+            }
+        }
+
+        for ( uint16_t k = 0; k < ins->countISAFPRegOut(); ++k ) {
+            if ( (blocker = oldestWriter(fp_writers_, ins->getISAFPRegOut(k))) < seq ) {
+                retire_waiters_[blocker].push_back(seq);
+                return;
+            }
+            if ( (blocker = oldestReader(fp_readers_, ins->getISAFPRegOut(k))) < seq ) {
+                release_waiters_[blocker].push_back(seq);
+                return;
+            }
+        }
+
+        if ( waitsForMemory(ins) && (blocker = oldestMemoryOp()) < seq ) {
+            issue_waiters_[blocker].push_back(seq);
+            return;
+        }
+
+        ready_.insert(seq);
+    }
+
+    void wake(WaiterMap& waiters, const uint64_t blocker) {
+        auto waiting = waiters.find(blocker);
+
+        if ( waiting == waiters.end() ) {
+            return;
+        }
+
+        std::vector<uint64_t> woken;
+        woken.swap(waiting->second);
+        waiters.erase(waiting);
+
+        for ( const uint64_t seq : woken ) {
+            if ( seq >= base_seq_ ) {
+                evaluate(seq);
+            }
+        }
+    }
+
+    void clear() {
+        entries_.clear();
+        ready_.clear();
+        memory_ops_.clear();
+        issued_this_cycle_.clear();
+
+        for ( auto& list : int_writers_ ) list.clear();
+        for ( auto& list : int_readers_ ) list.clear();
+        for ( auto& list : fp_writers_ ) list.clear();
+        for ( auto& list : fp_readers_ ) list.clear();
+
+        retire_waiters_.clear();
+        release_waiters_.clear();
+        issue_waiters_.clear();
+    }
+
+    std::deque<Entry> entries_;
+    std::set<uint64_t> ready_;
+
+    // per ISA register, ROB sequence numbers of the writers and readers in
+    // ROB order, entries which no longer block are dropped lazily
+    std::vector<std::deque<uint64_t>> int_writers_;
+    std::vector<std::deque<uint64_t>> int_readers_;
+    std::vector<std::deque<uint64_t>> fp_writers_;
+    std::vector<std::deque<uint64_t>> fp_readers_;
+    std::deque<uint64_t> memory_ops_;
+
+    WaiterMap retire_waiters_;
+    WaiterMap release_waiters_;
+    WaiterMap issue_waiters_;
+
+    std::vector<uint64_t> issued_this_cycle_;
+    uint64_t base_seq_;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -37,6 +37,7 @@
 
 #define VANADIS_DECODER_ELI_STATISTICS                                                                \
     { "uop_cache_hit", "Count number of times the instruction micro-op cache is hit", "hits", 1 },    \
+        { "basic_block_hit", "Count number of basic blocks fetched from the basic block cache", "hits", 1 }, \
         { "predecode_cache_hit",                                                                      \
           "Count number of times the predecode cache is hit when decoding an "                        \
           "instruction",                                                                              \
@@ -80,7 +81,11 @@ public:
                               "Number of cache lines to store in the local L0 cache for instructions "
                               "pending decoding.", "4" },
                             { "loader_mode",
-                              "Operation of the loader, 0 = LRU (more accurate), 1 = INFINITE cache (faster simulation)", "0"})
+                              "Operation of the loader, 0 = LRU (more accurate), 1 = INFINITE cache (faster simulation)", "0"},
+                            { "basic_block_cache_entries",
+                              "Number of pre-decoded basic blocks to cache. When non-zero a whole basic block (up to "
+                              "the first branch) is fetched into the ROB in a single decode step, 0 = disabled. "
+                              "Currently used by the RISCV64 decoder only.", "0" })
 
     SST_ELI_DOCUMENT_STATISTICS(
 				VANADIS_DECODER_ELI_STATISTICS
@@ -98,8 +103,10 @@ public:
 
         const size_t uop_cache_size          = params.find<size_t>("uop_cache_entries", 128);
         const size_t predecode_cache_entries = params.find<size_t>("predecode_cache_entries", 4);
+        const size_t block_cache_entries     = params.find<size_t>("basic_block_cache_entries", 0);
 
-        ins_loader = new VanadisInstructionLoader(uop_cache_size, predecode_cache_entries, icache_line_width, output);
+        ins_loader = new VanadisInstructionLoader(uop_cache_size, predecode_cache_entries, icache_line_width, output,
+                                                  block_cache_entries);
 
         const uint32_t loader_mode = params.find<uint32_t>("loader_mode", 0);
         switch(loader_mode) {
@@ -135,6 +142,7 @@ public:
         output_ = output;
 
         stat_uop_hit          = registerStatistic<uint64_t>("uop_cache_hit", "1");
+        stat_block_hit        = registerStatistic<uint64_t>("basic_block_hit", "1");
         stat_predecode_hit    = registerStatistic<uint64_t>("predecode_cache_hit", "1");
         stat_predecode_miss   = registerStatistic<uint64_t>("predecode_cache_miss", "1");
         stat_uop_generated    = registerStatistic<uint64_t>("uops_generated", "1");
@@ -273,6 +281,7 @@ protected:
     SST::Output* output_;
 
     Statistic<uint64_t>* stat_uop_hit;
+    Statistic<uint64_t>* stat_block_hit;
     Statistic<uint64_t>* stat_uop_delayed_rob_full;
     Statistic<uint64_t>* stat_predecode_hit;
     Statistic<uint64_t>* stat_predecode_miss;
@@ -156,7 +156,35 @@ public:
 
         bool success = false;
         if ( ! thread_rob->full() ) {
-            if ( ins_loader->hasBundleAt(ip) ) {
+            VanadisBasicBlock* block = ins_loader->hasBasicBlockCache() ? ins_loader->getBasicBlockAt(ip) : nullptr;
+
+            if ( block != nullptr ) {
+                // Fetch the whole basic block in one step, as many bundles of
+                // it as fit in the ROB are pushed, the next decode picks up
+                // from wherever ip ends up
+                stat_block_hit->addData(1);
+
+                for ( uint32_t b = 0; b < block->getBundleCount(); ++b ) {
+                    VanadisInstructionBundle* bundle = block->getBundleByIndex(b);
+
+                    if ( bundle->getInstructionCount() >= (thread_rob->capacity() - thread_rob->size()) ) {
+                        break;
+                    }
+
+                    stat_uop_hit->addData(1);
+                    pushBundleToROB(bundle);
+                    success = true;
+                }
+
+                if ( ! success ) {
+                    #ifdef VANADIS_BUILD_DEBUG
+                    output_->verbose(
+                        CALL_INFO, 16, 0, "----> Not enough space in the ROB, will stall this cycle.\n");
+                    #endif
+                    stat_uop_delayed_rob_full->addData(1);
+                }
+            }
+            else if ( ins_loader->hasBundleAt(ip) ) {
                 // We have the instruction in our micro-op cache
                 stat_uop_hit->addData(1);
 
@@ -174,69 +202,7 @@ public:
                 // Do we have enough space in the ROB to push the micro-op bundle into
                 // the queue?
                 if ( bundle->getInstructionCount() < (thread_rob->capacity() - thread_rob->size()) ) {
-                    bool bundle_has_branch = false;
-
-                    for ( uint32_t i = 0; i < bundle->getInstructionCount(); ++i ) {
-                        VanadisInstruction* next_ins = bundle->getInstructionByIndex(i);
-
-                        if ( next_ins->getInstFuncType() == INST_BRANCH ) {
-                            VanadisSpeculatedInstruction* next_spec_ins =
-                                dynamic_cast<VanadisSpeculatedInstruction*>(next_ins);
-
-                            if ( branch_predictor->contains(ip) ) {
-                                // We have an address predicton from the branching unit
-                                const uint64_t predicted_address = branch_predictor->predictAddress(ip);
-                                next_spec_ins->setSpeculatedAddress(predicted_address);
-
-                                    #ifdef VANADIS_BUILD_DEBUG
-                                    if(output_->getVerboseLevel() >= 16) {
-                                        output_->verbose(
-                                            CALL_INFO, 16, 0,
-                                            "----> contains a branch: 0x%" PRI_ADDR " / predicted "
-                                            "(found in predictor): 0x%" PRI_ADDR "\n",
-                                            ip, predicted_address);
-                                    }
-                                    #endif
-
-                                    ip                = predicted_address;
-                                    bundle_has_branch = true;
-                            }
-                            else {
-                                // We don't have an address prediction
-                                // so just speculate that we are going to drop through to the
-                                // next instruction as we aren't sure where this will go yet
-
-                                #ifdef VANADIS_BUILD_DEBUG
-                                if(output_->getVerboseLevel() >= 16) {
-                                    output_->verbose(
-                                        CALL_INFO, 16, 0,
-                                        "----> contains a branch: 0x%" PRI_ADDR " / predicted "
-                                        "(not-found in predictor): 0x%" PRI_ADDR ", pc-increment: %" PRIu64 "\n",
-                                        ip, ip + 4, bundle->pcIncrement());
-                                }
-                                #endif
-
-                                ip += bundle->pcIncrement();
-                                next_spec_ins->setSpeculatedAddress(ip);
-                                bundle_has_branch = true;
-                            }
-                        }
-
-                        thread_rob->push(next_ins->clone());
-                    }
-
-                    // Move to the next address, if we had a branch we should have
-                    // already found a predicted target addeess to decode
-                    #ifdef VANADIS_BUILD_DEBUG
-                    if(output_->getVerboseLevel() >= 16) {
-                        output_->verbose(
-                            CALL_INFO, 16,0, "----> branch? %s, ip=0x%" PRI_ADDR " + inc=%" PRIu64 " = new-ip=0x%" PRI_ADDR "\n",
-                            bundle_has_branch ? "yes" : "no", ip, bundle_has_branch ? 0 : bundle->pcIncrement(),
-                            bundle_has_branch ? ip : ip + bundle->pcIncrement());
-                    }
-                    #endif
-
-                    ip = bundle_has_branch ? ip : ip + bundle->pcIncrement();
+                    pushBundleToROB(bundle);
                     success = true;
                 }
                 else {
@@ -333,6 +299,75 @@ protected:
     const VanadisDecoderOptions* options;
     bool                         fatal_decode_fault;
 
+    // Clones the micro-ops of the bundle into the ROB and moves ip on, to
+    // the predicted target if the bundle contains a branch
+    void pushBundleToROB(VanadisInstructionBundle* bundle)
+    {
+        bool bundle_has_branch = false;
+
+        for ( uint32_t i = 0; i < bundle->getInstructionCount(); ++i ) {
+            VanadisInstruction* next_ins = bundle->getInstructionByIndex(i);
+
+            if ( next_ins->getInstFuncType() == INST_BRANCH ) {
+                VanadisSpeculatedInstruction* next_spec_ins =
+                    dynamic_cast<VanadisSpeculatedInstruction*>(next_ins);
+
+                if ( branch_predictor->contains(ip) ) {
+                    // We have an address predicton from the branching unit
+                    const uint64_t predicted_address = branch_predictor->predictAddress(ip);
+                    next_spec_ins->setSpeculatedAddress(predicted_address);
+
+                        #ifdef VANADIS_BUILD_DEBUG
+                        if(output_->getVerboseLevel() >= 16) {
+                            output_->verbose(
+                                CALL_INFO, 16, 0,
+                                "----> contains a branch: 0x%" PRI_ADDR " / predicted "
+                                "(found in predictor): 0x%" PRI_ADDR "\n",
+                                ip, predicted_address);
+                        }
+                        #endif
+
+                        ip                = predicted_address;
+                        bundle_has_branch = true;
+                }
+                else {
+                    // We don't have an address prediction
+                    // so just speculate that we are going to drop through to the
+                    // next instruction as we aren't sure where this will go yet
+
+                    #ifdef VANADIS_BUILD_DEBUG
+                    if(output_->getVerboseLevel() >= 16) {
+                        output_->verbose(
+                            CALL_INFO, 16, 0,
+                            "----> contains a branch: 0x%" PRI_ADDR " / predicted "
+                            "(not-found in predictor): 0x%" PRI_ADDR ", pc-increment: %" PRIu64 "\n",
+                            ip, ip + 4, bundle->pcIncrement());
+                    }
+                    #endif
+
+                    ip += bundle->pcIncrement();
+                    next_spec_ins->setSpeculatedAddress(ip);
+                    bundle_has_branch = true;
+                }
+            }
+
+            thread_rob->push(next_ins->clone());
+        }
+
+        // Move to the next address, if we had a branch we should have
+        // already found a predicted target addeess to decode
+        #ifdef VANADIS_BUILD_DEBUG
+        if(output_->getVerboseLevel() >= 16) {
+            output_->verbose(
+                CALL_INFO, 16,0, "----> branch? %s, ip=0x%" PRI_ADDR " + inc=%" PRIu64 " = new-ip=0x%" PRI_ADDR "\n",
+                bundle_has_branch ? "yes" : "no", ip, bundle_has_branch ? 0 : bundle->pcIncrement(),
+                bundle_has_branch ? ip : ip + bundle->pcIncrement());
+        }
+        #endif
+
+        ip = bundle_has_branch ? ip : ip + bundle->pcIncrement();
+    }
+
     void decode(const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle)
     {
         #ifdef VANADIS_BUILD_DEBUG
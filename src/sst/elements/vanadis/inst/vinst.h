@@ -19,6 +19,7 @@
 #include "decoder/visaopts.h"
 #include "inst/regfile.h"
 #include "inst/regstack.h"
+#include "sst/elements/sizeClassPool.h"
 #include "inst/vinsttype.h"
 #include "inst/vregfmt.h"
 
@@ -51,29 +52,7 @@ class VanadisInstruction
             count_isa_fp_reg_in(c_isa_fp_reg_in),
             count_isa_fp_reg_out(c_isa_fp_reg_out)
         {
-            phys_int_regs_in = (count_phys_int_reg_in > 0) ? new uint16_t[count_phys_int_reg_in] : nullptr;
-            std::memset(phys_int_regs_in, 0, count_phys_int_reg_in * sizeof( uint16_t ));
-
-            phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[count_phys_int_reg_out] : nullptr;
-            std::memset(phys_int_regs_out, 0, count_phys_int_reg_out * sizeof( uint16_t ) );
-
-            isa_int_regs_in = (count_isa_int_reg_in > 0) ? new uint16_t[count_isa_int_reg_in] : nullptr;
-            std::memset(isa_int_regs_in, 0, count_isa_int_reg_in * sizeof( uint16_t ));
-
-            isa_int_regs_out = (count_isa_int_reg_out > 0) ? new uint16_t[count_isa_int_reg_out] : nullptr;
-            std::memset(isa_int_regs_out, 0, count_isa_int_reg_out * sizeof( uint16_t ) );
-
-            phys_fp_regs_in = (count_phys_fp_reg_in > 0) ? new uint16_t[count_phys_fp_reg_in] : nullptr;
-            std::memset(phys_fp_regs_in, 0, count_phys_fp_reg_in * sizeof( uint16_t ));
-
-            phys_fp_regs_out = (count_phys_fp_reg_out > 0) ? new uint16_t[count_phys_fp_reg_out] : nullptr;
-            std::memset(phys_fp_regs_out, 0, count_phys_fp_reg_out * sizeof( uint16_t ));
-
-            isa_fp_regs_in = (count_isa_fp_reg_in > 0) ? new uint16_t[count_isa_fp_reg_in] : nullptr;
-            std::memset(isa_fp_regs_in, 0, count_isa_fp_reg_in * sizeof( uint16_t ) );
-
-            isa_fp_regs_out = (count_isa_fp_reg_out > 0) ? new uint16_t[count_isa_fp_reg_out] : nullptr;
-            std::memset(isa_fp_regs_out, 0, count_isa_fp_reg_out * sizeof( uint16_t ));
+            allocateRegisters();
 
             trap_error_           = false;
             has_executed_         = false;
@@ -86,16 +65,14 @@ class VanadisInstruction
 
         virtual ~VanadisInstruction()
         {
-            if ( phys_int_regs_in != nullptr ) delete[] phys_int_regs_in;
-            if ( phys_int_regs_out != nullptr ) delete[] phys_int_regs_out;
-            if ( isa_int_regs_in != nullptr ) delete[] isa_int_regs_in;
-            if ( isa_int_regs_out != nullptr ) delete[] isa_int_regs_out;
-            if ( phys_fp_regs_in != nullptr ) delete[] phys_fp_regs_in;
-            if ( phys_fp_regs_out != nullptr ) delete[] phys_fp_regs_out;
-            if ( isa_fp_regs_in != nullptr ) delete[] isa_fp_regs_in;
-            if ( isa_fp_regs_out != nullptr ) delete[] isa_fp_regs_out;
+            releaseRegisters();
         }
 
+        // Instructions are recycled through the SizeClassPool, the
+        // virtual destructor means size is that of the derived type
+        static void* operator new(std::size_t size) { return SizeClassPool::allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) { SizeClassPool::release(ptr, size); }
+
         VanadisInstruction(const VanadisInstruction& copy_me) :
             ins_address(copy_me.ins_address),
             hw_thread(copy_me.hw_thread),
@@ -117,48 +94,10 @@ class VanadisInstruction
             has_rob_slot_         = false;
             sw_thread             = copy_me.sw_thread;
 
-            phys_int_regs_in  = (count_phys_int_reg_in > 0) ? new uint16_t[count_phys_int_reg_in] : nullptr;
-            phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[count_phys_int_reg_out] : nullptr;
-
-            isa_int_regs_in  = (count_isa_int_reg_in > 0) ? new uint16_t[count_isa_int_reg_in] : nullptr;
-            isa_int_regs_out = (count_isa_int_reg_out > 0) ? new uint16_t[count_isa_int_reg_out] : nullptr;
-
-            phys_fp_regs_in  = (count_phys_fp_reg_in > 0) ? new uint16_t[count_phys_fp_reg_in] : nullptr;
-            phys_fp_regs_out = (count_phys_fp_reg_out > 0) ? new uint16_t[count_phys_fp_reg_out] : nullptr;
+            allocateRegisters();
 
-            isa_fp_regs_in  = (count_isa_fp_reg_in > 0) ? new uint16_t[count_isa_fp_reg_in] : nullptr;
-            isa_fp_regs_out = (count_isa_fp_reg_out > 0) ? new uint16_t[count_isa_fp_reg_out] : nullptr;
-
-            for ( uint16_t i = 0; i < count_phys_int_reg_in; ++i ) {
-                phys_int_regs_in[i] = copy_me.phys_int_regs_in[i];
-            }
-
-            for ( uint16_t i = 0; i < count_phys_int_reg_out; ++i ) {
-                phys_int_regs_out[i] = copy_me.phys_int_regs_out[i];
-            }
-
-            for ( uint16_t i = 0; i < count_isa_int_reg_in; ++i ) {
-                isa_int_regs_in[i] = copy_me.isa_int_regs_in[i];
-            }
-
-            for ( uint16_t i = 0; i < count_isa_int_reg_out; ++i ) {
-                isa_int_regs_out[i] = copy_me.isa_int_regs_out[i];
-            }
-
-            for ( uint16_t i = 0; i < count_phys_fp_reg_in; ++i ) {
-                phys_fp_regs_in[i] = copy_me.phys_fp_regs_in[i];
-            }
-
-            for ( uint16_t i = 0; i < count_phys_fp_reg_out; ++i ) {
-                phys_fp_regs_out[i] = copy_me.phys_fp_regs_out[i];
-            }
-
-            for ( uint16_t i = 0; i < count_isa_fp_reg_in; ++i ) {
-                isa_fp_regs_in[i] = copy_me.isa_fp_regs_in[i];
-            }
-
-            for ( uint16_t i = 0; i < count_isa_fp_reg_out; ++i ) {
-                isa_fp_regs_out[i] = copy_me.isa_fp_regs_out[i];
+            if ( reg_storage_ != nullptr ) {
+                std::memcpy(reg_storage_, copy_me.reg_storage_, countRegisters() * sizeof(uint16_t));
             }
         }
 
@@ -445,6 +384,53 @@ class VanadisInstruction
 
     protected:
 
+        uint32_t countRegisters() const
+        {
+            return (uint32_t)count_phys_int_reg_in + count_phys_int_reg_out + count_isa_int_reg_in +
+                   count_isa_int_reg_out + count_phys_fp_reg_in + count_phys_fp_reg_out + count_isa_fp_reg_in +
+                   count_isa_fp_reg_out;
+        }
+
+        // All of the register lists are carved out of a single zeroed block
+        // so an instruction costs one register allocation rather than eight,
+        // lists with no entries are left as nullptr
+        void allocateRegisters()
+        {
+            const uint32_t reg_count = countRegisters();
+
+            if ( reg_count == 0 ) {
+                reg_storage_ = nullptr;
+            } else {
+                reg_storage_ = static_cast<uint16_t*>(SizeClassPool::allocate(reg_count * sizeof(uint16_t)));
+                std::memset(reg_storage_, 0, reg_count * sizeof(uint16_t));
+            }
+
+            uint16_t* next_list = reg_storage_;
+            auto carve = [&next_list](const uint16_t count) {
+                uint16_t* list = (count > 0) ? next_list : nullptr;
+                next_list += count;
+                return list;
+            };
+
+            phys_int_regs_in  = carve(count_phys_int_reg_in);
+            phys_int_regs_out = carve(count_phys_int_reg_out);
+            isa_int_regs_in   = carve(count_isa_int_reg_in);
+            isa_int_regs_out  = carve(count_isa_int_reg_out);
+            phys_fp_regs_in   = carve(count_phys_fp_reg_in);
+            phys_fp_regs_out  = carve(count_phys_fp_reg_out);
+            isa_fp_regs_in    = carve(count_isa_fp_reg_in);
+            isa_fp_regs_out   = carve(count_isa_fp_reg_out);
+        }
+
+        // Must be called before the register counts are changed
+        void releaseRegisters()
+        {
+            if ( reg_storage_ != nullptr ) {
+                SizeClassPool::release(reg_storage_, countRegisters() * sizeof(uint16_t));
+                reg_storage_ = nullptr;
+            }
+        }
+
         const uint64_t ins_address;
         const uint32_t hw_thread;
 
@@ -478,7 +464,7 @@ class VanadisInstruction
         uint16_t* phys_fp_regs_in;
         uint16_t* phys_fp_regs_out;
 
-
+        uint16_t* reg_storage_ = nullptr;
 };
 
 } // namespace Vanadis
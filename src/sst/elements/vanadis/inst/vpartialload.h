@@ -36,10 +36,12 @@ public:
         is_load_lower(isLowerLoad)
     {
 
-        // We need an extra in register here
+        // We need an extra in register here, the register lists are one
+        // block so keep the FP target across the reallocation
 
-        delete[] phys_int_regs_in;
-        delete[] isa_int_regs_in;
+        const uint16_t isa_fp_out = (count_isa_fp_reg_out > 0) ? isa_fp_regs_out[0] : 0;
+
+        releaseRegisters();
 
         count_isa_int_reg_in  = 2;
         count_phys_int_reg_in = 2;
@@ -47,11 +49,9 @@ public:
         count_isa_int_reg_out = 1;
         count_phys_int_reg_out = 1;
 
-        phys_int_regs_in = new uint16_t[count_phys_int_reg_in];
-        isa_int_regs_in  = new uint16_t[count_isa_int_reg_in];
+        allocateRegisters();
 
-        phys_int_regs_out = new uint16_t[count_phys_int_reg_out];
-        isa_int_regs_out = new uint16_t[count_isa_int_reg_out];
+        if ( count_isa_fp_reg_out > 0 ) { isa_fp_regs_out[0] = isa_fp_out; }
 
         isa_int_regs_out[0] = tgtReg;
         isa_int_regs_in[0]  = memAddrReg;
@@ -11,6 +11,7 @@ import argparse
 #   VANADIS_EXE_ARGS             | ""                                               | Any arguments for the application
 #   VANADIS_ISA                  | RISCV64                                          | Which ISA to use (MIPS or RISCV64)
 #   VANADIS_LOADER_MODE          | 0                                                | Instruction uOp cache configuration. 0=LRU, 1=infinite
+#   VANADIS_BASIC_BLOCK_CACHE    | 0                                                | Number of basic blocks the decoder caches, 0 disables the cache
 #   VANADIS_VERBOSE              | 0                                                | Verbosity level for core components.
 #   VANADIS_OS_VERBOSE           | 0                                                | Verbosity level for the OS component. Defaults to 'VANADIS_VERBOSE' if not set.
 #   VANADIS_PIPE_TRACE           | ""                                               | Filename to send a trace to or "" for none
@@ -25,6 +26,7 @@ import argparse
 #   VANADIS_FP_ARITH_CYCLES      | 8                                                | Cycles per floating point operation
 #   VANADIS_FP_ARITH_UNITS       | 2                                                | Number of floating point units
 #   VANADIS_BRANCH_ARITH_CYCLES  | 2                                                | Cycles per branch operation
+#   VANADIS_ISSUE_WAKEUP         | 0                                                | Whether the core issues from wakeup lists (1) or scans the ROB each cycle (0)
 #   VANADIS_CPU_CLOCK            | 2.3GHz                                           | Core clock frequency
 #   VANADIS_NUM_CORES            | 1                                                | Number of cores
 #   VANADIS_NUM_HW_THREADS       | 1                                                | Number of hardware threads per core
@@ -44,6 +46,7 @@ parser.add_argument("-o", "--os-verbose", help="Verbosity level for the OS compo
 parser.add_argument("-c", "--num-cores", help="Number of cores. Default is 1.")
 parser.add_argument("-t", "--num-hw-threads", help="Number of hardware threads per core. Default is 1.")
 parser.add_argument("--loader-mode", help="Instruction micro-op cache setting '0'=LRU (default) or '1'=infinite")
+parser.add_argument("--basic-block-cache-entries", help="Number of basic blocks the decoder caches. Default is 0 (disabled).")
 parser.add_argument("--pipe-trace", help="Filename to send a trace to or "" for none (default).")
 parser.add_argument("--lsq-ld-entries", help="Number of load entries in the load-store queue. Default is 16.")
 parser.add_argument("--lsq-st-entries", help="Number of store entries in the load-store queue. Default is 8.")
@@ -56,6 +59,7 @@ parser.add_argument("--int-arith-units", help="Number of integer ALUs. Default i
 parser.add_argument("--fp-arith-cycles", help="Cycles per floating point operation. Default is 8.")
 parser.add_argument("--fp-arith-units", help="Number of floating point units. Default is 2.")
 parser.add_argument("--branch-arith-cycles", help="Cycles per branch operation. Default is 2.")
+parser.add_argument("--issue-wakeup", help="Whether the core issues from wakeup lists (1) or scans the ROB each cycle (0, default).")
 parser.add_argument("--cpu-clock", help="Core clock frequency. Default is 2.3GHz.")
 parser.add_argument("--library", help="Which vanadis library to use, 'vanadis' or 'vanadisdbg'. Default is vanadis.")
 parser.add_argument("--halt-at-address", help="An optional instruction address at which to end simulation. 0 indicates none (default).")
@@ -95,6 +99,8 @@ branch_arith_cycles = int(os.getenv("VANADIS_BRANCH_ARITH_CYCLES", 2)) if args.b
 env_tlb_config = int(os.getenv("VANADIS_TLB_IFACE", "0")) if args.tlb_iface == None else int(args.tlb_iface)
 lib = os.getenv("VANADIS_LIBRARY", "vanadis") if args.library == None else args.library
 loader_mode = os.getenv("VANADIS_LOADER_MODE", 0) if args.loader_mode == None else args.loader_mode
+basic_block_cache_entries = os.getenv("VANADIS_BASIC_BLOCK_CACHE", 0) if args.basic_block_cache_entries == None else args.basic_block_cache_entries
+issue_wakeup = int(os.getenv("VANADIS_ISSUE_WAKEUP", 0)) if args.issue_wakeup == None else int(args.issue_wakeup)
 cpu_clock = os.getenv("VANADIS_CPU_CLOCK", "2.3GHz") if args.cpu_clock == None else args.cpu_clock
 num_cpus = int(os.getenv("VANADIS_NUM_CORES", 1)) if args.num_cores == None else int(args.num_cores)
 num_threads = int(os.getenv("VANADIS_NUM_HW_THREADS", 1)) if args.num_hw_threads == None else int(args.num_hw_threads)
@@ -296,7 +302,8 @@ tlbWrapperParams = {
 decoderParams = {
     "loader_mode" : loader_mode,
     "uop_cache_entries" : 1536,
-    "predecode_cache_entries" : 4
+    "predecode_cache_entries" : 4,
+    "basic_block_cache_entries" : basic_block_cache_entries
 }
 
 osHdlrParams = { }
@@ -323,6 +330,7 @@ cpuParams = {
     "decodes_per_cycle" : decodes_per_cycle,
     "issues_per_cycle" :  issues_per_cycle,
     "retires_per_cycle" : retires_per_cycle,
+    "issue_wakeup" : issue_wakeup != 0,
     "pause_when_retire_address" : halt_address,
     "start_verbose_when_issue_address": dbgAddr,
     "stop_verbose_when_retire_address": stopDbg,
@@ -0,0 +1,105 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Microbenchmark for the fetch path of the instruction loader: measures
+// uop cache lookups per second as the capacity of the cache grows. The
+// access pattern is a set of loops over an instruction footprint which is
+// a little larger than the cache, so both hits and LRU replacement are
+// exercised.
+//
+// usage: sst-vanadis-vcachebench [fetches] [max uop cache entries]
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#ifndef LIKELY
+#define LIKELY(x) __builtin_expect(!!(x), 1)
+#endif
+
+#ifndef UNLIKELY
+#define UNLIKELY(x) __builtin_expect(!!(x), 0)
+#endif
+
+#include "datastruct/vcache.h"
+
+using namespace SST::Vanadis;
+
+// stands in for VanadisInstructionBundle
+struct BenchBundle {
+    uint64_t ins_addr;
+};
+
+static uint64_t
+next_random(uint64_t& state) {
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+int
+main(int argc, char* argv[]) {
+    const uint64_t fetches = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    const uint64_t max_entries = (argc > 2) ? std::strtoull(argv[2], nullptr, 10) : 65536;
+
+    printf("%12s %12s %12s %16s\n", "entries", "hits", "misses", "fetches/sec");
+
+    for (uint64_t entries = 64; entries <= max_entries; entries *= 4) {
+        VanadisCache<uint64_t, BenchBundle*, VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE> uop_cache(entries);
+
+        // footprint is 25% larger than the cache, loops start at random
+        // points within it and run for a random number of instructions
+        const uint64_t footprint = entries + (entries / 4);
+        const uint64_t text_base = 0x400000;
+
+        uint64_t rng = 0x9e3779b97f4a7c15ULL;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t pc = text_base;
+        uint64_t loop_left = 0;
+
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint64_t i = 0; i < fetches; ++i) {
+            if (loop_left == 0) {
+                pc = text_base + (next_random(rng) % footprint) * 4;
+                loop_left = 16 + (next_random(rng) % 256);
+            }
+
+            if (uop_cache.contains(pc)) {
+                BenchBundle* bundle = uop_cache.find(pc);
+                hits += (bundle->ins_addr == pc) ? 1 : 0;
+            } else {
+                BenchBundle* bundle = new BenchBundle();
+                bundle->ins_addr = pc;
+                uop_cache.store(pc, bundle);
+                misses++;
+            }
+
+            pc += 4;
+            loop_left--;
+        }
+
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+        printf("%12" PRIu64 " %12" PRIu64 " %12" PRIu64 " %16.0f\n", entries, hits, misses,
+               static_cast<double>(fetches) / elapsed.count());
+    }
+
+    return 0;
+}
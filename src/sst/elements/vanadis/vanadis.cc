@@ -357,6 +357,12 @@ VanadisCore::VanadisCore(SST::ComponentId_t id, SST::Params& params) : Component
     issues_per_cycle  = params.find<uint32_t>("issues_per_cycle", 2);
     retires_per_cycle = params.find<uint32_t>("retires_per_cycle", 2);
 
+    if ( params.find<bool>("issue_wakeup", false) ) {
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            issue_queues.push_back(new VanadisIssueQueue(thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg()));
+        }
+    }
+
     output->verbose(CALL_INFO, 8, 0, "Configuring hardware parameters:\n");
     output->verbose(CALL_INFO, 8, 0, "-> Fetches/cycle:                %" PRIu32 "\n", fetches_per_cycle);
     output->verbose(CALL_INFO, 8, 0, "-> Decodes/cycle:                %" PRIu32 "\n", decodes_per_cycle);
@@ -408,6 +414,10 @@ VanadisCore::~VanadisCore()
         delete rob[i];
     }
 
+    for ( VanadisIssueQueue* next_queue : issue_queues ) {
+        delete next_queue;
+    }
+
     if ( pipeline_trace_file_ != nullptr ) { fclose(pipeline_trace_file_); }
 
 	for( VanadisFloatingPointFlags* next_fp_flags : fp_flags ) {
@@ -732,6 +742,57 @@ VanadisCore::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_start,
     return issued_an_ins ? 0 : 1;
 }
 
+int
+VanadisCore::performIssueWakeup(const uint64_t cycle, int hwThr, uint32_t& rob_start)
+{
+    if ( UNLIKELY(halted_masks[hwThr]) ) {
+        return 1;
+    }
+
+    VanadisIssueQueue* issue_queue = issue_queues[hwThr];
+
+    // the issue queue only hands out instructions which have no register or
+    // memory ordering dependencies on older instructions, so the register
+    // use temporaries are never set here and the resource check is down to
+    // free registers and pending writes
+    const uint64_t rob_head = rob[hwThr]->headSequence();
+    uint64_t       next_seq = rob_head + rob_start;
+
+    while ( issue_queue->nextReady(next_seq) ) {
+        VanadisInstruction* ins = issue_queue->getInstruction(next_seq);
+
+        if ( 0 == checkInstructionResources(ins, int_register_stack, fp_register_stack, issue_isa_tables[hwThr]) &&
+             0 == allocateFunctionalUnit(ins) ) {
+            assignRegistersToInstruction(
+                thread_decoders[hwThr]->countISAIntReg(), thread_decoders[hwThr]->countISAFPReg(), ins,
+                int_register_stack, fp_register_stack, issue_isa_tables[hwThr]);
+
+            #ifdef VANADIS_BUILD_DEBUG
+            if ( checkVerboseAddr( ins->getInstructionAddress() ) ) {
+                output->setVerboseLevel(8);
+            }
+            if ( output->getVerboseLevel() >= 8 ) {
+                ins->printToBuffer(inst_print_buffer_, 1024);
+                output->verbose(
+                    CALL_INFO, 8, 0, "%d: ----> Issued for: %s / 0x%" PRI_ADDR " (ready: %zu)\n",
+                    ins->getHWThread(), inst_print_buffer_, ins->getInstructionAddress(), issue_queue->countReady());
+            }
+            #endif
+
+            ins->markIssued();
+            issue_queue->markIssued(next_seq);
+            ins_issued_this_cycle++;
+
+            rob_start = next_seq - rob_head;
+            return 0;
+        }
+
+        next_seq++;
+    }
+
+    return 1;
+}
+
 void
 VanadisCore::performExecute(const uint64_t cycle)
 {
@@ -1512,6 +1573,11 @@ VanadisCore::tick(SST::Cycle_t cycle)
     std::vector<uint32_t> rob_start(hw_threads,0);
     std::vector<int> unallocated_memory_op_seen(hw_threads,false);
 
+    // pick up decoded, retired and squashed instructions
+    for ( uint32_t i = 0; i < issue_queues.size(); ++i ) {
+        issue_queues[i]->sync(rob[i]);
+    }
+
     // Attempt to perform issues, cranking through the entire ROB call by call or until we
     // reach the max issues this cycle
     std::vector<int> rc(hw_threads,0);
@@ -1527,7 +1593,11 @@ VanadisCore::tick(SST::Cycle_t cycle)
         // we found a unblocked hardware thread
         if ( cnt ) {
             auto thr = m_curIssueHwThread;
-            rc[thr] = performIssue(cycle, thr, rob_start[thr], unallocated_memory_op_seen[thr]);
+            if ( issue_queues.empty() ) {
+                rc[thr] = performIssue(cycle, thr, rob_start[thr], unallocated_memory_op_seen[thr]);
+            } else {
+                rc[thr] = performIssueWakeup(cycle, thr, rob_start[thr]);
+            }
             ++m_curIssueHwThread;
             m_curIssueHwThread %= (hw_threads);
             cnt = (hw_threads);
@@ -1535,6 +1605,10 @@ VanadisCore::tick(SST::Cycle_t cycle)
             break;
         }
     }
+
+    for ( VanadisIssueQueue* next_queue : issue_queues ) {
+        next_queue->endCycle();
+    }
     }
 
     // Record how many instructions we issued this cycle
@@ -17,6 +17,7 @@
 #define _VANADIS_COMPONENT_H
 
 #include "datastruct/cqueue.h"
+#include "datastruct/vissuequeue.h"
 #include "decoder/vdecoder.h"
 #include "inst/isatable.h"
 #include "inst/regfile.h"
@@ -136,6 +137,9 @@ public:
         { "branch_units", "Number of branch units", "1" },
         { "branch_unit_cycles", "Cycles per branch", "int_arith_cycles"},
         { "issues_per_cycle", "Number of instruction issues per cycle", "2" },
+        { "issue_wakeup", "Track register and memory ordering dependencies with wakeup lists so only instructions "
+                          "whose operands have become ready are checked at issue instead of scanning the whole ROB "
+                          "every cycle. Issue decisions are identical, this is faster for large ROBs", "false" },
         { "fetches_per_cycle", "Number of instruction fetches per cycle", "2" },
         { "retires_per_cycle", "Number of instruction retires per cycle", "2" },
         { "decodes_per_cycle", "Number of instruction decodes per cycle", "2" },
@@ -236,6 +240,7 @@ private:
     void performFetch(const uint64_t cycle);
     void performDecode(const uint64_t cycle);
     int  performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_start, int& unallocated_memory_op_seen);
+    int  performIssueWakeup(const uint64_t cycle, int hwThr, uint32_t& rob_start);
     void performExecute(const uint64_t cycle);
     int  performRetire(int rob_num, VanadisCircularQueue<VanadisInstruction*>* rob, const uint64_t cycle);
     int  allocateFunctionalUnit(VanadisInstruction* ins);
@@ -304,6 +309,9 @@ private:
     std::vector<uint8_t*> tmp_not_issued_fp_reg_read;
     std::vector<uint8_t*> tmp_fp_reg_write;
 
+    // one per hw thread when issue_wakeup is enabled, empty otherwise
+    std::vector<VanadisIssueQueue*> issue_queues;
+
     std::list<VanadisInsCacheLoadRecord*>* icache_load_records = nullptr;
 
     VanadisLoadStoreQueue* lsq = nullptr;
@@ -0,0 +1,64 @@
+// Copyright 2009-2026 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2026, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BASIC_BLOCK
+#define _H_VANADIS_BASIC_BLOCK
+
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+#include "vinsbundle.h"
+
+namespace SST {
+namespace Vanadis {
+
+// A run of decoded instruction bundles starting at a given address and
+// ending with the first bundle which contains a branch. The block owns
+// copies of the bundles so it stays valid when the micro-op cache evicts
+// the originals.
+class VanadisBasicBlock {
+
+public:
+    VanadisBasicBlock(const uint64_t addr) : start_addr(addr), ins_count(0) {}
+
+    ~VanadisBasicBlock() {
+        for (VanadisInstructionBundle* next_bundle : bundles) {
+            delete next_bundle;
+        }
+    }
+
+    // the block takes ownership of the bundle
+    void addBundle(VanadisInstructionBundle* bundle) {
+        bundles.push_back(bundle);
+        ins_count += bundle->getInstructionCount();
+    }
+
+    uint64_t getStartAddress() const { return start_addr; }
+    uint32_t getBundleCount() const { return bundles.size(); }
+    uint32_t getInstructionCount() const { return ins_count; }
+
+    VanadisInstructionBundle* getBundleByIndex(const uint32_t index) { return bundles[index]; }
+
+private:
+    const uint64_t start_addr;
+    uint32_t ins_count;
+    std::vector<VanadisInstructionBundle*> bundles;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
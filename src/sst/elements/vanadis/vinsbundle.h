@@ -42,8 +42,31 @@ public:
 
     uint32_t getInstructionCount() const { return inst_bundle.size(); }
 
+    // the bundle takes ownership of the instruction
     void addInstruction(VanadisInstruction* newIns) {
-        inst_bundle.push_back(newIns->clone());
+        inst_bundle.push_back(newIns);
+    }
+
+    VanadisInstructionBundle* clone() const {
+        VanadisInstructionBundle* copy = new VanadisInstructionBundle(ins_addr);
+        copy->setPCIncrement(pc_inc);
+        copy->inst_bundle.reserve(inst_bundle.size());
+
+        for (VanadisInstruction* next_ins : inst_bundle) {
+            copy->inst_bundle.push_back(next_ins->clone());
+        }
+
+        return copy;
+    }
+
+    bool hasBranch() const {
+        for (VanadisInstruction* next_ins : inst_bundle) {
+            if (next_ins->getInstFuncType() == INST_BRANCH) {
+                return true;
+            }
+        }
+
+        return false;
     }
 
     VanadisInstruction* getInstructionByIndex(const uint32_t index) {
@@ -27,6 +27,7 @@
 #include "vanadisDbgFlags.h"
 
 #include "datastruct/vcache.h"
+#include "vbasicblock.h"
 #include "vinsbundle.h"
 
 namespace SST {
@@ -40,11 +41,14 @@ enum class VanadisInstructionLoaderMode {
 class VanadisInstructionLoader {
 public:
     VanadisInstructionLoader(const size_t uop_cache_size, const size_t predecode_cache_entries,
-                             const uint64_t cachelinewidth, SST::Output* output) {
+                             const uint64_t cachelinewidth, SST::Output* output, const size_t block_cache_entries = 0) {
 
         cache_line_width_ = cachelinewidth;
         uop_cache_ = new VanadisCache<uint64_t, VanadisInstructionBundle*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE>(uop_cache_size);
         predecode_cache_ = new VanadisCache<uint64_t, uint8_t*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY>(predecode_cache_entries);
+        block_cache_ = (block_cache_entries > 0) ?
+            new VanadisCache<uint64_t, VanadisBasicBlock*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE>(block_cache_entries) :
+            nullptr;
         output_ = output;
 
         mem_if_ = nullptr;
@@ -56,6 +60,7 @@ public:
     ~VanadisInstructionLoader() {
         delete uop_cache_;
         delete predecode_cache_;
+        delete block_cache_;
     }
 
     void setLoaderMode(const VanadisInstructionLoaderMode new_loader_mode) {
@@ -239,6 +244,76 @@ public:
         uop_cache_->clear();
         predecode_cache_->clear();
         infinite_uop_cache_.clear();
+
+        if (block_cache_ != nullptr) {
+            block_cache_->clear();
+        }
+    }
+
+    bool hasBasicBlockCache() const { return block_cache_ != nullptr; }
+
+    // Returns the basic block starting at addr, building it from the
+    // micro-op cache if it isn't cached yet. A block runs up to the first
+    // bundle containing a branch or max_block_bundles_ bundles. nullptr is
+    // returned if any bundle of the block has not been decoded yet, the
+    // caller then fetches bundle by bundle until the rest is decoded so a
+    // truncated block never ends up in the cache.
+    VanadisBasicBlock* getBasicBlockAt(const uint64_t addr) {
+        if (LIKELY(block_cache_->contains(addr))) {
+            return block_cache_->find(addr);
+        }
+
+        if (!hasBundleAt(addr)) {
+            return nullptr;
+        }
+
+        // Find the end of the block before cloning anything, this runs on
+        // every fetch until the whole block has been decoded
+        uint32_t bundle_count = 0;
+        uint64_t next_addr = addr;
+        bool complete = false;
+
+        while (bundle_count < max_block_bundles_) {
+            if (!hasBundleAt(next_addr)) {
+                break;
+            }
+
+            VanadisInstructionBundle* bundle = getBundleAt(next_addr);
+            bundle_count++;
+
+            if (bundle->hasBranch()) {
+                complete = true;
+                break;
+            }
+
+            next_addr += bundle->pcIncrement();
+        }
+
+        if (!complete && bundle_count < max_block_bundles_) {
+            #ifdef VANADIS_BUILD_DEBUG
+            output_->verbose(CALL_INFO, 16, VANADIS_DBG_INS_LDR_FLG, "[ins-loader] ---> basic block at 0x%" PRI_ADDR " stops at undecoded 0x%" PRI_ADDR ", not caching\n",
+                addr, next_addr);
+            #endif
+
+            return nullptr;
+        }
+
+        VanadisBasicBlock* block = new VanadisBasicBlock(addr);
+        next_addr = addr;
+
+        for (uint32_t i = 0; i < bundle_count; ++i) {
+            VanadisInstructionBundle* bundle = getBundleAt(next_addr);
+            block->addBundle(bundle->clone());
+            next_addr += bundle->pcIncrement();
+        }
+
+        #ifdef VANADIS_BUILD_DEBUG
+        output_->verbose(CALL_INFO, 16, VANADIS_DBG_INS_LDR_FLG, "[ins-loader] ---> built basic block at 0x%" PRI_ADDR " with %" PRIu32 " bundles / %" PRIu32 " instructions\n",
+            addr, block->getBundleCount(), block->getInstructionCount());
+        #endif
+
+        block_cache_->store(addr, block);
+        return block;
     }
 
     bool hasBundleAt(const uint64_t addr) const {
@@ -372,6 +447,11 @@ public:
                         uop_cache_->size(), uop_cache_->capacity());
         output_->verbose(CALL_INFO, 8, VANADIS_DBG_INS_LDR_FLG, "--> Predecode Cache Entries:   %zu / %zu\n",
                         predecode_cache_->size(), predecode_cache_->capacity());
+
+        if (block_cache_ != nullptr) {
+            output_->verbose(CALL_INFO, 8, VANADIS_DBG_INS_LDR_FLG, "--> Basic Block Cache Entries: %zu / %zu\n",
+                            block_cache_->size(), block_cache_->capacity());
+        }
     }
 
     bool pendingLoad(const uint64_t addr, const uint64_t len) {
@@ -421,6 +501,10 @@ private:
 
     VanadisCache<uint64_t, VanadisInstructionBundle*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE>* uop_cache_;
     VanadisCache<uint64_t, uint8_t*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY>* predecode_cache_;
+    VanadisCache<uint64_t, VanadisBasicBlock*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE>* block_cache_;
+
+    // a long straight line run is split over several blocks
+    static constexpr uint32_t max_block_bundles_ = 64;
 
     std::unordered_map<uint64_t, VanadisInstructionBundle*> infinite_uop_cache_;
 